@@ -0,0 +1,112 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBackend.cxx
+* Description:  This file contains the backends used by the scan engine of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogBackend.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+
+#include <tc/tc.h>
+#include <pom/pom/pom.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <cstdlib>
+
+
+using namespace Teamcenter;
+
+int il9::utils::AuditLog::ItkAuditScanBackend::openWorkerSession()
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	try
+	{
+		//TC_USER_ID/TC_USER_PASSWORD/TC_GROUP or the environment's auto login settings are used
+		status = ITK_auto_login();
+		status = ITK_set_journalling(il9::utils::AuditLog::il9_isAuditJournallingEnabled());
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		il9::utils::AuditLog::il9_getAuditLogger()->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::ItkAuditScanBackend::closeWorkerSession()
+{
+	ITK_exit_module(true);
+}
+
+int il9::utils::AuditLog::ItkAuditScanBackend::tagToUid(tag_t tObjectTag, std::string &szUid)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	try
+	{
+		scoped_smptr<char> spUid;
+		status = POM_tag_to_uid(tObjectTag, &spUid);
+
+		szUid = (spUid.get() != NULL) ? spUid.getString() : "";
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::ItkAuditScanBackend::uidToTag(const std::string &szUid, tag_t &tObjectTag)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	tObjectTag = NULLTAG;
+
+	try
+	{
+		status = ITK__convert_uid_to_tag(szUid.c_str(), &tObjectTag);
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::ItkAuditScanBackend::getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate,
+	const std::string &strEventTypeName, const std::vector< ValidatePropertyInput > &propNamesToValidate,
+	std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject)
+{
+	return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate,
+		modifiedPropertiesByObject, m_iChunkSize);
+}
+
+int il9::utils::AuditLog::InProcessAuditScanBackend::tagToUid(tag_t tObjectTag, std::string &szUid)
+{
+	szUid = std::to_string(tObjectTag);
+	return ITK_ok;
+}
+
+int il9::utils::AuditLog::InProcessAuditScanBackend::uidToTag(const std::string &szUid, tag_t &tObjectTag)
+{
+	tObjectTag = (tag_t)std::strtoul(szUid.c_str(), NULL, 10);
+	return ITK_ok;
+}
@@ -0,0 +1,106 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBackend.hxx
+* Description:  This file contains the backend interface used by the scan engine of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGBACKEND_HXX
+#define IL9_AUDITLOGBACKEND_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogBatch.hxx"
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			/**
+			* Everything the scan engine needs from Teamcenter. Tags are only valid inside the session which created them,
+			* so objects crossing a process boundary are exchanged as UIDs through tagToUid/uidToTag.
+			*/
+			class AuditScanBackend
+			{
+			public:
+				virtual ~AuditScanBackend() {}
+
+				//called in a worker process before its first shard / after its last shard
+				virtual int openWorkerSession() = 0;
+				virtual void closeWorkerSession() = 0;
+
+				virtual int tagToUid(tag_t tObjectTag, std::string &szUid) = 0;
+				virtual int uidToTag(const std::string &szUid, tag_t &tObjectTag) = 0;
+
+				//same contract as the batch il9_getModifiedPropertiesInfo
+				virtual int getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject) = 0;
+			};
+
+			/**
+			* Backend running the audit enquiries of the current ITK session. The scan worker executable logs in with
+			* ITK_auto_login in openWorkerSession, its session is independent of the process which started it.
+			*/
+			class ItkAuditScanBackend : public AuditScanBackend
+			{
+			public:
+				explicit ItkAuditScanBackend(int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE) : m_iChunkSize(iChunkSize) {}
+
+				int openWorkerSession() override;
+				void closeWorkerSession() override;
+
+				int tagToUid(tag_t tObjectTag, std::string &szUid) override;
+				int uidToTag(const std::string &szUid, tag_t &tObjectTag) override;
+
+				int getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject) override;
+
+			private:
+				int m_iChunkSize;
+			};
+
+			//signature of the scan function of an in-process stand-in backend
+			typedef std::function<int(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject)> AuditScanFunction;
+
+			/**
+			* Stand-in backend without Teamcenter: scans are delegated to a function and tags map to their decimal string as UID.
+			* Used to exercise the scan engine locally, in the calling process or in a worker executable built around it.
+			*/
+			class InProcessAuditScanBackend : public AuditScanBackend
+			{
+			public:
+				explicit InProcessAuditScanBackend(const AuditScanFunction &scanFunction) : m_scanFunction(scanFunction) {}
+
+				int openWorkerSession() override { return ITK_ok; }
+				void closeWorkerSession() override {}
+
+				int tagToUid(tag_t tObjectTag, std::string &szUid) override;
+				int uidToTag(const std::string &szUid, tag_t &tObjectTag) override;
+
+				int getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject) override
+				{
+					return m_scanFunction(objectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, modifiedPropertiesByObject);
+				}
+
+			private:
+				AuditScanFunction m_scanFunction;
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBaseline.cxx
+* Description:  This file contains definitions of the baseline row comparison of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+
+#include <string_view>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+void il9::utils::AuditLog::il9_getAuditPropertyColumns(const std::vector< ValidatePropertyInput > &propNamesToValidate, int nCols,
+	std::vector<int> &vectorPropertyCols)
+{
+	vectorPropertyCols.assign(propNamesToValidate.size(), -1);
+
+	int col_index = 1;
+
+	for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+	{
+		if (propNamesToValidate[indexPropInput].iType == POM_long_string)
+		{
+			vectorPropertyCols[indexPropInput] = 0;
+			continue;
+		}
+
+		if (col_index < nCols - 2) vectorPropertyCols[indexPropInput] = col_index;
+		col_index += 2;
+	}
+}
+
+int il9::utils::AuditLog::il9_visitAuditBaseline(void ***result, int row, const std::vector<int> &vectorPropertyCols,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate, AuditValueArena &arena, AuditBaselineVisitor &visitor)
+{
+	ResultStatus status(0);
+
+	tag_t auditObjectTag = *((tag_t *)result[row][0]);
+
+	int numOfModifiedProperties = 0;
+	std::unordered_set<std::string_view> hsModifiedPropertyNames;
+
+	AuditValue currentValue;
+	AuditValue oldValue;
+
+	for (int isLongStringPass = 0; isLongStringPass < 2; isLongStringPass++)
+	{
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			const ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropInput];
+			int propertyColIndex = vectorPropertyCols[indexPropInput];
+
+			if ((propertyInput.iType == POM_long_string) != (isLongStringPass == 1) || propertyColIndex < 0) continue;
+
+			AuditBaselineStep step = visitor.beforeProperty(indexPropInput);
+
+			if (step == IL9_AUDIT_BASELINE_STOP) return numOfModifiedProperties;
+			if (step == IL9_AUDIT_BASELINE_SKIP || hsModifiedPropertyNames.count(propertyInput.szPropertyName) > 0) continue;
+
+			const SnapshotValue *current = visitor.currentValueOf(indexPropInput);
+			if (current == NULL) continue;
+
+			bool isModified = false;
+
+			if (isLongStringPass == 1)
+			{
+				scoped_smptr<char> valueOld;
+				status = AOM_ask_value_string(auditObjectTag, propertyInput.szPropertyNameOld.c_str(), &valueOld);
+
+				isModified = il9_compareLongStringAuditValue(valueOld.get(), *current, arena, currentValue, oldValue);
+			}
+			else
+			{
+				isModified = il9_compareAuditValue(propertyInput.iType, result[row][propertyColIndex + 1], *current, arena, currentValue, oldValue);
+			}
+
+			if (!isModified) continue;
+
+			hsModifiedPropertyNames.insert(propertyInput.szPropertyName);
+			numOfModifiedProperties++;
+
+			visitor.onModifiedProperty(indexPropInput, currentValue, oldValue);
+		}
+	}
+
+	return numOfModifiedProperties;
+}
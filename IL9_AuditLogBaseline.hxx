@@ -0,0 +1,85 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBaseline.hxx
+* Description:  This file contains declarations of the baseline row comparison of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGBASELINE_HXX
+#define IL9_AUDITLOGBASELINE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogValue.hxx"
+
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			enum AuditBaselineStep
+			{
+				IL9_AUDIT_BASELINE_COMPARE = 0,		//compare the property
+				IL9_AUDIT_BASELINE_SKIP = 1,		//leave the property out, go on with the next one
+				IL9_AUDIT_BASELINE_STOP = 2			//leave this and all following properties out
+			};
+
+			/**
+			* Receives the properties of one audit result row from il9_visitAuditBaseline. Indexes are positions in the
+			* property list passed to il9_visitAuditBaseline.
+			*/
+			class AuditBaselineVisitor
+			{
+			public:
+				virtual ~AuditBaselineVisitor() {}
+
+				//called before a property is compared
+				virtual AuditBaselineStep beforeProperty(size_t) { return IL9_AUDIT_BASELINE_COMPARE; }
+
+				//current value of the property, NULL when it is not known; the property is then not compared
+				virtual const SnapshotValue *currentValueOf(size_t indexPropInput) = 0;
+
+				//values reference the arena and the current value, they have to be copied if kept past the next property
+				virtual void onModifiedProperty(size_t indexPropInput, const AuditValue &currentValue, const AuditValue &oldValue) = 0;
+			};
+
+			/**
+			* Column of every property in an audit enquiry result of nCols columns: the current or new value column of
+			* the property, its old value follows it. Result columns are puid followed by a property/old property pair for
+			* every non long string property in input order; columns beyond the pairs (object, event type, LOGGED_DATE)
+			* are not part of them. Long string properties own no column and get 0, properties without a pair in the
+			* result get -1.
+			*/
+			void il9_getAuditPropertyColumns(const std::vector< ValidatePropertyInput > &propNamesToValidate, int nCols,
+				std::vector<int> &vectorPropertyCols);
+
+			/**
+			* Compares the old values of one row of an audit enquiry result against the current values of the visitor.
+			*
+			* Properties with a column pair are visited first in input order, then long string properties in input order,
+			* as il9_getModifiedPropertiesInfo does. Old long string values are not part of the enquiry result, they are
+			* read from the audit record of the row. A property listed twice is reported once.
+			*
+			* @param result					audit enquiry result, the puid of the audit record is the first column
+			* @param row					row to compare
+			* @param vectorPropertyCols		columns of the properties from il9_getAuditPropertyColumns
+			* @param propNamesToValidate	properties to compare
+			* @param arena					memory of the reported values
+			* @param visitor				supplies the current values and receives the modified properties
+			* @return number of modified properties reported
+			*/
+			int il9_visitAuditBaseline(void ***result, int row, const std::vector<int> &vectorPropertyCols,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate, AuditValueArena &arena, AuditBaselineVisitor &visitor);
+		}
+	}
+}
+
+#endif
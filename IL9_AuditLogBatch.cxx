@@ -0,0 +1,687 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBatch.cxx
+* Description:  This file contains definitions of functions to fetch Audit Logs info
+*				for many objects with a single audit enquiry
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogBatch.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogColumns.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_ArgumentValidation.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_AuditLogSink.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+#include "IL9SimplePOMEnquiry.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <sa/audit.h>
+#include <fclasses/tc_date.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+#include "IL9_JournalLog.hxx"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+using namespace il9::utils::POMEnquiry;
+
+int il9::utils::AuditLog::il9_prepareAndExecuteBatchQuery(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, int &nRows, int &nCols, void**** result)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)objectTags.size());
+	journalling.setInput(dtLoggedAfterDate);
+	journalling.setInput(strEventTypeName);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		//input validations
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, dtLoggedAfterDate, "dtLoggedAfterDate");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, strEventTypeName, "eventTypeName");
+
+		//define SimplePOMEnquiry
+		Teamcenter::scoped_ptr<IL9SimplePOMEnquiry> modifyEventAuditLogsQuery;
+		modifyEventAuditLogsQuery = new IL9SimplePOMEnquiry("ModifyEventAuditLogsBatchQuery", false);
+
+		//puid column first, then property/old property pairs, then the audited object so that the
+		//property column offsets match the single object query
+		vector <string> vectorSelectAttrs;
+		vectorSelectAttrs.push_back(ATTR_PUID);
+
+		for (int indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType != POM_long_string)
+			{
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyName);
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyNameOld);
+			}
+		}
+
+		vectorSelectAttrs.push_back(OBJECT_TAG);
+
+		vector < std::pair<const std::string, vector <string> > > finalVectorOfselectAttrs;
+		finalVectorOfselectAttrs.push_back({ IL9_TYPE_FND0GENERALAUDIT, vectorSelectAttrs });
+		status = modifyEventAuditLogsQuery->addSelectAttributes(finalVectorOfselectAttrs);
+
+		vectorSelectAttrs.clear();
+		finalVectorOfselectAttrs.clear();
+
+		//bind all object tags of the chunk into one IN condition
+		vector<any> vectorObjectTagValues;
+		vectorObjectTagValues.reserve(objectTags.size());
+
+		for (int indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			vectorObjectTagValues.push_back(any(objectTags[indexObject]));
+		}
+
+		modifyEventAuditLogsQuery->addValue(IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_in, POM_external_reference, vectorObjectTagValues);
+		modifyEventAuditLogsQuery->addValue(IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_equal, POM_string, { any(strEventTypeName) });
+		modifyEventAuditLogsQuery->addValue(IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, POM_date, { any(dtLoggedAfterDate) });
+
+		//rows of every object are ordered newest first, the last row seen for an object is its oldest audit record
+		status = modifyEventAuditLogsQuery->orderBy(IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_desc_order);
+
+		//Sample Query
+		//SELECT  DISTINCT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0Object, t_01.pfnd0LoggedDate
+		//FROM PFND0GENERALAUDIT t_01 WHERE (((t_01.pfnd0Object IN ('I6U1smQOvgWMLAAAAAAAAAAAAAA', 'QBZ1smQOvgWMLAAAAAAAAAAAAAA'))
+		//AND(t_01.pfnd0EventTypeName = '__Modify')) AND((t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120))
+		//)) ORDER BY t_01.pfnd0LoggedDate DESC;
+
+		if (il9::utils::AuditLog::il9_currentAuditProfile() != NULL)
+		{
+			std::string szSignature = "batch|" + strEventTypeName;
+
+			for (int indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+			{
+				if (propNamesToValidate[indexPropNames].iType != POM_long_string) szSignature.append("|").append(propNamesToValidate[indexPropNames].szPropertyName);
+			}
+
+			il9::utils::AuditLog::il9_profileAuditEnquiry(szSignature, "objectTags=" + std::to_string(objectTags.size())
+				+ (objectTags.empty() ? std::string() : " (first " + getPUID(objectTags[0]) + ")") + ", dtLoggedAfterDate=" + il9::utils::AuditLog::il9_formatAuditDate(dtLoggedAfterDate));
+		}
+
+		//run query
+		if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n Running Batch Query --> ");
+
+		{
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_RUN);
+			status = modifyEventAuditLogsQuery->run(&nRows, &nCols, result);
+		}
+
+		il9::utils::AuditLog::il9_profileAuditResult(nRows, nCols);
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+namespace
+{
+	const char *const LAST_MOD_DATE_ATTR = "last_mod_date";
+
+	//shared by the batches of all threads
+	struct AtomicPrefilterStatistics
+	{
+		std::atomic<long> objectsChecked{ 0 };
+		std::atomic<long> objectsSkipped{ 0 };
+		std::atomic<long> auditEnquiriesAvoided{ 0 };
+		std::atomic<long> currentValueLoadsAvoided{ 0 };
+	};
+
+	AtomicPrefilterStatistics g_prefilterStatistics;
+
+	std::atomic<int> &prefilterSlackSeconds()
+	{
+		static std::atomic<int> iSlackSeconds([]()
+		{
+			const char *pcSlackSeconds = std::getenv("IL9_AUDIT_PREFILTER_SLACK_SECONDS");
+			return (pcSlackSeconds != NULL && pcSlackSeconds[0] != '\0') ? std::atoi(pcSlackSeconds) : il9::utils::AuditLog::IL9_AUDIT_DEFAULT_PREFILTER_SLACK_SECONDS;
+		}());
+
+		return iSlackSeconds;
+	}
+
+	size_t numOfChunks(size_t numOfObjects, int iChunkSize)
+	{
+		return (numOfObjects + iChunkSize - 1) / iChunkSize;
+	}
+}
+
+int il9::utils::AuditLog::il9_getAuditPrefilterSlackSeconds()
+{
+	return prefilterSlackSeconds().load();
+}
+
+void il9::utils::AuditLog::il9_setAuditPrefilterSlackSeconds(int iSlackSeconds)
+{
+	prefilterSlackSeconds().store(iSlackSeconds);
+}
+
+void il9::utils::AuditLog::il9_getAuditPrefilterStatistics(il9::utils::AuditLog::AuditPrefilterStatistics &statistics)
+{
+	statistics.objectsChecked = g_prefilterStatistics.objectsChecked.load();
+	statistics.objectsSkipped = g_prefilterStatistics.objectsSkipped.load();
+	statistics.auditEnquiriesAvoided = g_prefilterStatistics.auditEnquiriesAvoided.load();
+	statistics.currentValueLoadsAvoided = g_prefilterStatistics.currentValueLoadsAvoided.load();
+}
+
+void il9::utils::AuditLog::il9_resetAuditPrefilterStatistics()
+{
+	g_prefilterStatistics.objectsChecked.store(0);
+	g_prefilterStatistics.objectsSkipped.store(0);
+	g_prefilterStatistics.auditEnquiriesAvoided.store(0);
+	g_prefilterStatistics.currentValueLoadsAvoided.store(0);
+}
+
+int il9::utils::AuditLog::il9_prefilterAuditCandidates(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::vector<tag_t> &candidateTags,
+	int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)objectTags.size());
+	journalling.setInput(dtLoggedAfterDate);
+	journalling.journalRoutineCall();
+
+	candidateTags.clear();
+
+	try
+	{
+		//input validations
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, dtLoggedAfterDate, "dtLoggedAfterDate");
+
+		if (iChunkSize <= 0) iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE;
+
+		long long loggedAfterSeconds = il9::utils::AuditLog::il9_secondsOfAuditDate(dtLoggedAfterDate);
+		long long slackSeconds = il9_getAuditPrefilterSlackSeconds();
+		candidateTags.reserve(objectTags.size());
+
+		for (size_t chunkStart = 0; chunkStart < objectTags.size(); chunkStart += iChunkSize)
+		{
+			size_t chunkEnd = std::min(objectTags.size(), chunkStart + (size_t)iChunkSize);
+			std::vector<tag_t> vectorChunkObjectTags(objectTags.begin() + chunkStart, objectTags.begin() + chunkEnd);
+
+			il9::utils::AuditLog::PropertyValueSnapshot lastModDates;
+			status = lastModDates.load(vectorChunkObjectTags, { { LAST_MOD_DATE_ATTR, "", POM_date } }, iChunkSize);
+
+			for (size_t indexObject = 0; indexObject < vectorChunkObjectTags.size(); indexObject++)
+			{
+				const il9::utils::AuditLog::SnapshotValue *lastModDate = lastModDates.getValue(vectorChunkObjectTags[indexObject], (size_t)0);
+
+				bool isCandidate = lastModDate == NULL || lastModDate->isNull
+					|| il9::utils::AuditLog::il9_secondsOfAuditDate(lastModDate->dtValue) + slackSeconds >= loggedAfterSeconds;
+
+				if (isCandidate) candidateTags.push_back(vectorChunkObjectTags[indexObject]);
+			}
+		}
+
+		g_prefilterStatistics.objectsChecked += (long)objectTags.size();
+		g_prefilterStatistics.objectsSkipped += (long)(objectTags.size() - candidateTags.size());
+
+		//journalling
+		journalling.setOutput("numOfCandidates", (int)candidateTags.size());
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+
+		//objects which could not be checked are all queried
+		candidateTags = objectTags;
+	}
+
+	return iFail;
+}
+
+namespace
+{
+	//called for every object of a chunk which has an audit record, returns true when the object has modified properties
+	typedef std::function<bool(tag_t tObjectTag, int baselineRow, int nCols, void ***result,
+		const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)> AuditBaselineVisitor;
+
+	//called once per chunk with the audited objects and their baseline rows in caller order, returns the number of modified objects
+	typedef std::function<int(const std::vector<tag_t> &vectorAuditedObjectTags, const std::vector<int> &vectorBaselineRows, int nCols, void ***result,
+		const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)> AuditChunkVisitor;
+
+	AuditChunkVisitor forEachAuditedObject(const AuditBaselineVisitor &visitor)
+	{
+		return [visitor](const std::vector<tag_t> &vectorAuditedObjectTags, const std::vector<int> &vectorBaselineRows, int nCols, void ***result,
+			const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)
+		{
+			int numOfModifiedObjects = 0;
+
+			for (size_t indexObject = 0; indexObject < vectorAuditedObjectTags.size(); indexObject++)
+			{
+				if (visitor(vectorAuditedObjectTags[indexObject], vectorBaselineRows[indexObject], nCols, result, currentValues)) numOfModifiedObjects++;
+			}
+
+			return numOfModifiedObjects;
+		};
+	}
+
+	//column blocks and bitmap of the compact diff, reused across chunks
+	struct CompactDiffBuffers
+	{
+		il9::utils::AuditLog::AuditColumnBlock oldColumns;
+		il9::utils::AuditLog::AuditColumnBlock currentColumns;
+		il9::utils::AuditLog::AuditModifiedBitmap modifiedBitmap;
+	};
+
+	//called for every modified property found by the compact diff, the values reference the arena of the diff
+	typedef std::function<void(const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo)> CompactDiffVisitor;
+
+	//compares the properties of one object flagged by the column diff, long string properties are not part of the columns and always compared
+	class CompactBaselineVisitor : public il9::utils::AuditLog::AuditBaselineVisitor
+	{
+	public:
+		CompactBaselineVisitor(tag_t tObjectTag, size_t indexObject, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+			const std::vector<std::string_view> &vectorPropertyNames, const il9::utils::AuditLog::PropertyValueSnapshot &currentValues,
+			const il9::utils::AuditLog::AuditModifiedBitmap &modifiedBitmap, const CompactDiffVisitor &visitor)
+			: m_indexObject(indexObject), m_isAnyFlagged(modifiedBitmap.any(indexObject)), m_propNamesToValidate(propNamesToValidate),
+			m_vectorPropertyNames(vectorPropertyNames), m_currentValues(currentValues), m_modifiedBitmap(modifiedBitmap), m_visitor(visitor)
+		{
+			m_propertyInfo.objectTag = tObjectTag;
+		}
+
+		il9::utils::AuditLog::AuditBaselineStep beforeProperty(size_t indexPropInput) override
+		{
+			if (m_propNamesToValidate[indexPropInput].iType == POM_long_string) return il9::utils::AuditLog::IL9_AUDIT_BASELINE_COMPARE;
+
+			return (m_isAnyFlagged && m_modifiedBitmap.test(m_indexObject, indexPropInput))
+				? il9::utils::AuditLog::IL9_AUDIT_BASELINE_COMPARE : il9::utils::AuditLog::IL9_AUDIT_BASELINE_SKIP;
+		}
+
+		const il9::utils::AuditLog::SnapshotValue *currentValueOf(size_t indexPropInput) override
+		{
+			return m_currentValues.getValue(m_propertyInfo.objectTag, indexPropInput);
+		}
+
+		void onModifiedProperty(size_t indexPropInput, const il9::utils::AuditLog::AuditValue &currentValue,
+			const il9::utils::AuditLog::AuditValue &oldValue) override
+		{
+			m_propertyInfo.szPropertyName = m_vectorPropertyNames[indexPropInput];
+			m_propertyInfo.currentValue = currentValue;
+			m_propertyInfo.oldValue = oldValue;
+
+			m_visitor(m_propertyInfo);
+		}
+
+	private:
+		size_t m_indexObject;
+		bool m_isAnyFlagged;
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &m_propNamesToValidate;
+		const std::vector<std::string_view> &m_vectorPropertyNames;
+		const il9::utils::AuditLog::PropertyValueSnapshot &m_currentValues;
+		const il9::utils::AuditLog::AuditModifiedBitmap &m_modifiedBitmap;
+		const CompactDiffVisitor &m_visitor;
+		il9::utils::AuditLog::CompactPropertyInfo m_propertyInfo;
+	};
+
+	/**
+	* Chunk visitor of the compact overloads. Old and current values of a chunk are decoded into typed columns and the
+	* differing cells are flagged column by column, only flagged cells are compared again and materialized into the arena.
+	* vectorPropertyNames holds the names reported for propNamesToValidate and must outlive the reported values.
+	*/
+	AuditChunkVisitor diffCompactChunk(const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+		const std::vector<std::string_view> &vectorPropertyNames, il9::utils::AuditLog::AuditValueArena &arena, CompactDiffBuffers &buffers,
+		const CompactDiffVisitor &visitor)
+	{
+		return [&propNamesToValidate, &vectorPropertyNames, &arena, &buffers, visitor](const std::vector<tag_t> &vectorAuditedObjectTags,
+			const std::vector<int> &vectorBaselineRows, int nCols, void ***result, const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)
+		{
+			std::vector<int> vectorPropertyCols;
+			il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+
+			{
+				il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_DECODE);
+
+				buffers.oldColumns.decodeBaselines(result, vectorPropertyCols, vectorBaselineRows, propNamesToValidate);
+				buffers.currentColumns.decodeCurrentValues(vectorAuditedObjectTags, currentValues, propNamesToValidate);
+			}
+
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+			il9::utils::AuditLog::il9_diffAuditColumns(buffers.oldColumns, buffers.currentColumns, buffers.modifiedBitmap);
+
+			int numOfModifiedObjectsInChunk = 0;
+
+			for (size_t indexObject = 0; indexObject < vectorAuditedObjectTags.size(); indexObject++)
+			{
+				CompactBaselineVisitor baselineVisitor(vectorAuditedObjectTags[indexObject], indexObject, propNamesToValidate, vectorPropertyNames, currentValues,
+					buffers.modifiedBitmap, visitor);
+
+				if (il9::utils::AuditLog::il9_visitAuditBaseline(result, vectorBaselineRows[indexObject], vectorPropertyCols, propNamesToValidate, arena,
+					baselineVisitor) > 0)
+				{
+					numOfModifiedObjectsInChunk++;
+				}
+			}
+
+			return numOfModifiedObjectsInChunk;
+		};
+	}
+
+	/**
+	* Splits the object tags into chunks, runs one audit enquiry per chunk, locates the oldest audit record of every
+	* object and passes them to the visitor together with a snapshot of the current values of the chunk.
+	* Returns the number of objects for which the visitor reported modifications.
+	*/
+	int visitAuditBaselines(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, int iChunkSize, const AuditChunkVisitor &visitor)
+	{
+		ResultStatus status(0);
+
+		if (iChunkSize <= 0) iChunkSize = il9::utils::AuditLog::IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE;
+
+		//drop null tags and duplicates while keeping the caller's order
+		std::vector<tag_t> vectorUniqueObjectTags;
+		std::unordered_set<tag_t> hsSeenObjectTags;
+
+		vectorUniqueObjectTags.reserve(objectTags.size());
+
+		for (int indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			if (objectTags[indexObject] != NULLTAG && hsSeenObjectTags.insert(objectTags[indexObject]).second)
+			{
+				vectorUniqueObjectTags.push_back(objectTags[indexObject]);
+			}
+		}
+
+		hsSeenObjectTags.clear();
+
+		//objects last modified before the date cannot have a matching __Modify record, drop them before chunking
+		//records of other event types are logged without a save, a failed pre-filter returns all objects as candidates
+		if (strEventTypeName == il9::utils::AuditLog::IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME)
+		{
+			std::vector<tag_t> vectorCandidateTags;
+			il9::utils::AuditLog::il9_prefilterAuditCandidates(vectorUniqueObjectTags, dtLoggedAfterDate, vectorCandidateTags, iChunkSize);
+
+			long numOfChunksAvoided = (long)(numOfChunks(vectorUniqueObjectTags.size(), iChunkSize) - numOfChunks(vectorCandidateTags.size(), iChunkSize));
+			g_prefilterStatistics.auditEnquiriesAvoided += numOfChunksAvoided;
+			g_prefilterStatistics.currentValueLoadsAvoided += numOfChunksAvoided;
+
+			vectorUniqueObjectTags.swap(vectorCandidateTags);
+		}
+
+		int numOfModifiedObjects = 0;
+
+		for (size_t chunkStart = 0; chunkStart < vectorUniqueObjectTags.size(); chunkStart += iChunkSize)
+		{
+			size_t chunkEnd = std::min(vectorUniqueObjectTags.size(), chunkStart + (size_t)iChunkSize);
+			std::vector<tag_t> vectorChunkObjectTags(vectorUniqueObjectTags.begin() + chunkStart, vectorUniqueObjectTags.begin() + chunkEnd);
+
+			int nRows = 0;
+			int nCols = 0;
+
+			//freed on every exit path, exceptions thrown by the visitor included
+			scoped_smptr<void**> spResult;
+
+			//prepare and execute query for current chunk
+			status = il9::utils::AuditLog::il9_prepareAndExecuteBatchQuery(vectorChunkObjectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate,
+				nRows, nCols, &spResult);
+
+			void ***result = spResult.get();
+
+			if (nRows > 0 && nCols > 1)
+			{
+				//object column is the last select attribute, the column added by POM for ORDER BY follows it
+				int objectTagColIndex = nCols - 2;
+
+				//rows are ordered newest first, the last row of each object holds its oldest audit record
+				std::unordered_map<tag_t, int> hmBaselineRowByObject;
+				hmBaselineRowByObject.reserve(vectorChunkObjectTags.size());
+
+				for (int row_index = 0; row_index < nRows; row_index++)
+				{
+					if (result[row_index][objectTagColIndex] == NULL) continue;
+
+					hmBaselineRowByObject[*((tag_t *)result[row_index][objectTagColIndex])] = row_index;
+				}
+
+				//load current values of all audited objects of the chunk in one pass
+				std::vector<tag_t> vectorAuditedObjectTags;
+				std::vector<int> vectorBaselineRows;
+				vectorAuditedObjectTags.reserve(hmBaselineRowByObject.size());
+				vectorBaselineRows.reserve(hmBaselineRowByObject.size());
+
+				for (int indexObject = 0; indexObject < vectorChunkObjectTags.size(); indexObject++)
+				{
+					std::unordered_map<tag_t, int>::const_iterator itBaselineRow = hmBaselineRowByObject.find(vectorChunkObjectTags[indexObject]);
+					if (itBaselineRow == hmBaselineRowByObject.end()) continue;
+
+					vectorAuditedObjectTags.push_back(vectorChunkObjectTags[indexObject]);
+					vectorBaselineRows.push_back(itBaselineRow->second);
+				}
+
+				il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+				status = currentValues.load(vectorAuditedObjectTags, propNamesToValidate, iChunkSize);
+
+				numOfModifiedObjects += visitor(vectorAuditedObjectTags, vectorBaselineRows, nCols, result, currentValues);
+			}
+		}
+
+		return numOfModifiedObjects;
+	}
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > &modifiedPropertiesByObject,
+	int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(batch)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		int numOfModifiedObjects = visitAuditBaselines(objectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, iChunkSize, forEachAuditedObject(
+			[&](tag_t tObjectTag, int baselineRow, int nCols, void ***result, const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)
+		{
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+			tag_t auditObjectTag = *((tag_t *)result[baselineRow][0]);
+
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+			std::unordered_set<std::string> hsModifiedPropertyNames;
+
+			il9_validateNonLongStringPropertyValues(tObjectTag, baselineRow, nCols, propNamesToValidate, result,
+				numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+			il9_validateLongStringPropertyValues(tObjectTag, auditObjectTag, propNamesToValidate,
+				numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+
+			if (numOfModifiedProperties == 0) return false;
+
+			il9::utils::AuditLog::il9_profileAuditBytes(modifiedProperties);
+			modifiedPropertiesByObject[tObjectTag].swap(modifiedProperties);
+			return true;
+		}));
+
+		//journalling
+		journalling.setOutput("numOfModifiedObjects", numOfModifiedObjects);
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditValueArena &arena,
+	std::vector< il9::utils::AuditLog::CompactPropertyInfo > &modifiedProperties, int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(compact)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		size_t arenaBytesBefore = arena.bytesAllocated();
+
+		//property names are referenced by every reported value, copy them once per call
+		std::vector<std::string_view> vectorPropertyNames;
+		vectorPropertyNames.reserve(propNamesToValidate.size());
+
+		for (int indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			vectorPropertyNames.push_back(arena.copy(propNamesToValidate[indexPropInput].szPropertyName));
+		}
+
+		CompactDiffBuffers buffers;
+
+		int numOfModifiedObjects = visitAuditBaselines(objectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, iChunkSize,
+			diffCompactChunk(propNamesToValidate, vectorPropertyNames, arena, buffers,
+				[&](const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo) { modifiedProperties.push_back(propertyInfo); }));
+
+		il9::utils::AuditLog::il9_profileAuditBytes(arena.bytesAllocated() - arenaBytesBefore);
+
+		//journalling
+		journalling.setOutput("numOfModifiedObjects", numOfModifiedObjects);
+		journalling.setOutput("arenaBytes", (int)arena.bytesAllocated());
+		journalling.setOutput("simdEnabled", (int)il9::utils::AuditLog::il9_isAuditSimdEnabled());
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditDiffSink &sink, int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(batch sink)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		//reported names reference the input, which outlives the call
+		std::vector<std::string_view> vectorPropertyNames;
+		vectorPropertyNames.reserve(propNamesToValidate.size());
+
+		for (int indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			vectorPropertyNames.push_back(propNamesToValidate[indexPropInput].szPropertyName);
+		}
+
+		il9::utils::AuditLog::AuditValueArena arena;
+		size_t maxArenaBytes = 0;
+		CompactDiffBuffers buffers;
+
+		AuditChunkVisitor diffChunk = diffCompactChunk(propNamesToValidate, vectorPropertyNames, arena, buffers,
+			[&sink](const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo) { sink.onModifiedProperty(propertyInfo); });
+
+		int numOfModifiedObjects = visitAuditBaselines(objectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, iChunkSize,
+			[&](const std::vector<tag_t> &vectorAuditedObjectTags, const std::vector<int> &vectorBaselineRows, int nCols, void ***result,
+				const il9::utils::AuditLog::PropertyValueSnapshot &currentValues)
+		{
+			int numOfModifiedObjectsInChunk = diffChunk(vectorAuditedObjectTags, vectorBaselineRows, nCols, result, currentValues);
+
+			//the sink has consumed the values of the chunk
+			maxArenaBytes = std::max(maxArenaBytes, arena.bytesAllocated());
+			arena.clear();
+
+			return numOfModifiedObjectsInChunk;
+		});
+
+		il9::utils::AuditLog::il9_profileAuditBytes(maxArenaBytes);
+
+		//journalling
+		journalling.setOutput("numOfModifiedObjects", numOfModifiedObjects);
+		journalling.setOutput("maxArenaBytes", (int)maxArenaBytes);
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
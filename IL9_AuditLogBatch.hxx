@@ -0,0 +1,122 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBatch.hxx
+* Description:  This file contains declarations of functions to fetch Audit Logs info
+*				for many objects with a single audit enquiry
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGBATCH_HXX
+#define IL9_AUDITLOGBATCH_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			class AuditValueArena;
+			struct CompactPropertyInfo;
+
+			//default number of object tags bound into one IN condition of the audit enquiry,
+			//kept well below the bind limits of the supported databases (Oracle allows 1000 IN list entries)
+			const int IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE = 500;
+
+			//seconds an audit record may be logged after last_mod_date was set by the same save, objects modified
+			//up to this long before the logged after date are still queried; IL9_AUDIT_PREFILTER_SLACK_SECONDS overrides it
+			//at the first call, il9_setAuditPrefilterSlackSeconds at any time
+			const int IL9_AUDIT_DEFAULT_PREFILTER_SLACK_SECONDS = 300;
+
+			//only saves of the object log this event type, records of other event types are not bounded by last_mod_date
+			const char *const IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME = "__Modify";
+
+			int il9_getAuditPrefilterSlackSeconds();
+			void il9_setAuditPrefilterSlackSeconds(int iSlackSeconds);
+
+			struct AuditPrefilterStatistics
+			{
+				long objectsChecked = 0;
+				long objectsSkipped = 0;			//last_mod_date before the logged after date, no audit record can match
+				long auditEnquiriesAvoided = 0;		//chunk enquiries of the batch functions which were not run
+				long currentValueLoadsAvoided = 0;	//current value snapshots of those chunks which were not loaded
+			};
+
+			//counters of the pre-filter stage since the start of the session or the last reset, updated atomically by concurrent batches
+			void il9_getAuditPrefilterStatistics(AuditPrefilterStatistics &statistics);
+
+			void il9_resetAuditPrefilterStatistics();
+
+			/**
+			* Pre-filter stage of the batch functions. Reads last_mod_date of the objects in bulk (one enquiry per class and
+			* chunk) and keeps the objects which can have an audit record logged on or after dtLoggedAfterDate, i.e. whose
+			* last_mod_date is not more than il9_getAuditPrefilterSlackSeconds() older than it. Objects without a
+			* last_mod_date are kept. The order of objectTags is preserved. Only valid for IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME
+			* records, the batch functions skip it for other event types.
+			*
+			* @param objectTags			tags of the audited objects, without null tags and duplicates
+			* @param dtLoggedAfterDate		audit records logged on or after this date are considered
+			* @param candidateTags			receives the objects which have to be queried
+			* @param iChunkSize			number of object tags per enquiry, defaults to IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE when <= 0
+			*/
+			int il9_prefilterAuditCandidates(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::vector<tag_t> &candidateTags,
+				int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+
+			/**
+			* Runs the audit enquiry for a chunk of objects, binding all object tags into a single IN condition on fnd0Object.
+			* The fnd0Object column is appended after the property columns so that the column layout of the single object
+			* query (puid, property/old property pairs) is preserved.
+			*
+			* @param objectTags			tags of the audited objects (should not exceed the configured chunk size)
+			* @param dtLoggedAfterDate		audit records logged on or after this date are considered
+			* @param strEventTypeName		audit event type name e.g. __Modify
+			* @param propNamesToValidate	properties to select from the audit records
+			* @param nRows					number of rows returned
+			* @param nCols					number of columns returned
+			* @param result				query result, to be freed by the caller using MEM_free
+			*/
+			int il9_prepareAndExecuteBatchQuery(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, int &nRows, int &nCols, void**** result);
+
+			/**
+			* Batch version of il9_getModifiedPropertiesInfo. Object tags are split into chunks of iChunkSize entries and
+			* one audit enquiry is executed per chunk. Rows are grouped per object and the oldest audit record of each
+			* object is compared against the current property values. For __Modify records, objects whose last_mod_date rules
+			* out a matching audit record are dropped first (see il9_prefilterAuditCandidates) and never queried.
+			*
+			* @param objectTags					tags of the audited objects
+			* @param dtLoggedAfterDate				audit records logged on or after this date are considered
+			* @param strEventTypeName				audit event type name e.g. __Modify
+			* @param propNamesToValidate			properties to validate
+			* @param modifiedPropertiesByObject	modified properties keyed by object tag, only objects with modified properties are added
+			* @param iChunkSize					number of object tags per enquiry, defaults to IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE when <= 0
+			*/
+			int il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject,
+				int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+
+			/**
+			* Same as above but reports modified properties as CompactPropertyInfo: values are only materialized for
+			* modified properties and their string data is kept in the arena instead of one heap string per value.
+			* Non long string properties of a chunk are decoded into typed columns and diffed column by column
+			* (see IL9_AuditLogColumns.hxx), only the flagged cells are read again from the result.
+			* Entries are appended to modifiedProperties grouped by object, the arena must outlive them.
+			*/
+			int il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditValueArena &arena, std::vector< CompactPropertyInfo > &modifiedProperties,
+				int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBudget.cxx
+* Description:  This file contains definitions of the latency budget and cancellation
+*				of Audit Logs lookups
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogBudget.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <chrono>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	//elapsed time of a lookup against its budget, the first reason to stop is kept in the report
+	class LookupBudgetClock
+	{
+	public:
+		LookupBudgetClock(const il9::utils::AuditLog::AuditLookupBudget &budget, il9::utils::AuditLog::AuditLookupReport &report)
+			: m_budget(budget), m_report(report), m_tpStart(std::chrono::steady_clock::now())
+		{
+		}
+
+		double elapsedMs() const
+		{
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_tpStart).count();
+		}
+
+		//true when the lookup has to stop, stays true once stopped
+		bool isExhausted()
+		{
+			if (m_report.isPartial()) return true;
+
+			if (m_budget.cancellationToken != NULL && m_budget.cancellationToken->isCancelled())
+			{
+				m_report.stopReason = il9::utils::AuditLog::IL9_AUDIT_LOOKUP_CANCELLED;
+			}
+			else if (m_budget.dBudgetMs > 0.0 && elapsedMs() >= m_budget.dBudgetMs)
+			{
+				m_report.stopReason = il9::utils::AuditLog::IL9_AUDIT_LOOKUP_BUDGET_EXHAUSTED;
+			}
+
+			return m_report.isPartial();
+		}
+
+	private:
+		const il9::utils::AuditLog::AuditLookupBudget &m_budget;
+		il9::utils::AuditLog::AuditLookupReport &m_report;
+		std::chrono::steady_clock::time_point m_tpStart;
+	};
+
+	//adds its lifetime to a phase of the report, also when profiling is disabled
+	class LookupPhaseTimer
+	{
+	public:
+		LookupPhaseTimer(il9::utils::AuditLog::AuditLookupReport &report, il9::utils::AuditLog::AuditProfilePhase phase)
+			: m_report(report), m_phase(phase), m_tpStart(std::chrono::steady_clock::now())
+		{
+		}
+
+		~LookupPhaseTimer()
+		{
+			m_report.dPhaseMs[m_phase] += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_tpStart).count();
+		}
+
+		LookupPhaseTimer(const LookupPhaseTimer &) = delete;
+		LookupPhaseTimer &operator=(const LookupPhaseTimer &) = delete;
+
+	private:
+		il9::utils::AuditLog::AuditLookupReport &m_report;
+		il9::utils::AuditLog::AuditProfilePhase m_phase;
+		std::chrono::steady_clock::time_point m_tpStart;
+	};
+
+	//checks the budget before each property, long string values are fetched per property so that a long list can be interrupted
+	class BudgetBaselineVisitor : public il9::utils::AuditLog::AuditBaselineVisitor
+	{
+	public:
+		BudgetBaselineVisitor(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+			const il9::utils::AuditLog::PropertyValueSnapshot &currentValues, const std::vector<size_t> &vectorSnapshotIndexes, LookupBudgetClock &clock,
+			std::vector<bool> &vectorChecked, std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+			: m_tObjectTag(tObjectTag), m_propNamesToValidate(propNamesToValidate), m_currentValues(currentValues), m_vectorSnapshotIndexes(vectorSnapshotIndexes),
+			m_clock(clock), m_vectorChecked(vectorChecked), m_modifiedProperties(modifiedProperties)
+		{
+		}
+
+		il9::utils::AuditLog::AuditBaselineStep beforeProperty(size_t indexPropInput) override
+		{
+			if (m_clock.isExhausted()) return il9::utils::AuditLog::IL9_AUDIT_BASELINE_STOP;
+
+			m_vectorChecked[indexPropInput] = true;
+			return il9::utils::AuditLog::IL9_AUDIT_BASELINE_COMPARE;
+		}
+
+		const il9::utils::AuditLog::SnapshotValue *currentValueOf(size_t indexPropInput) override
+		{
+			ResultStatus status(0);
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = m_propNamesToValidate[indexPropInput];
+
+			if (propertyInput.iType != POM_long_string) return m_currentValues.getValue(m_tObjectTag, m_vectorSnapshotIndexes[indexPropInput]);
+
+			status = m_longStringValues.load({ m_tObjectTag }, { propertyInput });
+			return m_longStringValues.getValue(m_tObjectTag, (size_t)0);
+		}
+
+		void onModifiedProperty(size_t indexPropInput, const il9::utils::AuditLog::AuditValue &currentValue,
+			const il9::utils::AuditLog::AuditValue &oldValue) override
+		{
+			m_modifiedProperties.push_back({ m_propNamesToValidate[indexPropInput].szPropertyName, currentValue.toAny(), oldValue.toAny() });
+		}
+
+	private:
+		tag_t m_tObjectTag;
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &m_propNamesToValidate;
+		const il9::utils::AuditLog::PropertyValueSnapshot &m_currentValues;
+		const std::vector<size_t> &m_vectorSnapshotIndexes;	//position in the snapshot list by input position, long strings are not part of it
+		LookupBudgetClock &m_clock;
+		std::vector<bool> &m_vectorChecked;
+		std::vector< il9::utils::AuditLog::PropertyInfo > &m_modifiedProperties;
+
+		//values of the long string property being compared
+		il9::utils::AuditLog::PropertyValueSnapshot m_longStringValues;
+	};
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, const il9::utils::AuditLog::AuditLookupBudget &budget,
+	int &numOfModifiedProperties, std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties, il9::utils::AuditLog::AuditLookupReport &report)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(budget)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)budget.dBudgetMs);
+	journalling.journalRoutineCall();
+
+	report = il9::utils::AuditLog::AuditLookupReport();
+	LookupBudgetClock clock(budget, report);
+
+	//properties compared so far, the others are reported as unchecked when the lookup stops
+	std::vector<bool> vectorChecked(propNamesToValidate.size(), false);
+
+	try
+	{
+		int nRows = 0;
+		int nCols = 0;
+		void*** result = NULL;
+
+		if (!clock.isExhausted())
+		{
+			LookupPhaseTimer phaseTimer(report, il9::utils::AuditLog::IL9_AUDIT_PHASE_RUN);
+
+			//only the oldest audit record since dtLoggedAfterDate is compared
+			status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, IL9_AUDIT_QUERY_BASELINE_ONLY,
+				nRows, nCols, &result);
+		}
+
+		try
+		{
+			if (!report.isPartial() && (nRows == 0 || nCols <= 1))
+			{
+				//no audit record, nothing was modified
+				vectorChecked.assign(propNamesToValidate.size(), true);
+			}
+			else if (nRows > 0 && nCols > 1)
+			{
+				tag_t auditObjectTag = *((tag_t *)result[nRows - 1][0]);
+				if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n   -> " + getPUID(auditObjectTag));
+
+				//current values of non long string properties with one enquiry, long string values are fetched per property below
+				std::vector< il9::utils::AuditLog::ValidatePropertyInput > vectorSnapshotInputs;
+				std::vector<size_t> vectorSnapshotIndexes(propNamesToValidate.size(), 0);
+
+				for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+				{
+					if (propNamesToValidate[indexPropInput].iType == POM_long_string) continue;
+
+					vectorSnapshotIndexes[indexPropInput] = vectorSnapshotInputs.size();
+					vectorSnapshotInputs.push_back(propNamesToValidate[indexPropInput]);
+				}
+
+				il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+
+				if (!vectorSnapshotInputs.empty() && !clock.isExhausted())
+				{
+					LookupPhaseTimer phaseTimer(report, il9::utils::AuditLog::IL9_AUDIT_PHASE_DECODE);
+					status = currentValues.load({ tObjectTag }, vectorSnapshotInputs);
+				}
+
+				LookupPhaseTimer phaseTimer(report, il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+				il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+				std::vector<int> vectorPropertyCols;
+				il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+
+				il9::utils::AuditLog::AuditValueArena arena(4 * 1024);
+				BudgetBaselineVisitor visitor(tObjectTag, propNamesToValidate, currentValues, vectorSnapshotIndexes, clock, vectorChecked,
+					modifiedProperties);
+
+				numOfModifiedProperties += il9::utils::AuditLog::il9_visitAuditBaseline(result, nRows - 1, vectorPropertyCols, propNamesToValidate, arena, visitor);
+
+				//non long string properties without a column pair in the result are not compared by il9_getModifiedPropertiesInfo either
+				if (!report.isPartial()) vectorChecked.assign(propNamesToValidate.size(), true);
+			}
+		}
+		catch (IFail &)
+		{
+			if (result != NULL) MEM_free(result);
+			throw;
+		}
+
+		//clean up
+		if (result != NULL) MEM_free(result);
+
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			if (!vectorChecked[indexPropInput]) report.vectorUncheckedProperties.push_back(propNamesToValidate[indexPropInput].szPropertyName);
+		}
+
+		if (report.isPartial())
+		{
+			iFail = IL9_AUDIT_RESULT_PARTIAL;
+
+			if (il9::utils::AuditLog::il9_isAuditDebugEnabled())
+			{
+				logger->debug("\n Lookup stopped after " + std::to_string(clock.elapsedMs()) + " ms, " + std::to_string(report.vectorUncheckedProperties.size())
+					+ " properties not compared");
+			}
+		}
+
+		//journalling
+		journalling.setOutput("numOfModifiedProperties", numOfModifiedProperties);
+		journalling.setOutput("stopReason", (int)report.stopReason);
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	report.dTotalMs = clock.elapsedMs();
+
+	return iFail;
+}
@@ -0,0 +1,95 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBudget.hxx
+* Description:  This file contains declarations of the latency budget and cancellation
+*				of Audit Logs lookups
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGBUDGET_HXX
+#define IL9_AUDITLOGBUDGET_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//returned with the modified properties found so far when the budget ran out or the lookup was cancelled
+			const int IL9_AUDIT_RESULT_PARTIAL = 919006;
+
+			enum AuditLookupStopReason
+			{
+				IL9_AUDIT_LOOKUP_COMPLETE = 0,
+				IL9_AUDIT_LOOKUP_BUDGET_EXHAUSTED = 1,
+				IL9_AUDIT_LOOKUP_CANCELLED = 2
+			};
+
+			//set from any thread to stop the lookups it was passed to at their next check
+			class AuditCancellationToken
+			{
+			public:
+				AuditCancellationToken() : m_isCancelled(false) {}
+
+				AuditCancellationToken(const AuditCancellationToken &) = delete;
+				AuditCancellationToken &operator=(const AuditCancellationToken &) = delete;
+
+				void cancel() { m_isCancelled.store(true, std::memory_order_relaxed); }
+				bool isCancelled() const { return m_isCancelled.load(std::memory_order_relaxed); }
+
+			private:
+				std::atomic<bool> m_isCancelled;
+			};
+
+			struct AuditLookupBudget
+			{
+				double dBudgetMs = 0.0;										//time from the start of the call, 0 for no limit
+				const AuditCancellationToken *cancellationToken = NULL;		//optional
+			};
+
+			struct AuditLookupReport
+			{
+				AuditLookupStopReason stopReason = IL9_AUDIT_LOOKUP_COMPLETE;
+				double dPhaseMs[IL9_AUDIT_NUM_OF_PHASES] = {};		//indexed by AuditProfilePhase, measured whether profiling is enabled or not
+				double dTotalMs = 0.0;
+				std::vector<std::string> vectorUncheckedProperties;	//properties not compared when the lookup stopped, in input order
+
+				bool isPartial() const { return stopReason != IL9_AUDIT_LOOKUP_COMPLETE; }
+			};
+
+			/**
+			* Version of il9_getModifiedPropertiesInfo bounded by a latency budget and a cancellation token.
+			*
+			* The budget and the token are checked before the baseline enquiry, before the current values are loaded and
+			* before each property is compared, long string properties included (their values are fetched per property so a
+			* long list can be interrupted). A running enquiry or AOM call is not interrupted, a call can exceed its budget
+			* by the duration of one such step. When the lookup stops the modified properties found so far are returned with
+			* IL9_AUDIT_RESULT_PARTIAL and the properties which were not compared are listed in the report.
+			*
+			* The result of a complete lookup is the same as the one of il9_getModifiedPropertiesInfo, in the same order.
+			*
+			* @param budget					budget and cancellation token of the call
+			* @param numOfModifiedProperties	incremented by the number of modified properties
+			* @param modifiedProperties	modified properties are appended
+			* @param report				stop reason, unchecked properties and time spent per phase
+			*/
+			int il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditLookupBudget &budget, int &numOfModifiedProperties,
+				std::vector< PropertyInfo > &modifiedProperties, AuditLookupReport &report);
+		}
+	}
+}
+
+#endif
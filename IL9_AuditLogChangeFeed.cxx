@@ -0,0 +1,314 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogChangeFeed.cxx
+* Description:  This file contains definitions of the table wide change feed of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogChangeFeed.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_ArgumentValidation.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+il9::utils::AuditLog::AuditChangeFeedCursor::AuditChangeFeedCursor(date_t dtLoggedFromDate, date_t dtLoggedToDate, const std::string &strObjectClassName,
+	const std::vector<std::string> &eventTypeNames, const std::vector< ValidatePropertyInput > &propNamesToValidate, int iPageSize)
+	: m_dtLoggedFromDate(dtLoggedFromDate), m_dtLoggedToDate(dtLoggedToDate), m_strObjectClassName(strObjectClassName), m_eventTypeNames(eventTypeNames),
+	m_propNamesToValidate(propNamesToValidate), m_iPageSize(iPageSize > 0 ? iPageSize : IL9_AUDIT_DEFAULT_CHANGE_FEED_PAGE_SIZE), m_isStarted(false),
+	m_isResumed(false), m_hasMore(false), m_hasPosition(false), m_dtNextDate(NULLDATE), m_tLastObjectTag(NULLTAG)
+{
+	//the IN list binds each event type once
+	std::sort(m_eventTypeNames.begin(), m_eventTypeNames.end());
+	m_eventTypeNames.erase(std::unique(m_eventTypeNames.begin(), m_eventTypeNames.end()), m_eventTypeNames.end());
+}
+
+void il9::utils::AuditLog::AuditChangeFeedCursor::resumeAfter(tag_t tLastObjectTag)
+{
+	m_tLastObjectTag = tLastObjectTag;
+	m_isResumed = true;
+}
+
+std::string il9::utils::AuditLog::AuditChangeFeedCursor::addFilterExpr(AuditEnquiry &enquiry, bool bAfterPosition) const
+{
+	enquiry.setDateValues("loggedFromDateValue", { m_dtLoggedFromDate });
+	enquiry.setDateValues("loggedToDateValue", { m_dtLoggedToDate });
+
+	enquiry.setAttrExpr("loggedFromDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "loggedFromDateValue");
+	enquiry.setAttrExpr("loggedToDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_less_than, "loggedToDateValue");
+	enquiry.setExpr("loggedRangeExpr", "loggedFromDateExpr", POM_enquiry_and, "loggedToDateExpr");
+
+	std::string szFilterExprId = "loggedRangeExpr";
+
+	if (!m_eventTypeNames.empty())
+	{
+		enquiry.setStringValues("eventTypeValues", m_eventTypeNames);
+		enquiry.setAttrExpr("eventTypeExpr", IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_in, "eventTypeValues");
+		enquiry.setExpr("loggedRangeEventExpr", szFilterExprId, POM_enquiry_and, "eventTypeExpr");
+		szFilterExprId = "loggedRangeEventExpr";
+	}
+
+	if (!m_strObjectClassName.empty())
+	{
+		//only audit records whose object is an instance of the class survive the join
+		enquiry.setJoinExpr("objectClassJoinExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_equal, m_strObjectClassName, ATTR_PUID);
+		enquiry.setExpr("loggedRangeClassExpr", szFilterExprId, POM_enquiry_and, "objectClassJoinExpr");
+		szFilterExprId = "loggedRangeClassExpr";
+	}
+
+	if (bAfterPosition && m_hasPosition)
+	{
+		//continuation, every record logged before m_dtNextDate was read by an earlier page
+		enquiry.setDateValues("nextDateValue", { m_dtNextDate });
+		enquiry.setAttrExpr("nextDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "nextDateValue");
+		enquiry.setExpr("loggedRangeNextExpr", szFilterExprId, POM_enquiry_and, "nextDateExpr");
+		szFilterExprId = "loggedRangeNextExpr";
+	}
+
+	return szFilterExprId;
+}
+
+void il9::utils::AuditLog::AuditChangeFeedCursor::resumePosition()
+{
+	ResultStatus status(0);
+
+	//baseline of the last object consumed, the page which reported it read every record up to that second
+	AuditEnquiry baselineDateQuery("IL9AuditChangeFeedResumeQuery");
+	baselineDateQuery.setAttrExpr("minLoggedDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_min, "");
+	baselineDateQuery.addSelectExpressions({ "minLoggedDateExpr" });
+
+	baselineDateQuery.setTagValues("lastObjectTagValue", { m_tLastObjectTag });
+	baselineDateQuery.setAttrExpr("lastObjectTagExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_equal, "lastObjectTagValue");
+	baselineDateQuery.setExpr("whereExpr", addFilterExpr(baselineDateQuery, false), POM_enquiry_and, "lastObjectTagExpr");
+	baselineDateQuery.setWhereExpr("whereExpr");
+
+	int nRows = 0;
+	int nCols = 0;
+	scoped_smptr<void**> spResult;
+
+	baselineDateQuery.execute(nRows, nCols, &spResult);
+
+	//an object without records in the window does not move the start
+	if (nRows == 0 || nCols == 0 || spResult.get()[0][0] == NULL) return;
+
+	m_dtNextDate = il9_auditDateOfSeconds(il9_secondsOfAuditDate(*((date_t *)spResult.get()[0][0])) + 1);
+	m_hasPosition = true;
+}
+
+void il9::utils::AuditLog::AuditChangeFeedCursor::fetchPage(date_t dtWindowStart, date_t dtWindowEnd,
+	std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject)
+{
+	ResultStatus status(0);
+
+	AuditEnquiry pageQuery("IL9AuditChangeFeedPageQuery");
+	pageQuery.setDistinct(false);
+
+	//same column layout as the batch enquiry: puid, property/old property pairs, fnd0Object, LOGGED_DATE
+	std::vector<std::string> vectorSelectAttrs;
+	vectorSelectAttrs.push_back(ATTR_PUID);
+
+	for (size_t indexPropNames = 0; indexPropNames < m_propNamesToValidate.size(); indexPropNames++)
+	{
+		if (m_propNamesToValidate[indexPropNames].iType != POM_long_string)
+		{
+			vectorSelectAttrs.push_back(m_propNamesToValidate[indexPropNames].szPropertyName);
+			vectorSelectAttrs.push_back(m_propNamesToValidate[indexPropNames].szPropertyNameOld);
+		}
+	}
+
+	vectorSelectAttrs.push_back(OBJECT_TAG);
+	vectorSelectAttrs.push_back(LOGGED_DATE);
+	pageQuery.addSelectAttributes(IL9_TYPE_FND0GENERALAUDIT, vectorSelectAttrs);
+
+	pageQuery.setWhereExpr(m_pager->addWindowExpr(pageQuery, addFilterExpr(pageQuery, true), dtWindowStart, dtWindowEnd));
+
+	//the first row of an object is its oldest record in the page, puid breaks ties between records logged in the same second
+	pageQuery.addOrderAttribute(IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_asc_order);
+	pageQuery.addOrderAttribute(IL9_TYPE_FND0GENERALAUDIT, ATTR_PUID, POM_enquiry_asc_order);
+
+	//Sample Query
+	//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0Object, t_01.pfnd0LoggedDate
+	//FROM PFND0GENERALAUDIT t_01, PIL9_PART t_02
+	//WHERE ((((t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-21 00:00:00', 120)) AND (t_01.pfnd0LoggedDate < CONVERT(datetime, '2020-12-28 00:00:00', 120)))
+	//AND (t_01.pfnd0EventTypeName IN ('__Modify'))) AND (t_01.pfnd0Object = t_02.puid))
+	//AND ((t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-22 07:00:00', 120)) AND (t_01.pfnd0LoggedDate < CONVERT(datetime, '2020-12-22 13:00:00', 120)))
+	//ORDER BY t_01.pfnd0LoggedDate ASC, t_01.puid ASC;
+
+	int nRows = 0;
+	int nCols = 0;
+	scoped_smptr<void**> spResult;
+
+	pageQuery.execute(nRows, nCols, &spResult);
+
+	void ***result = spResult.get();
+
+	if (nRows == 0 || nCols < 3) return;
+
+	//oldest row of each object in the page, in (LOGGED_DATE, puid) order
+	std::vector<tag_t> vectorObjectTags;
+	std::unordered_map<tag_t, int> hmFirstRowByObject;
+
+	for (int row_index = 0; row_index < nRows; row_index++)
+	{
+		if (result[row_index][0] == NULL || result[row_index][nCols - 2] == NULL) continue;
+
+		tag_t tObjectTag = *((tag_t *)result[row_index][nCols - 2]);
+		if (hmFirstRowByObject.insert({ tObjectTag, row_index }).second) vectorObjectTags.push_back(tObjectTag);
+	}
+
+	//objects with a record logged in the window before this page had their baseline in an earlier page
+	std::unordered_set<tag_t> hsEarlierObjectTags;
+
+	if (!vectorObjectTags.empty() && il9_secondsOfAuditDate(m_dtLoggedFromDate) < il9_secondsOfAuditDate(dtWindowStart))
+	{
+		AuditEnquiry earlierQuery("IL9AuditChangeFeedEarlierQuery");
+		earlierQuery.setDistinct(true);
+		earlierQuery.addSelectAttributes(IL9_TYPE_FND0GENERALAUDIT, { OBJECT_TAG });
+
+		earlierQuery.setTagValues("pageObjectTagsValue", vectorObjectTags);
+		earlierQuery.setDateValues("pageStartValue", { dtWindowStart });
+
+		earlierQuery.setAttrExpr("pageObjectTagsExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_in, "pageObjectTagsValue");
+		earlierQuery.setAttrExpr("beforePageExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_less_than, "pageStartValue");
+		earlierQuery.setExpr("pageObjectsBeforeExpr", "pageObjectTagsExpr", POM_enquiry_and, "beforePageExpr");
+		earlierQuery.setExpr("whereExpr", addFilterExpr(earlierQuery, false), POM_enquiry_and, "pageObjectsBeforeExpr");
+		earlierQuery.setWhereExpr("whereExpr");
+
+		int nEarlierRows = 0;
+		int nEarlierCols = 0;
+		scoped_smptr<void**> spEarlierResult;
+
+		earlierQuery.execute(nEarlierRows, nEarlierCols, &spEarlierResult);
+
+		for (int row_index = 0; row_index < nEarlierRows && nEarlierCols > 0; row_index++)
+		{
+			if (spEarlierResult.get()[row_index][0] != NULL) hsEarlierObjectTags.insert(*((tag_t *)spEarlierResult.get()[row_index][0]));
+		}
+	}
+
+	std::vector<tag_t> vectorBaselineObjectTags;
+	vectorBaselineObjectTags.reserve(vectorObjectTags.size());
+
+	for (size_t indexObject = 0; indexObject < vectorObjectTags.size(); indexObject++)
+	{
+		if (hsEarlierObjectTags.count(vectorObjectTags[indexObject]) == 0) vectorBaselineObjectTags.push_back(vectorObjectTags[indexObject]);
+	}
+
+	if (vectorBaselineObjectTags.empty()) return;
+
+	//current values of the page, one enquiry per property class instead of AOM calls per object
+	il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+	status = currentValues.load(vectorBaselineObjectTags, m_propNamesToValidate);
+
+	for (size_t indexObject = 0; indexObject < vectorBaselineObjectTags.size(); indexObject++)
+	{
+		tag_t tObjectTag = vectorBaselineObjectTags[indexObject];
+		int baselineRow = hmFirstRowByObject[tObjectTag];
+		tag_t auditObjectTag = *((tag_t *)result[baselineRow][0]);
+
+		m_tLastObjectTag = tObjectTag;
+
+		il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+		int numOfModifiedProperties = 0;
+		std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+		std::unordered_set<std::string> hsModifiedPropertyNames;
+
+		il9_validateNonLongStringPropertyValues(tObjectTag, baselineRow, nCols, m_propNamesToValidate, result,
+			numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+		il9_validateLongStringPropertyValues(tObjectTag, auditObjectTag, m_propNamesToValidate,
+			numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+
+		if (numOfModifiedProperties == 0) continue;
+
+		il9::utils::AuditLog::il9_profileAuditBytes(modifiedProperties);
+		modifiedPropertiesByObject[tObjectTag].swap(modifiedProperties);
+	}
+}
+
+int il9::utils::AuditLog::AuditChangeFeedCursor::fetchNext(std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject, bool &hasMore)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("AuditChangeFeedCursor::fetchNext", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput(m_strObjectClassName.c_str());
+	journalling.journalRoutineCall();
+
+	modifiedPropertiesByObject.clear();
+	hasMore = false;
+
+	try
+	{
+		if (!m_isStarted)
+		{
+			//input validations
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, m_dtLoggedFromDate, "dtLoggedFromDate");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, m_dtLoggedToDate, "dtLoggedToDate");
+
+			if (m_isResumed && m_tLastObjectTag != NULLTAG) resumePosition();
+
+			m_pager.reset(new AuditLoggedDateWindowPager("IL9AuditChangeFeedQuery", IL9_TYPE_FND0GENERALAUDIT,
+				[this](AuditEnquiry &enquiry) { return addFilterExpr(enquiry, true); }, m_iPageSize));
+
+			m_hasMore = m_pager->findStart();
+			m_isStarted = true;
+		}
+
+		if (m_hasMore)
+		{
+			date_t dtWindowStart = NULLDATE;
+			date_t dtWindowEnd = NULLDATE;
+
+			m_pager->nextWindow(dtWindowStart, dtWindowEnd);
+			fetchPage(dtWindowStart, dtWindowEnd, modifiedPropertiesByObject);
+
+			//every record of the window is read, the next page continues at its end
+			m_dtNextDate = dtWindowEnd;
+			m_hasPosition = true;
+
+			m_hasMore = m_pager->findStart();
+		}
+
+		hasMore = m_hasMore;
+
+		//journalling
+		journalling.setOutput("numOfModifiedObjects", (int)modifiedPropertiesByObject.size());
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
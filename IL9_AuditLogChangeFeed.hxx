@@ -0,0 +1,104 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogChangeFeed.hxx
+* Description:  This file contains declarations of the table wide change feed of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGCHANGEFEED_HXX
+#define IL9_AUDITLOGCHANGEFEED_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//number of audit records read per page by AuditChangeFeedCursor, a page reports at most as many objects
+			const int IL9_AUDIT_DEFAULT_CHANGE_FEED_PAGE_SIZE = 200;
+
+			/**
+			* Streams the objects whose tracked properties changed in a LOGGED_DATE window, without knowing the objects upfront.
+			*
+			* The cursor reads the audit records logged in [dtLoggedFromDate, dtLoggedToDate), optionally restricted to instances
+			* of one class and to a set of event types, in (LOGGED_DATE, puid) order one page at a time: each page is a LOGGED_DATE
+			* window sized by AuditLoggedDateWindowPager to hold at most iPageSize records, so only one page of records is held
+			* in memory. The oldest record of an object in the page is its baseline unless the object has a record logged in
+			* the window before the page, which one enquiry over the objects of the page finds. The baselines are compared
+			* against the current values, the same decision as il9_getModifiedPropertiesInfo for the object, and each object
+			* is reported by the page holding its baseline. A page reports at most iPageSize objects, fewer when objects have
+			* several records in it.
+			*
+			* Iteration can be resumed with resumeAfter(getLastObjectTag()) of an earlier cursor, it continues after the second
+			* of that object's baseline.
+			*/
+			class AuditChangeFeedCursor
+			{
+			public:
+				/**
+				* @param dtLoggedFromDate		audit records logged on or after this date are considered
+				* @param dtLoggedToDate			audit records logged before this date are considered
+				* @param strObjectClassName		only audit records of instances of this class are considered, all classes when empty
+				* @param eventTypeNames			audit event type names e.g. __Modify, all event types when empty
+				* @param propNamesToValidate	properties to validate
+				* @param iPageSize				number of audit records per page, defaults to IL9_AUDIT_DEFAULT_CHANGE_FEED_PAGE_SIZE when <= 0
+				*/
+				AuditChangeFeedCursor(date_t dtLoggedFromDate, date_t dtLoggedToDate, const std::string &strObjectClassName,
+					const std::vector<std::string> &eventTypeNames, const std::vector< ValidatePropertyInput > &propNamesToValidate,
+					int iPageSize = IL9_AUDIT_DEFAULT_CHANGE_FEED_PAGE_SIZE);
+
+				AuditChangeFeedCursor(const AuditChangeFeedCursor &) = delete;
+				AuditChangeFeedCursor &operator=(const AuditChangeFeedCursor &) = delete;
+
+				//continue with the objects whose baseline was logged after the baseline of the given object, must be called before the first fetchNext
+				void resumeAfter(tag_t tLastObjectTag);
+
+				/**
+				* Replaces modifiedPropertiesByObject with the modified properties of the next page of objects, only objects with
+				* modified properties are added. hasMore is false once the window is exhausted.
+				*/
+				int fetchNext(std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject, bool &hasMore);
+
+				//last object consumed by fetchNext
+				tag_t getLastObjectTag() const { return m_tLastObjectTag; }
+
+			private:
+				//conditions of the window, event types and class, with bAfterPosition the continuation after the last page as well
+				std::string addFilterExpr(AuditEnquiry &enquiry, bool bAfterPosition) const;
+				void resumePosition();
+				void fetchPage(date_t dtWindowStart, date_t dtWindowEnd, std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject);
+
+				date_t m_dtLoggedFromDate;
+				date_t m_dtLoggedToDate;
+				std::string m_strObjectClassName;
+				std::vector<std::string> m_eventTypeNames;
+				std::vector< ValidatePropertyInput > m_propNamesToValidate;
+				int m_iPageSize;
+
+				bool m_isStarted;
+				bool m_isResumed;
+				bool m_hasMore;
+				bool m_hasPosition;		//records logged before m_dtNextDate were read
+				date_t m_dtNextDate;
+				std::unique_ptr< AuditLoggedDateWindowPager > m_pager;
+				tag_t m_tLastObjectTag;
+			};
+		}
+	}
+}
+
+#endif
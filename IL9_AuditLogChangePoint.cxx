@@ -0,0 +1,202 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogChangePoint.cxx
+* Description:  This file contains definitions of the change point locator of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogChangePoint.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	/**
+	* Visits the full history of an object. The oldest row gives a change point with its values to every modified
+	* property, the younger rows only compare the properties whose change point was not found yet and move it to the
+	* first of them whose old value differs from the current value.
+	*/
+	class ChangePointVisitor : public il9::utils::AuditLog::AuditBaselineVisitor
+	{
+	public:
+		ChangePointVisitor(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+			const il9::utils::AuditLog::PropertyValueSnapshot &currentValues, std::vector< il9::utils::AuditLog::PropertyChangePoint > &vectorChangePoints)
+			: m_tObjectTag(tObjectTag), m_propNamesToValidate(propNamesToValidate), m_currentValues(currentValues), m_vectorChangePoints(vectorChangePoints),
+			m_vectorChangePointOf(propNamesToValidate.size(), -1), m_numOfPending(0), m_auditObjectTag(NULLTAG), m_dtLoggedDate(NULLDATE), m_isBaseline(true)
+		{
+		}
+
+		//the oldest row is visited first, then the rows from the newest on
+		void setRow(void ***result, int row, int nCols, bool isBaseline)
+		{
+			m_auditObjectTag = *((tag_t *)result[row][0]);
+			m_dtLoggedDate = (result[row][nCols - 1] != NULL) ? *((date_t *)result[row][nCols - 1]) : NULLDATE;
+			m_isBaseline = isBaseline;
+		}
+
+		int numOfPending() const { return m_numOfPending; }
+
+		il9::utils::AuditLog::AuditBaselineStep beforeProperty(size_t indexPropInput) override
+		{
+			if (m_isBaseline) return il9::utils::AuditLog::IL9_AUDIT_BASELINE_COMPARE;
+			if (m_numOfPending == 0) return il9::utils::AuditLog::IL9_AUDIT_BASELINE_STOP;
+
+			return (m_vectorChangePointOf[indexPropInput] >= 0) ? il9::utils::AuditLog::IL9_AUDIT_BASELINE_COMPARE : il9::utils::AuditLog::IL9_AUDIT_BASELINE_SKIP;
+		}
+
+		const il9::utils::AuditLog::SnapshotValue *currentValueOf(size_t indexPropInput) override
+		{
+			return m_currentValues.getValue(m_tObjectTag, indexPropInput);
+		}
+
+		void onModifiedProperty(size_t indexPropInput, const il9::utils::AuditLog::AuditValue &currentValue,
+			const il9::utils::AuditLog::AuditValue &oldValue) override
+		{
+			const std::string &szPropertyName = m_propNamesToValidate[indexPropInput].szPropertyName;
+
+			if (m_isBaseline)
+			{
+				//the oldest audit record stays the change point if no younger one is found
+				m_vectorChangePoints.push_back(il9::utils::AuditLog::PropertyChangePoint());
+
+				m_vectorChangePoints.back().auditObjectTag = m_auditObjectTag;
+				m_vectorChangePoints.back().dtLoggedDate = m_dtLoggedDate;
+				m_vectorChangePoints.back().propertyInfo = { szPropertyName, currentValue.toAny(), oldValue.toAny() };
+
+				m_vectorChangePointOf[indexPropInput] = (long)m_vectorChangePoints.size() - 1;
+				m_numOfPending++;
+
+				return;
+			}
+
+			il9::utils::AuditLog::PropertyChangePoint &changePoint = m_vectorChangePoints[m_vectorChangePointOf[indexPropInput]];
+
+			changePoint.auditObjectTag = m_auditObjectTag;
+			changePoint.dtLoggedDate = m_dtLoggedDate;
+
+			if (il9::utils::AuditLog::il9_isAuditDebugEnabled())
+			{
+				il9::utils::AuditLog::il9_getAuditLogger()->debug("\n   -> " + szPropertyName + " changed by " + getPUID(m_auditObjectTag));
+			}
+
+			m_vectorChangePointOf[indexPropInput] = -1;
+			m_numOfPending--;
+		}
+
+	private:
+		tag_t m_tObjectTag;
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &m_propNamesToValidate;
+		const il9::utils::AuditLog::PropertyValueSnapshot &m_currentValues;
+		std::vector< il9::utils::AuditLog::PropertyChangePoint > &m_vectorChangePoints;
+
+		std::vector<long> m_vectorChangePointOf;	//entry in the output vector until the change point is found, -1 otherwise
+		int m_numOfPending;
+
+		tag_t m_auditObjectTag;
+		date_t m_dtLoggedDate;
+		bool m_isBaseline;
+	};
+}
+
+int il9::utils::AuditLog::il9_locatePropertyChangePoints(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, std::vector< il9::utils::AuditLog::PropertyChangePoint > &vectorChangePoints)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	size_t numOfPreviousChangePoints = vectorChangePoints.size();
+
+	try
+	{
+		int nRows = 0;
+		int nCols = 0;
+		void*** result = NULL;
+
+		//every audit record since dtLoggedAfterDate, newest first
+		status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, IL9_AUDIT_QUERY_FULL_HISTORY,
+			nRows, nCols, &result);
+
+		try
+		{
+			if (nRows > 0 && nCols > 1)
+			{
+				int baselineRow = nRows - 1;
+
+				//current values of all properties, long string values included, are compared against every visited row
+				il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+
+				{
+					il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_DECODE);
+					status = currentValues.load({ tObjectTag }, propNamesToValidate);
+				}
+
+				il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+				std::vector<int> vectorPropertyCols;
+				il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+
+				il9::utils::AuditLog::AuditValueArena arena;
+				ChangePointVisitor visitor(tObjectTag, propNamesToValidate, currentValues, vectorChangePoints);
+
+				//the oldest audit record decides whether the property is modified
+				visitor.setRow(result, baselineRow, nCols, true);
+				il9::utils::AuditLog::il9_visitAuditBaseline(result, baselineRow, vectorPropertyCols, propNamesToValidate, arena, visitor);
+
+				//single pass from the newest row, the first row whose old value differs from the current value is the change point
+				for (int row_index = 0; row_index < nRows && visitor.numOfPending() > 0; row_index++)
+				{
+					visitor.setRow(result, row_index, nCols, false);
+					il9::utils::AuditLog::il9_visitAuditBaseline(result, row_index, vectorPropertyCols, propNamesToValidate, arena, visitor);
+				}
+			}
+		}
+		catch (IFail &)
+		{
+			if (result != NULL) MEM_free(result);
+			throw;
+		}
+
+		//clean up
+		if (result != NULL) MEM_free(result);
+
+		//journalling
+		journalling.setOutput("numOfChangePoints", (int)(vectorChangePoints.size() - numOfPreviousChangePoints));
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
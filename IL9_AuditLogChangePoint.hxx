@@ -0,0 +1,62 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogChangePoint.hxx
+* Description:  This file contains declarations of the change point locator of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGCHANGEPOINT_HXX
+#define IL9_AUDITLOGCHANGEPOINT_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//audit record which brought a modified property to its current value
+			struct PropertyChangePoint
+			{
+				tag_t auditObjectTag = NULLTAG;
+				date_t dtLoggedDate = NULLDATE;
+				PropertyInfo propertyInfo;		//same values as il9_trackPropertyValueChange: current value and old value of the oldest audit record
+			};
+
+			/**
+			* Locates for every modified property the audit record where its value last changed to the current value.
+			*
+			* A property is modified when the old value of the oldest audit record logged since dtLoggedAfterDate differs
+			* from its current value, as in il9_trackPropertyValueChange. Its change point is the newest audit record whose
+			* old value differs from the current value: every younger record logged the current value as old value, so this
+			* record set it. When the value went back and forth (A -> B -> A -> B) the last change to B is reported.
+			*
+			* The full history is read with one enquiry and the current values with one snapshot. Rows are walked once from
+			* the newest to the oldest and the walk stops as soon as all modified properties are located. Old long string
+			* values are not part of the enquiry result, they are read from the audit records visited until the property is
+			* located. Change points are appended in the order of il9_getModifiedPropertiesInfo, properties listed twice are
+			* reported once.
+			*
+			* @param tObjectTag				tag of the audited object
+			* @param dtLoggedAfterDate		audit records logged on or after this date are considered
+			* @param strEventTypeName		audit event type name e.g. __Modify
+			* @param propNamesToValidate	properties to locate
+			* @param vectorChangePoints		change points of the modified properties are appended
+			*/
+			int il9_locatePropertyChangePoints(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate, std::vector< PropertyChangePoint > &vectorChangePoints);
+		}
+	}
+}
+
+#endif
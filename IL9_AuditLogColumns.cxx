@@ -0,0 +1,339 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogColumns.cxx
+* Description:  This file contains definitions of the columnar decoding of audit
+*				enquiry results and the column diff kernels of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogColumns.hxx"
+#include "IL9_AuditLogSchema.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+
+#include <algorithm>
+
+#ifdef IL9_AUDITLOG_AVX2
+#include <immintrin.h>
+#endif
+
+namespace
+{
+	//date fields packed into one integer, equal dates give equal keys (same result as POM_compare_dates == 0)
+	int64_t packDate(const date_t &dtValue)
+	{
+		return (int64_t)(((uint64_t)(uint16_t)dtValue.year << 40) | ((uint64_t)(uint8_t)dtValue.month << 32) | ((uint64_t)(uint8_t)dtValue.day << 24)
+			| ((uint64_t)(uint8_t)dtValue.hour << 16) | ((uint64_t)(uint8_t)dtValue.minute << 8) | (uint64_t)(uint8_t)dtValue.second);
+	}
+
+	bool isReferenceType(int iType)
+	{
+		return iType == POM_external_reference || iType == POM_typed_reference || iType == POM_untyped_reference;
+	}
+
+	void setBit(std::vector<uint64_t> &bits, size_t index)
+	{
+		bits[index / 64] |= 1ULL << (index % 64);
+	}
+
+	//appends the value of one row to the typed array of the column, pCell is NULL for NULL values
+	void appendResultCell(il9::utils::AuditLog::AuditColumn &column, size_t indexRow, const void *pCell)
+	{
+		if (pCell == NULL) setBit(column.nullBits, indexRow);
+
+		switch (column.iType)
+		{
+			case(POM_string):
+				column.vectorString.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_string>::oldValue(pCell));
+				break;
+			case(POM_logical):
+				column.vectorInt32.push_back((int32_t)il9::utils::AuditLog::AuditColumnComparator<POM_logical>::oldValue(pCell));
+				break;
+			case(POM_int):
+				column.vectorInt32.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_int>::oldValue(pCell));
+				break;
+			case(POM_double):
+				column.vectorDouble.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_double>::oldValue(pCell));
+				break;
+			case(POM_date):
+				column.vectorInt64.push_back(packDate(il9::utils::AuditLog::AuditColumnComparator<POM_date>::oldValue(pCell)));
+				break;
+			default:
+				if (isReferenceType(column.iType)) column.vectorInt32.push_back((int32_t)il9::utils::AuditLog::AuditColumnComparator<POM_external_reference>::oldValue(pCell));
+				break;
+		}
+	}
+
+	//appends the current value of one object, a NULL value is stored as the default the comparators read it as
+	void appendSnapshotValue(il9::utils::AuditLog::AuditColumn &column, size_t indexRow, const il9::utils::AuditLog::SnapshotValue &current)
+	{
+		if (current.isNull) setBit(column.nullBits, indexRow);
+
+		switch (column.iType)
+		{
+			case(POM_string):
+				column.vectorString.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_string>::currentValue(current));
+				break;
+			case(POM_logical):
+				column.vectorInt32.push_back((int32_t)il9::utils::AuditLog::AuditColumnComparator<POM_logical>::currentValue(current));
+				break;
+			case(POM_int):
+				column.vectorInt32.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_int>::currentValue(current));
+				break;
+			case(POM_double):
+				column.vectorDouble.push_back(il9::utils::AuditLog::AuditColumnComparator<POM_double>::currentValue(current));
+				break;
+			case(POM_date):
+				column.vectorInt64.push_back(packDate(il9::utils::AuditLog::AuditColumnComparator<POM_date>::currentValue(current)));
+				break;
+			default:
+				if (isReferenceType(column.iType)) column.vectorInt32.push_back((int32_t)il9::utils::AuditLog::AuditColumnComparator<POM_external_reference>::currentValue(current));
+				break;
+		}
+	}
+
+	size_t lowestSetBit(uint64_t word)
+	{
+#if defined(__GNUC__)
+		return (size_t)__builtin_ctzll(word);
+#else
+		size_t bit = 0;
+		while (((word >> bit) & 1) == 0) bit++;
+		return bit;
+#endif
+	}
+
+	void orBits(uint64_t *pDiffBits, size_t index, uint64_t diff)
+	{
+		//index is a multiple of the vector width, which divides 64, so the lanes never straddle two words
+		pDiffBits[index / 64] |= diff << (index % 64);
+	}
+}
+
+void il9::utils::AuditLog::AuditColumnBlock::reset(size_t numOfRows, const std::vector< ValidatePropertyInput > &propNamesToValidate)
+{
+	m_numOfRows = numOfRows;
+	m_vectorColumns.assign(propNamesToValidate.size(), AuditColumn());
+
+	for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+	{
+		AuditColumn &column = m_vectorColumns[indexPropInput];
+		column.iType = propNamesToValidate[indexPropInput].iType;
+		column.nullBits.assign((numOfRows + 63) / 64, 0);
+
+		switch (column.iType)
+		{
+			case(POM_long_string):
+				break;
+			case(POM_string):
+				column.vectorString.reserve(numOfRows);
+				break;
+			case(POM_double):
+				column.vectorDouble.reserve(numOfRows);
+				break;
+			case(POM_date):
+				column.vectorInt64.reserve(numOfRows);
+				break;
+			default:
+				column.vectorInt32.reserve(numOfRows);
+				break;
+		}
+	}
+}
+
+void il9::utils::AuditLog::AuditColumnBlock::decodeBaselines(void ***result, const std::vector<int> &vectorPropertyCols, const std::vector<int> &vectorRows,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate)
+{
+	reset(vectorRows.size(), propNamesToValidate);
+
+	for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+	{
+		AuditColumn &column = m_vectorColumns[indexPropInput];
+		if (column.iType == POM_long_string) continue;
+
+		int propertyColIndex = vectorPropertyCols[indexPropInput];
+
+		//property not part of the result, leave the column without values so that it is never flagged
+		if (propertyColIndex < 0)
+		{
+			column.iType = 0;
+			continue;
+		}
+
+		for (size_t indexRow = 0; indexRow < vectorRows.size(); indexRow++)
+		{
+			appendResultCell(column, indexRow, result[vectorRows[indexRow]][propertyColIndex + 1]);
+		}
+	}
+}
+
+void il9::utils::AuditLog::AuditColumnBlock::decodeCurrentValues(const std::vector<tag_t> &vectorObjectTags, const PropertyValueSnapshot &currentValues,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate)
+{
+	reset(vectorObjectTags.size(), propNamesToValidate);
+
+	SnapshotValue nullValue;
+
+	for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+	{
+		AuditColumn &column = m_vectorColumns[indexPropInput];
+		if (column.iType == POM_long_string) continue;
+
+		for (size_t indexRow = 0; indexRow < vectorObjectTags.size(); indexRow++)
+		{
+			const SnapshotValue *current = currentValues.getValue(vectorObjectTags[indexRow], indexPropInput);
+			appendSnapshotValue(column, indexRow, current != NULL ? *current : nullValue);
+		}
+	}
+}
+
+void il9::utils::AuditLog::AuditModifiedBitmap::reset(size_t numOfRows, size_t numOfProperties)
+{
+	m_wordsPerRow = (numOfProperties + 63) / 64;
+	m_vectorBits.assign(numOfRows * m_wordsPerRow, 0);
+}
+
+bool il9::utils::AuditLog::AuditModifiedBitmap::any(size_t indexRow) const
+{
+	for (size_t indexWord = 0; indexWord < m_wordsPerRow; indexWord++)
+	{
+		if (m_vectorBits[indexRow * m_wordsPerRow + indexWord] != 0) return true;
+	}
+
+	return false;
+}
+
+void il9::utils::AuditLog::il9_diffInt32Column(const int32_t *pOld, const int32_t *pCurrent, size_t count, uint64_t *pDiffBits)
+{
+	size_t index = 0;
+
+#ifdef IL9_AUDITLOG_AVX2
+	for (; index + 8 <= count; index += 8)
+	{
+		__m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(pOld + index)), _mm256_loadu_si256((const __m256i *)(pCurrent + index)));
+		uint64_t diff = ~(uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(equal)) & 0xFF;
+
+		if (diff != 0) orBits(pDiffBits, index, diff);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		if (pOld[index] != pCurrent[index]) orBits(pDiffBits, index, 1);
+	}
+}
+
+void il9::utils::AuditLog::il9_diffInt64Column(const int64_t *pOld, const int64_t *pCurrent, size_t count, uint64_t *pDiffBits)
+{
+	size_t index = 0;
+
+#ifdef IL9_AUDITLOG_AVX2
+	for (; index + 4 <= count; index += 4)
+	{
+		__m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(pOld + index)), _mm256_loadu_si256((const __m256i *)(pCurrent + index)));
+		uint64_t diff = ~(uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(equal)) & 0xF;
+
+		if (diff != 0) orBits(pDiffBits, index, diff);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		if (pOld[index] != pCurrent[index]) orBits(pDiffBits, index, 1);
+	}
+}
+
+void il9::utils::AuditLog::il9_diffDoubleColumn(const double *pOld, const double *pCurrent, size_t count, uint64_t *pDiffBits)
+{
+	size_t index = 0;
+
+#ifdef IL9_AUDITLOG_AVX2
+	for (; index + 4 <= count; index += 4)
+	{
+		//unordered not-equal, NaN differs from everything like operator!=
+		__m256d notEqual = _mm256_cmp_pd(_mm256_loadu_pd(pOld + index), _mm256_loadu_pd(pCurrent + index), _CMP_NEQ_UQ);
+		uint64_t diff = (uint64_t)_mm256_movemask_pd(notEqual);
+
+		if (diff != 0) orBits(pDiffBits, index, diff);
+	}
+#endif
+
+	for (; index < count; index++)
+	{
+		if (pOld[index] != pCurrent[index]) orBits(pDiffBits, index, 1);
+	}
+}
+
+void il9::utils::AuditLog::il9_diffStringColumn(const std::string_view *pOld, const std::string_view *pCurrent, size_t count, uint64_t *pDiffBits)
+{
+	//lengths first, the bytes are only compared for values of equal length
+	for (size_t index = 0; index < count; index++)
+	{
+		if (pOld[index].size() != pCurrent[index].size() || pOld[index] != pCurrent[index]) orBits(pDiffBits, index, 1);
+	}
+}
+
+void il9::utils::AuditLog::il9_diffAuditColumns(const AuditColumnBlock &oldValues, const AuditColumnBlock &currentValues, AuditModifiedBitmap &modified)
+{
+	size_t numOfRows = std::min(oldValues.numOfRows(), currentValues.numOfRows());
+	size_t numOfColumns = std::min(oldValues.numOfColumns(), currentValues.numOfColumns());
+
+	modified.reset(numOfRows, numOfColumns);
+
+	std::vector<uint64_t> diffBits;
+
+	for (size_t indexColumn = 0; indexColumn < numOfColumns; indexColumn++)
+	{
+		const AuditColumn &oldColumn = oldValues.column(indexColumn);
+		const AuditColumn &currentColumn = currentValues.column(indexColumn);
+
+		diffBits.assign((numOfRows + 63) / 64, 0);
+
+		switch (oldColumn.iType)
+		{
+			case(POM_long_string):
+				continue;
+			case(POM_string):
+				if (oldColumn.vectorString.size() < numOfRows || currentColumn.vectorString.size() < numOfRows) continue;
+				il9_diffStringColumn(oldColumn.vectorString.data(), currentColumn.vectorString.data(), numOfRows, diffBits.data());
+				break;
+			case(POM_double):
+				if (oldColumn.vectorDouble.size() < numOfRows || currentColumn.vectorDouble.size() < numOfRows) continue;
+				il9_diffDoubleColumn(oldColumn.vectorDouble.data(), currentColumn.vectorDouble.data(), numOfRows, diffBits.data());
+				break;
+			case(POM_date):
+				if (oldColumn.vectorInt64.size() < numOfRows || currentColumn.vectorInt64.size() < numOfRows) continue;
+				il9_diffInt64Column(oldColumn.vectorInt64.data(), currentColumn.vectorInt64.data(), numOfRows, diffBits.data());
+				break;
+			default:
+				if (oldColumn.vectorInt32.size() < numOfRows || currentColumn.vectorInt32.size() < numOfRows) continue;
+				il9_diffInt32Column(oldColumn.vectorInt32.data(), currentColumn.vectorInt32.data(), numOfRows, diffBits.data());
+				break;
+		}
+
+		//scatter the column bits into the per row bitmap, modifications are sparse so only set bits are visited
+		for (size_t indexWord = 0; indexWord < diffBits.size(); indexWord++)
+		{
+			uint64_t word = diffBits[indexWord];
+
+			while (word != 0)
+			{
+				modified.set(indexWord * 64 + lowestSetBit(word), indexColumn);
+				word &= word - 1;
+			}
+		}
+	}
+}
+
+bool il9::utils::AuditLog::il9_isAuditSimdEnabled()
+{
+#ifdef IL9_AUDITLOG_AVX2
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,123 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogColumns.hxx
+* Description:  This file contains declarations of the columnar decoding of audit
+*				enquiry results and the column diff kernels of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGCOLUMNS_HXX
+#define IL9_AUDITLOGCOLUMNS_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+//The diff kernels use AVX2 when the module is compiled for it (-mavx2, /arch:AVX2) and plain loops otherwise.
+//Define IL9_AUDITLOG_NO_SIMD at build time to use the plain loops on AVX2 builds as well.
+#if defined(__AVX2__) && !defined(IL9_AUDITLOG_NO_SIMD)
+#define IL9_AUDITLOG_AVX2 1
+#endif
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			class PropertyValueSnapshot;
+
+			/**
+			* Values of one property across the rows of a column block, in a typed contiguous array:
+			*	POM_int, POM_logical and references (tags)			-> vectorInt32
+			*	POM_date (fields packed in ascending significance)	-> vectorInt64
+			*	POM_double											-> vectorDouble
+			*	POM_string											-> vectorString (views into the result or snapshot)
+			* NULL values are stored as the default value the column comparators use and flagged in nullBits.
+			* Long string properties are not part of enquiry results and have no values.
+			*/
+			struct AuditColumn
+			{
+				int iType = 0;
+				std::vector<int32_t> vectorInt32;
+				std::vector<int64_t> vectorInt64;
+				std::vector<double> vectorDouble;
+				std::vector<std::string_view> vectorString;
+				std::vector<uint64_t> nullBits;
+
+				bool isNull(size_t indexRow) const { return (nullBits[indexRow / 64] >> (indexRow % 64)) & 1; }
+			};
+
+			/**
+			* Properties of a set of objects decoded column by column, either the old values of the baseline rows of an
+			* audit enquiry result or the current values of a PropertyValueSnapshot. String values are views, the result
+			* or snapshot must outlive the block.
+			*/
+			class AuditColumnBlock
+			{
+			public:
+				//old values of the given result rows, vectorPropertyCols as given by il9_getAuditPropertyColumns
+				void decodeBaselines(void ***result, const std::vector<int> &vectorPropertyCols, const std::vector<int> &vectorRows,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate);
+
+				//current values of the objects, properties are looked up by their position in the list the snapshot was loaded with
+				void decodeCurrentValues(const std::vector<tag_t> &vectorObjectTags, const PropertyValueSnapshot &currentValues,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate);
+
+				size_t numOfRows() const { return m_numOfRows; }
+				size_t numOfColumns() const { return m_vectorColumns.size(); }
+				const AuditColumn &column(size_t indexProperty) const { return m_vectorColumns[indexProperty]; }
+
+			private:
+				void reset(size_t numOfRows, const std::vector< ValidatePropertyInput > &propNamesToValidate);
+
+				size_t m_numOfRows = 0;
+				std::vector<AuditColumn> m_vectorColumns;
+			};
+
+			//bitmap of modified properties per object (row)
+			class AuditModifiedBitmap
+			{
+			public:
+				void reset(size_t numOfRows, size_t numOfProperties);
+
+				void set(size_t indexRow, size_t indexProperty) { m_vectorBits[indexRow * m_wordsPerRow + indexProperty / 64] |= 1ULL << (indexProperty % 64); }
+				bool test(size_t indexRow, size_t indexProperty) const { return (m_vectorBits[indexRow * m_wordsPerRow + indexProperty / 64] >> (indexProperty % 64)) & 1; }
+				bool any(size_t indexRow) const;
+
+			private:
+				size_t m_wordsPerRow = 0;
+				std::vector<uint64_t> m_vectorBits;
+			};
+
+			/**
+			* Diff kernels: set bit i of pDiffBits (a bitmap of (count + 63) / 64 words, cleared by the caller) when
+			* pOld[i] differs from pCurrent[i]. Doubles follow operator!=, so NaN always differs.
+			*/
+			void il9_diffInt32Column(const int32_t *pOld, const int32_t *pCurrent, size_t count, uint64_t *pDiffBits);
+			void il9_diffInt64Column(const int64_t *pOld, const int64_t *pCurrent, size_t count, uint64_t *pDiffBits);
+			void il9_diffDoubleColumn(const double *pOld, const double *pCurrent, size_t count, uint64_t *pDiffBits);
+			void il9_diffStringColumn(const std::string_view *pOld, const std::string_view *pCurrent, size_t count, uint64_t *pDiffBits);
+
+			/**
+			* Flags every (row, property) whose old value differs from the current value, the same decision as
+			* il9_compareAuditValue. Both blocks must hold the same rows and property list; long string
+			* properties are never flagged.
+			*/
+			void il9_diffAuditColumns(const AuditColumnBlock &oldValues, const AuditColumnBlock &currentValues, AuditModifiedBitmap &modified);
+
+			//true when the diff kernels were compiled with AVX2
+			bool il9_isAuditSimdEnabled();
+		}
+	}
+}
+
+#endif
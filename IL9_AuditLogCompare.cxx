@@ -0,0 +1,104 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogCompare.cxx
+* Description:  This file contains definitions of the value comparison helpers used
+*				by the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogCompare.hxx"
+
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+void il9::utils::AuditLog::il9_tokenizeStringView(std::string_view svValue, char cDelimiter, std::vector<std::string_view> &vectorTokens)
+{
+	vectorTokens.clear();
+
+	const char *pcBegin = svValue.data();
+	const char *pcEnd = pcBegin + svValue.size();
+
+	while (pcBegin < pcEnd)
+	{
+		const char *pcDelimiter = (const char *)std::memchr(pcBegin, cDelimiter, pcEnd - pcBegin);
+		if (pcDelimiter == NULL) pcDelimiter = pcEnd;
+
+		vectorTokens.push_back(std::string_view(pcBegin, pcDelimiter - pcBegin));
+
+		pcBegin = pcDelimiter + 1;
+	}
+}
+
+bool il9::utils::AuditLog::il9_isSameMultiset(const std::vector<std::string_view> &vectorLeft, const std::vector<std::string_view> &vectorRight)
+{
+	if (vectorLeft.size() != vectorRight.size()) return false;
+
+	//unchanged values are usually stored in the same order, compare in place first
+	size_t firstMismatch = 0;
+	while (firstMismatch < vectorLeft.size() && vectorLeft[firstMismatch] == vectorRight[firstMismatch]) firstMismatch++;
+
+	if (firstMismatch == vectorLeft.size()) return true;
+
+	//order independent fingerprint of the remaining values, sum and xor of the hashes
+	std::hash<std::string_view> hasher;
+	size_t leftSum = 0, leftXor = 0, rightSum = 0, rightXor = 0;
+
+	for (size_t index = firstMismatch; index < vectorLeft.size(); index++)
+	{
+		size_t leftHash = hasher(vectorLeft[index]);
+		size_t rightHash = hasher(vectorRight[index]);
+
+		leftSum += leftHash;
+		leftXor ^= leftHash;
+		rightSum += rightHash;
+		rightXor ^= rightHash;
+	}
+
+	if (leftSum != rightSum || leftXor != rightXor) return false;
+
+	//fingerprints match, confirm by counting the values
+	std::unordered_map<std::string_view, int> hmValueCount;
+	hmValueCount.reserve(vectorLeft.size() - firstMismatch);
+
+	for (size_t index = firstMismatch; index < vectorLeft.size(); index++)
+	{
+		hmValueCount[vectorLeft[index]]++;
+	}
+
+	for (size_t index = firstMismatch; index < vectorRight.size(); index++)
+	{
+		std::unordered_map<std::string_view, int>::iterator itValue = hmValueCount.find(vectorRight[index]);
+		if (itValue == hmValueCount.end() || itValue->second == 0) return false;
+
+		itValue->second--;
+	}
+
+	return true;
+}
+
+std::string il9::utils::AuditLog::il9_joinStringViews(const std::vector<std::string_view> &vectorValues, char cDelimiter)
+{
+	size_t totalLength = vectorValues.empty() ? 0 : vectorValues.size() - 1;
+
+	for (size_t index = 0; index < vectorValues.size(); index++)
+	{
+		totalLength += vectorValues[index].size();
+	}
+
+	std::string strJoined;
+	strJoined.reserve(totalLength);
+
+	for (size_t index = 0; index < vectorValues.size(); index++)
+	{
+		if (index > 0) strJoined.push_back(cDelimiter);
+		strJoined.append(vectorValues[index].data(), vectorValues[index].size());
+	}
+
+	return strJoined;
+}
@@ -0,0 +1,47 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogCompare.hxx
+* Description:  This file contains declarations of the value comparison helpers used
+*				by the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGCOMPARE_HXX
+#define IL9_AUDITLOGCOMPARE_HXX
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			/**
+			* Splits svValue on cDelimiter into views of svValue, nothing is copied. The delimiter scan uses memchr,
+			* which the C runtime implements with vector instructions. An empty input yields no token and a trailing
+			* delimiter does not add an empty token, same as il9_tokenizeString.
+			*/
+			void il9_tokenizeStringView(std::string_view svValue, char cDelimiter, std::vector<std::string_view> &vectorTokens);
+
+			/**
+			* Returns true when both lists hold the same values with the same multiplicity, irrespective of order.
+			* Lists in identical order are detected without hashing; otherwise an order independent hash of both lists
+			* rejects most differences before the values are counted in a hash map.
+			*/
+			bool il9_isSameMultiset(const std::vector<std::string_view> &vectorLeft, const std::vector<std::string_view> &vectorRight);
+
+			//joins the values with cDelimiter, used to build the reported value only once a difference is found
+			std::string il9_joinStringViews(const std::vector<std::string_view> &vectorValues, char cDelimiter);
+		}
+	}
+}
+
+#endif
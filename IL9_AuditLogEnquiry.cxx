@@ -0,0 +1,1222 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogEnquiry.cxx
+* Description:  This file contains definitions of the POM enquiry helpers used to
+*				query Fnd0GeneralAudit records
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_ArgumentValidation.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_AuditLogTrace.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <fclasses/tc_date.h>
+#include <pom/pom/pom.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+#include "IL9_JournalLog.hxx"
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+il9::utils::AuditLog::AuditEnquiry::AuditEnquiry(const std::string &szEnquiryId) : m_szEnquiryId(szEnquiryId), m_bOwner(true)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_create(m_szEnquiryId.c_str());
+
+	if (il9::utils::AuditLog::il9_isAuditTraceEnabled()) m_traceBindValues = std::make_shared< std::map<std::string, std::string> >();
+}
+
+il9::utils::AuditLog::AuditEnquiry::AuditEnquiry(const std::string &szEnquiryId, bool bOwner,
+	const std::shared_ptr< std::map<std::string, std::string> > &traceBindValues) : m_szEnquiryId(szEnquiryId), m_bOwner(bOwner), m_traceBindValues(traceBindValues)
+{
+}
+
+il9::utils::AuditLog::AuditEnquiry::~AuditEnquiry()
+{
+	//destructor must not throw, ignore the return code
+	if (m_bOwner) POM_enquiry_delete(m_szEnquiryId.c_str());
+}
+
+il9::utils::AuditLog::AuditEnquiry il9::utils::AuditLog::AuditEnquiry::createSubEnquiry(const std::string &szSubEnquiryId)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_sub_enquiry(m_szEnquiryId.c_str(), szSubEnquiryId.c_str());
+
+	return AuditEnquiry(szSubEnquiryId, false, m_traceBindValues);
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setDistinct(bool bDistinct)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_distinct(m_szEnquiryId.c_str(), bDistinct ? true : false);
+}
+
+void il9::utils::AuditLog::AuditEnquiry::addSelectAttributes(const std::string &szClassName, const std::vector<std::string> &vectorAttrs)
+{
+	ResultStatus status(0);
+
+	std::vector<const char*> vectorAttrNames;
+	vectorAttrNames.reserve(vectorAttrs.size());
+
+	for (size_t indexAttr = 0; indexAttr < vectorAttrs.size(); indexAttr++)
+	{
+		vectorAttrNames.push_back(vectorAttrs[indexAttr].c_str());
+	}
+
+	status = POM_enquiry_add_select_attrs(m_szEnquiryId.c_str(), szClassName.c_str(), (int)vectorAttrNames.size(), vectorAttrNames.data());
+
+	for (size_t indexAttr = 0; m_traceBindValues && indexAttr < vectorAttrs.size(); indexAttr++) m_vectorTraceSelectAttrs.push_back({ szClassName, vectorAttrs[indexAttr] });
+}
+
+void il9::utils::AuditLog::AuditEnquiry::addSelectExpressions(const std::vector<std::string> &vectorExprIds)
+{
+	ResultStatus status(0);
+
+	std::vector<const char*> vectorExprNames;
+	vectorExprNames.reserve(vectorExprIds.size());
+
+	for (size_t indexExpr = 0; indexExpr < vectorExprIds.size(); indexExpr++)
+	{
+		vectorExprNames.push_back(vectorExprIds[indexExpr].c_str());
+	}
+
+	status = POM_enquiry_add_select_exprs(m_szEnquiryId.c_str(), (int)vectorExprNames.size(), vectorExprNames.data());
+
+	for (size_t indexExpr = 0; m_traceBindValues && indexExpr < vectorExprIds.size(); indexExpr++) m_vectorTraceSelectAttrs.push_back({ "", vectorExprIds[indexExpr] });
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setTagValues(const std::string &szValueId, const std::vector<tag_t> &vectorValues)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_tag_value(m_szEnquiryId.c_str(), szValueId.c_str(), (int)vectorValues.size(), vectorValues.data(), POM_enquiry_bind_value);
+
+	if (m_traceBindValues)
+	{
+		std::string &szTraceValues = (*m_traceBindValues)[szValueId];
+		szTraceValues.clear();
+
+		for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++) szTraceValues.append(indexValue > 0 ? "," : "").append(std::to_string(vectorValues[indexValue]));
+	}
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setStringValues(const std::string &szValueId, const std::vector<std::string> &vectorValues)
+{
+	ResultStatus status(0);
+
+	std::vector<const char*> vectorStringValues;
+	vectorStringValues.reserve(vectorValues.size());
+
+	for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++)
+	{
+		vectorStringValues.push_back(vectorValues[indexValue].c_str());
+	}
+
+	status = POM_enquiry_set_string_value(m_szEnquiryId.c_str(), szValueId.c_str(), (int)vectorStringValues.size(), vectorStringValues.data(), POM_enquiry_bind_value);
+
+	if (m_traceBindValues)
+	{
+		std::string &szTraceValues = (*m_traceBindValues)[szValueId];
+		szTraceValues.clear();
+
+		for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++) szTraceValues.append(indexValue > 0 ? "," : "").append(vectorValues[indexValue]);
+	}
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setDateValues(const std::string &szValueId, const std::vector<date_t> &vectorValues)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_date_value(m_szEnquiryId.c_str(), szValueId.c_str(), (int)vectorValues.size(), vectorValues.data(), POM_enquiry_bind_value);
+
+	if (m_traceBindValues)
+	{
+		std::string &szTraceValues = (*m_traceBindValues)[szValueId];
+		szTraceValues.clear();
+
+		for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++)
+		{
+			szTraceValues.append(indexValue > 0 ? "," : "").append(il9::utils::AuditLog::il9_formatAuditDate(vectorValues[indexValue]));
+		}
+	}
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setAttrExpr(const std::string &szExprId, const std::string &szClassName, const std::string &szAttrName, int iOperator,
+	const std::string &szValueId)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_attr_expr(m_szEnquiryId.c_str(), szExprId.c_str(), szClassName.c_str(), szAttrName.c_str(), iOperator,
+		szValueId.empty() ? NULL : szValueId.c_str());
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setExpr(const std::string &szExprId, const std::string &szLeftExprId, int iOperator, const std::string &szRightExprId)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_expr(m_szEnquiryId.c_str(), szExprId.c_str(), szLeftExprId.c_str(), iOperator, szRightExprId.c_str());
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setJoinExpr(const std::string &szExprId, const std::string &szClassName, const std::string &szAttrName, int iOperator,
+	const std::string &szOtherClassName, const std::string &szOtherAttrName)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_join_expr(m_szEnquiryId.c_str(), szExprId.c_str(), szClassName.c_str(), szAttrName.c_str(), iOperator,
+		szOtherClassName.c_str(), szOtherAttrName.c_str());
+}
+
+void il9::utils::AuditLog::AuditEnquiry::setWhereExpr(const std::string &szExprId)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_set_where_expr(m_szEnquiryId.c_str(), szExprId.c_str());
+
+	if (m_traceBindValues) m_szTraceWhereExprId = szExprId;
+}
+
+void il9::utils::AuditLog::AuditEnquiry::addOrderAttribute(const std::string &szClassName, const std::string &szAttrName, int iOrder)
+{
+	ResultStatus status(0);
+	status = POM_enquiry_add_order_attr(m_szEnquiryId.c_str(), szClassName.c_str(), szAttrName.c_str(), iOrder);
+}
+
+void il9::utils::AuditLog::AuditEnquiry::execute(int &nRows, int &nCols, void**** result)
+{
+	ResultStatus status(0);
+
+	il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_RUN);
+
+	//an enquiry prepared before the trace was enabled has no key, it is run against the database
+	if (m_traceBindValues && il9::utils::AuditLog::il9_isAuditTraceReplaying())
+	{
+		il9::utils::AuditLog::il9_replayAuditEnquiry(traceKey(), nRows, nCols, result);
+	}
+	else
+	{
+		status = POM_enquiry_execute(m_szEnquiryId.c_str(), &nRows, &nCols, result);
+
+		if (m_traceBindValues && il9::utils::AuditLog::il9_isAuditTraceRecording())
+		{
+			il9::utils::AuditLog::il9_traceAuditEnquiry(traceKey(), m_vectorTraceSelectAttrs, nRows, nCols, *result);
+		}
+	}
+
+	il9::utils::AuditLog::il9_profileAuditResult(nRows, nCols);
+}
+
+std::string il9::utils::AuditLog::AuditEnquiry::traceKey() const
+{
+	//enquiry ids are session counters and not part of the key
+	std::string szKey;
+
+	for (size_t indexAttr = 0; indexAttr < m_vectorTraceSelectAttrs.size(); indexAttr++)
+	{
+		szKey.append(indexAttr > 0 ? "," : "").append(m_vectorTraceSelectAttrs[indexAttr].first).append(".").append(m_vectorTraceSelectAttrs[indexAttr].second);
+	}
+
+	szKey.append("|").append(m_szTraceWhereExprId);
+
+	for (std::map<std::string, std::string>::const_iterator itValue = m_traceBindValues->begin(); itValue != m_traceBindValues->end(); itValue++)
+	{
+		szKey.append("|").append(itValue->first).append("=").append(itValue->second);
+	}
+
+	return szKey;
+}
+
+il9::utils::AuditLog::AuditLoggedDateWindowPager::AuditLoggedDateWindowPager(const std::string &szEnquiryId, const std::string &szAuditClassName,
+	const FilterBuilder &filterBuilder, int iPageSize)
+	: m_szEnquiryId(szEnquiryId), m_szAuditClassName(szAuditClassName), m_filterBuilder(filterBuilder), m_iPageSize(iPageSize > 0 ? iPageSize : 1),
+	m_dtStart(NULLDATE), m_windowSeconds(IL9_AUDIT_INITIAL_WINDOW_SECONDS)
+{
+}
+
+bool il9::utils::AuditLog::AuditLoggedDateWindowPager::findStart()
+{
+	AuditEnquiry minLoggedDateQuery(m_szEnquiryId + "_MinDate");
+	minLoggedDateQuery.setAttrExpr("minLoggedDateExpr", m_szAuditClassName, LOGGED_DATE, POM_enquiry_min, "");
+	minLoggedDateQuery.addSelectExpressions({ "minLoggedDateExpr" });
+	minLoggedDateQuery.setWhereExpr(m_filterBuilder(minLoggedDateQuery));
+
+	//Sample Query
+	//SELECT MIN(t_01.pfnd0LoggedDate) FROM PFND0GENERALAUDIT t_01 WHERE ((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA')
+	//AND (t_01.pfnd0EventTypeName = '__Modify')) AND (t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120));
+
+	int nRows = 0;
+	int nCols = 0;
+	scoped_smptr<void**> spResult;
+
+	minLoggedDateQuery.execute(nRows, nCols, &spResult);
+
+	//MIN of no record is NULL
+	if (nRows == 0 || nCols == 0 || spResult.get()[0][0] == NULL) return false;
+
+	m_dtStart = *((date_t *)spResult.get()[0][0]);
+	return true;
+}
+
+int il9::utils::AuditLog::AuditLoggedDateWindowPager::countRecords(date_t dtWindowStart, date_t dtWindowEnd)
+{
+	AuditEnquiry countQuery(m_szEnquiryId + "_Count");
+	countQuery.setAttrExpr("countExpr", m_szAuditClassName, ATTR_PUID, POM_enquiry_count, "");
+	countQuery.addSelectExpressions({ "countExpr" });
+	countQuery.setWhereExpr(addWindowExpr(countQuery, m_filterBuilder(countQuery), dtWindowStart, dtWindowEnd));
+
+	int nRows = 0;
+	int nCols = 0;
+	scoped_smptr<void**> spResult;
+
+	countQuery.execute(nRows, nCols, &spResult);
+
+	return (nRows > 0 && nCols > 0 && spResult.get()[0][0] != NULL) ? *((int *)spResult.get()[0][0]) : 0;
+}
+
+void il9::utils::AuditLog::AuditLoggedDateWindowPager::nextWindow(date_t &dtWindowStart, date_t &dtWindowEnd)
+{
+	long long startSeconds = il9_secondsOfAuditDate(m_dtStart);
+	long long windowSeconds = m_windowSeconds;
+
+	int numOfRecords = countRecords(m_dtStart, il9_auditDateOfSeconds(startSeconds + windowSeconds));
+
+	//assuming records spread evenly over the window, each step lands close to a full page
+	while (numOfRecords > m_iPageSize && windowSeconds > 1)
+	{
+		windowSeconds = std::max(1LL, std::min(windowSeconds - 1, windowSeconds * m_iPageSize / numOfRecords));
+		numOfRecords = countRecords(m_dtStart, il9_auditDateOfSeconds(startSeconds + windowSeconds));
+	}
+
+	//sparse history, the next window may be wider; bounded to keep the end a valid date
+	m_windowSeconds = (numOfRecords * 2 < m_iPageSize) ? std::min(windowSeconds * 2, 1000LL * 366 * 86400) : windowSeconds;
+
+	dtWindowStart = m_dtStart;
+	dtWindowEnd = il9_auditDateOfSeconds(startSeconds + windowSeconds);
+}
+
+std::string il9::utils::AuditLog::AuditLoggedDateWindowPager::addWindowExpr(AuditEnquiry &enquiry, const std::string &szFilterExprId, date_t dtWindowStart,
+	date_t dtWindowEnd) const
+{
+	enquiry.setDateValues("windowStartValue", { dtWindowStart });
+	enquiry.setDateValues("windowEndValue", { dtWindowEnd });
+
+	enquiry.setAttrExpr("windowStartExpr", m_szAuditClassName, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "windowStartValue");
+	enquiry.setAttrExpr("windowEndExpr", m_szAuditClassName, LOGGED_DATE, POM_enquiry_less_than, "windowEndValue");
+	enquiry.setExpr("windowExpr", "windowStartExpr", POM_enquiry_and, "windowEndExpr");
+	enquiry.setExpr("filterWindowExpr", szFilterExprId, POM_enquiry_and, "windowExpr");
+
+	return "filterWindowExpr";
+}
+
+namespace
+{
+	//prepared enquiry of the session cache
+	struct PreparedAuditEnquiry
+	{
+		std::unique_ptr<il9::utils::AuditLog::AuditEnquiry> enquiry;
+		std::unique_ptr<il9::utils::AuditLog::AuditEnquiry> minLoggedDateQuery;	//baseline only mode
+		std::vector< std::unique_ptr<il9::utils::AuditLog::AuditEnquiry> > eventMinLoggedDateQueries;	//baseline only multi event mode, one per event type
+		std::list<std::string>::iterator itRecentlyUsed;
+	};
+
+	class AuditEnquiryCache
+	{
+	public:
+		static AuditEnquiryCache &instance()
+		{
+			//never destroyed, POM must not be called from static destructors after the session has ended
+			static AuditEnquiryCache *cache = new AuditEnquiryCache();
+			return *cache;
+		}
+
+		//returns the prepared enquiry for the signature, NULL when it has to be prepared
+		PreparedAuditEnquiry *find(const std::string &szSignature)
+		{
+			std::unordered_map<std::string, PreparedAuditEnquiry>::iterator itPrepared = m_hmPrepared.find(szSignature);
+
+			if (itPrepared == m_hmPrepared.end())
+			{
+				m_statistics.misses++;
+				return NULL;
+			}
+
+			m_statistics.hits++;
+			m_lstRecentlyUsed.splice(m_lstRecentlyUsed.begin(), m_lstRecentlyUsed, itPrepared->second.itRecentlyUsed);
+
+			return &itPrepared->second;
+		}
+
+		PreparedAuditEnquiry &insert(const std::string &szSignature, PreparedAuditEnquiry &&prepared)
+		{
+			while (!m_lstRecentlyUsed.empty() && m_hmPrepared.size() >= il9::utils::AuditLog::IL9_AUDIT_ENQUIRY_CACHE_SIZE)
+			{
+				m_hmPrepared.erase(m_lstRecentlyUsed.back());
+				m_lstRecentlyUsed.pop_back();
+				m_statistics.evictions++;
+			}
+
+			m_lstRecentlyUsed.push_front(szSignature);
+			prepared.itRecentlyUsed = m_lstRecentlyUsed.begin();
+
+			return m_hmPrepared[szSignature] = std::move(prepared);
+		}
+
+		std::string nextEnquiryId()
+		{
+			return "IL9AuditLogQuery_" + std::to_string(++m_enquiryCounter);
+		}
+
+		//ifail of the signature when its enquiry failed before, ITK_ok when it can be run
+		int failureOf(const std::string &szSignature)
+		{
+			std::unordered_map<std::string, int>::const_iterator itFailed = m_hmFailed.find(szSignature);
+			if (itFailed == m_hmFailed.end()) return ITK_ok;
+
+			m_statistics.skipped++;
+			return itFailed->second;
+		}
+
+		//drops the prepared enquiry, the signature is not run again in this session
+		void markFailed(const std::string &szSignature, int ifail)
+		{
+			std::unordered_map<std::string, PreparedAuditEnquiry>::iterator itPrepared = m_hmPrepared.find(szSignature);
+
+			if (itPrepared != m_hmPrepared.end())
+			{
+				m_lstRecentlyUsed.erase(itPrepared->second.itRecentlyUsed);
+				m_hmPrepared.erase(itPrepared);
+			}
+
+			m_hmFailed[szSignature] = ifail;
+		}
+
+		void statistics(il9::utils::AuditLog::AuditEnquiryCacheStatistics &statistics) const
+		{
+			statistics = m_statistics;
+			statistics.size = (int)m_hmPrepared.size();
+			statistics.failed = (int)m_hmFailed.size();
+		}
+
+		void clear()
+		{
+			m_hmPrepared.clear();
+			m_lstRecentlyUsed.clear();
+			m_hmFailed.clear();
+			m_statistics = il9::utils::AuditLog::AuditEnquiryCacheStatistics();
+		}
+
+	private:
+		std::unordered_map<std::string, PreparedAuditEnquiry> m_hmPrepared;
+		std::unordered_map<std::string, int> m_hmFailed;		//signatures whose pushdown enquiry failed and their ifail
+		std::list<std::string> m_lstRecentlyUsed;
+		il9::utils::AuditLog::AuditEnquiryCacheStatistics m_statistics;
+		long m_enquiryCounter = 0;
+	};
+
+	//cache key: mode, audit class, event type, class of the object (pushdown mode only) and the ordered list of selected property columns
+	std::string buildAuditEnquirySignature(il9::utils::AuditLog::AuditQueryMode queryMode, const std::string &szAuditClassName, const std::string &strEventTypeName,
+		const std::string &szObjectClassName, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		std::string szSignature = std::to_string((int)queryMode);
+		szSignature.append("|").append(szAuditClassName);
+		szSignature.append("|").append(strEventTypeName);
+		szSignature.append("|").append(szObjectClassName);
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType == POM_long_string) continue;
+
+			szSignature.append("|").append(propNamesToValidate[indexPropNames].szPropertyName);
+			szSignature.append(",").append(propNamesToValidate[indexPropNames].szPropertyNameOld);
+		}
+
+		return szSignature;
+	}
+
+	/**
+	* Whether the schema allows the pushdown enquiry: every joined property is an attribute of the object class and its old value
+	* one of the audit class. A pushdown enquiry which fails although the schema allows it failed for a transient reason (lock,
+	* timeout, connection) and is run again for the next object.
+	*/
+	bool isPushdownSupportedBySchema(const std::string &szAuditClassName, const std::string &szObjectClassName,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType == POM_long_string) continue;
+
+			tag_t tAttrId = NULLTAG;
+
+			if (POM_attr_id_of_attr(propNamesToValidate[indexPropNames].szPropertyName.c_str(), szObjectClassName.c_str(), &tAttrId) != ITK_ok
+				|| tAttrId == NULLTAG)
+			{
+				return false;
+			}
+
+			tAttrId = NULLTAG;
+
+			if (POM_attr_id_of_attr(propNamesToValidate[indexPropNames].szPropertyNameOld.c_str(), szAuditClassName.c_str(), &tAttrId) != ITK_ok
+				|| tAttrId == NULLTAG)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	* Where clause of the pushdown mode: the audit record is joined with its object and at least one property has to differ.
+	* Per property: (old <> current) OR (old IS NULL AND current IS NOT NULL) OR (old IS NOT NULL AND current IS NULL),
+	* the OR of all properties is ANDed to szWhereExprId. Without filter when a string or long string property is listed.
+	* Returns the id of the resulting expression.
+	*/
+	std::string addPushdownDiffExpr(il9::utils::AuditLog::AuditEnquiry &auditLogsQuery, const std::string &szWhereExprId, const std::string &szAuditClassName,
+		const std::string &szObjectClassName, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		auditLogsQuery.setJoinExpr("objectJoinExpr", szAuditClassName, OBJECT_TAG, POM_enquiry_equal, szObjectClassName, ATTR_PUID);
+		auditLogsQuery.setExpr("joinedWhereExpr", szWhereExprId, POM_enquiry_and, "objectJoinExpr");
+
+		//long string values are not columns of either table and strings would be compared on the collation of the database
+		//(case or trailing blanks may be ignored), a row has to be returned for them to be compared in memory
+		bool hasInMemoryProperty = false;
+		std::string szAnyDiffExprId;
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropNames];
+
+			if (propertyInput.iType == POM_long_string || propertyInput.iType == POM_string)
+			{
+				hasInMemoryProperty = true;
+				continue;
+			}
+
+			std::string szSuffix = "_" + std::to_string(indexPropNames);
+
+			auditLogsQuery.setJoinExpr("notEqualExpr" + szSuffix, szAuditClassName, propertyInput.szPropertyNameOld, POM_enquiry_not_equal,
+				szObjectClassName, propertyInput.szPropertyName);
+
+			auditLogsQuery.setAttrExpr("oldNullExpr" + szSuffix, szAuditClassName, propertyInput.szPropertyNameOld, POM_enquiry_is_null, "");
+			auditLogsQuery.setAttrExpr("oldNotNullExpr" + szSuffix, szAuditClassName, propertyInput.szPropertyNameOld, POM_enquiry_is_not_null, "");
+			auditLogsQuery.setAttrExpr("currentNullExpr" + szSuffix, szObjectClassName, propertyInput.szPropertyName, POM_enquiry_is_null, "");
+			auditLogsQuery.setAttrExpr("currentNotNullExpr" + szSuffix, szObjectClassName, propertyInput.szPropertyName, POM_enquiry_is_not_null, "");
+
+			auditLogsQuery.setExpr("oldNullOnlyExpr" + szSuffix, "oldNullExpr" + szSuffix, POM_enquiry_and, "currentNotNullExpr" + szSuffix);
+			auditLogsQuery.setExpr("currentNullOnlyExpr" + szSuffix, "oldNotNullExpr" + szSuffix, POM_enquiry_and, "currentNullExpr" + szSuffix);
+			auditLogsQuery.setExpr("valueOrNullDiffExpr" + szSuffix, "notEqualExpr" + szSuffix, POM_enquiry_or, "oldNullOnlyExpr" + szSuffix);
+			auditLogsQuery.setExpr("diffExpr" + szSuffix, "valueOrNullDiffExpr" + szSuffix, POM_enquiry_or, "currentNullOnlyExpr" + szSuffix);
+
+			if (szAnyDiffExprId.empty())
+			{
+				szAnyDiffExprId = "diffExpr" + szSuffix;
+			}
+			else
+			{
+				auditLogsQuery.setExpr("anyDiffExpr" + szSuffix, szAnyDiffExprId, POM_enquiry_or, "diffExpr" + szSuffix);
+				szAnyDiffExprId = "anyDiffExpr" + szSuffix;
+			}
+		}
+
+		if (hasInMemoryProperty || szAnyDiffExprId.empty()) return "joinedWhereExpr";
+
+		auditLogsQuery.setExpr("pushdownWhereExpr", "joinedWhereExpr", POM_enquiry_and, szAnyDiffExprId);
+		return "pushdownWhereExpr";
+	}
+
+	//builds select list, where clause and order of the enquiry, tObjectTag and dtLoggedAfterDate are bound before each run
+	PreparedAuditEnquiry prepareAuditEnquiry(const std::string &szEnquiryId, il9::utils::AuditLog::AuditQueryMode queryMode, const std::string &szAuditClassName,
+		const std::string &strEventTypeName, const std::string &szObjectClassName, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		PreparedAuditEnquiry prepared;
+		prepared.enquiry.reset(new il9::utils::AuditLog::AuditEnquiry(szEnquiryId));
+
+		il9::utils::AuditLog::AuditEnquiry &auditLogsQuery = *prepared.enquiry;
+
+		//result rows are keyed by puid, DISTINCT only adds a sort/hash step on the database side
+		auditLogsQuery.setDistinct(false);
+
+		bool isPushdown = (queryMode == il9::utils::AuditLog::IL9_AUDIT_QUERY_PUSHDOWN_DIFF);
+
+		//puid, property/old property pairs and LOGGED_DATE as the last column
+		std::vector<std::string> vectorSelectAttrs;
+		vectorSelectAttrs.push_back(ATTR_PUID);
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType == POM_long_string) continue;
+
+			if (isPushdown)
+			{
+				//current value from the object, old value from the audit record; select order defines the column order
+				auditLogsQuery.addSelectAttributes(szAuditClassName, vectorSelectAttrs);
+				auditLogsQuery.addSelectAttributes(szObjectClassName, { propNamesToValidate[indexPropNames].szPropertyName });
+
+				vectorSelectAttrs.clear();
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyNameOld);
+			}
+			else
+			{
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyName);
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyNameOld);
+			}
+		}
+
+		vectorSelectAttrs.push_back(LOGGED_DATE);
+		auditLogsQuery.addSelectAttributes(szAuditClassName, vectorSelectAttrs);
+
+		auditLogsQuery.setStringValues("eventTypeValue", { strEventTypeName });
+
+		auditLogsQuery.setAttrExpr("objectTagExpr", szAuditClassName, OBJECT_TAG, POM_enquiry_equal, "objectTagValue");
+		auditLogsQuery.setAttrExpr("eventTypeExpr", szAuditClassName, EVENT_TYPE_NAME, POM_enquiry_equal, "eventTypeValue");
+		auditLogsQuery.setExpr("objectEventExpr", "objectTagExpr", POM_enquiry_and, "eventTypeExpr");
+
+		if (queryMode == il9::utils::AuditLog::IL9_AUDIT_QUERY_BASELINE_ONLY || isPushdown)
+		{
+			//sub enquiry: MIN(LOGGED_DATE) of the matching audit records
+			prepared.minLoggedDateQuery.reset(new il9::utils::AuditLog::AuditEnquiry(auditLogsQuery.createSubEnquiry(szEnquiryId + "_MinDate")));
+
+			il9::utils::AuditLog::AuditEnquiry &minLoggedDateQuery = *prepared.minLoggedDateQuery;
+
+			minLoggedDateQuery.setAttrExpr("minLoggedDateExpr", szAuditClassName, LOGGED_DATE, POM_enquiry_min, "");
+			minLoggedDateQuery.addSelectExpressions({ "minLoggedDateExpr" });
+
+			minLoggedDateQuery.setStringValues("subEventTypeValue", { strEventTypeName });
+
+			minLoggedDateQuery.setAttrExpr("subObjectTagExpr", szAuditClassName, OBJECT_TAG, POM_enquiry_equal, "subObjectTagValue");
+			minLoggedDateQuery.setAttrExpr("subEventTypeExpr", szAuditClassName, EVENT_TYPE_NAME, POM_enquiry_equal, "subEventTypeValue");
+			minLoggedDateQuery.setAttrExpr("subLoggedDateExpr", szAuditClassName, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "subLoggedDateValue");
+			minLoggedDateQuery.setExpr("subObjectEventExpr", "subObjectTagExpr", POM_enquiry_and, "subEventTypeExpr");
+			minLoggedDateQuery.setExpr("subWhereExpr", "subObjectEventExpr", POM_enquiry_and, "subLoggedDateExpr");
+			minLoggedDateQuery.setWhereExpr("subWhereExpr");
+
+			//outer enquiry: audit records of the object/event type logged exactly at MIN(LOGGED_DATE)
+			auditLogsQuery.setAttrExpr("loggedDateExpr", szAuditClassName, LOGGED_DATE, POM_enquiry_equal, minLoggedDateQuery.getId());
+
+			//Sample Query
+			//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0LoggedDate FROM PFND0GENERALAUDIT t_01
+			//WHERE ((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND (t_01.pfnd0EventTypeName = '__Modify'))
+			//AND (t_01.pfnd0LoggedDate = (SELECT MIN(t_02.pfnd0LoggedDate) FROM PFND0GENERALAUDIT t_02
+			//WHERE ((t_02.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND (t_02.pfnd0EventTypeName = '__Modify'))
+			//AND (t_02.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120))));
+		}
+		else
+		{
+			auditLogsQuery.setAttrExpr("loggedDateExpr", szAuditClassName, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "loggedDateValue");
+			auditLogsQuery.addOrderAttribute(szAuditClassName, LOGGED_DATE, POM_enquiry_desc_order);
+
+			//Sample Query
+			//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, t_01.pil9_batch_class,
+			//t_01.pil9_batch_classOvl, ..., t_01.pfnd0LoggedDate FROM PFND0GENERALAUDIT t_01 WHERE
+			//(((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND(t_01.pfnd0EventTypeName = '__Modify'))
+			//AND((t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120))
+			//)) ORDER BY t_01.pfnd0LoggedDate DESC;
+		}
+
+		auditLogsQuery.setExpr("whereExpr", "objectEventExpr", POM_enquiry_and, "loggedDateExpr");
+
+		if (isPushdown)
+		{
+			auditLogsQuery.setWhereExpr(addPushdownDiffExpr(auditLogsQuery, "whereExpr", szAuditClassName, szObjectClassName, propNamesToValidate));
+
+			//Sample Query
+			//SELECT t_01.puid, t_02.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0LoggedDate
+			//FROM PFND0GENERALAUDIT t_01, PIL9_MATERIALREVISION t_02
+			//WHERE ((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND (t_01.pfnd0EventTypeName = '__Modify'))
+			//AND (t_01.pfnd0LoggedDate = (SELECT MIN(t_03.pfnd0LoggedDate) FROM PFND0GENERALAUDIT t_03 WHERE ...))
+			//AND (t_01.pfnd0Object = t_02.puid)
+			//AND (((t_01.pil9_stocking_typeOvl <> t_02.pil9_stocking_type) OR (t_01.pil9_stocking_typeOvl IS NULL AND t_02.pil9_stocking_type IS NOT NULL)
+			//OR (t_01.pil9_stocking_typeOvl IS NOT NULL AND t_02.pil9_stocking_type IS NULL)) OR ...);
+		}
+		else
+		{
+			auditLogsQuery.setWhereExpr("whereExpr");
+		}
+
+		return prepared;
+	}
+
+	//full history enquiry for a set of event types, EVENT_TYPE_NAME is selected between the property pairs and LOGGED_DATE
+	PreparedAuditEnquiry prepareMultiEventAuditEnquiry(const std::string &szEnquiryId, const std::vector<std::string> &vectorEventTypeNames,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, il9::utils::AuditLog::AuditQueryMode queryMode)
+	{
+		PreparedAuditEnquiry prepared;
+		prepared.enquiry.reset(new il9::utils::AuditLog::AuditEnquiry(szEnquiryId));
+
+		il9::utils::AuditLog::AuditEnquiry &auditLogsQuery = *prepared.enquiry;
+		auditLogsQuery.setDistinct(false);
+
+		std::vector<std::string> vectorSelectAttrs;
+		vectorSelectAttrs.push_back(ATTR_PUID);
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType != POM_long_string)
+			{
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyName);
+				vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyNameOld);
+			}
+		}
+
+		vectorSelectAttrs.push_back(EVENT_TYPE_NAME);
+		vectorSelectAttrs.push_back(LOGGED_DATE);
+		auditLogsQuery.addSelectAttributes(IL9_TYPE_FND0GENERALAUDIT, vectorSelectAttrs);
+
+		auditLogsQuery.setAttrExpr("objectTagExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_equal, "objectTagValue");
+		auditLogsQuery.addOrderAttribute(IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_desc_order);
+
+		if (queryMode != il9::utils::AuditLog::IL9_AUDIT_QUERY_FULL_HISTORY)
+		{
+			//one MIN(LOGGED_DATE) sub enquiry per event type, the rows of an event type are kept only at its own minimum
+			std::string szEventsExprId;
+
+			for (size_t indexEventType = 0; indexEventType < vectorEventTypeNames.size(); indexEventType++)
+			{
+				std::string szSuffix = "_" + std::to_string(indexEventType);
+
+				prepared.eventMinLoggedDateQueries.emplace_back(new il9::utils::AuditLog::AuditEnquiry(auditLogsQuery.createSubEnquiry(szEnquiryId + "_MinDate" + szSuffix)));
+
+				il9::utils::AuditLog::AuditEnquiry &minLoggedDateQuery = *prepared.eventMinLoggedDateQueries.back();
+
+				minLoggedDateQuery.setAttrExpr("minLoggedDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_min, "");
+				minLoggedDateQuery.addSelectExpressions({ "minLoggedDateExpr" });
+
+				minLoggedDateQuery.setStringValues("subEventTypeValue", { vectorEventTypeNames[indexEventType] });
+
+				minLoggedDateQuery.setAttrExpr("subObjectTagExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_equal, "subObjectTagValue");
+				minLoggedDateQuery.setAttrExpr("subEventTypeExpr", IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_equal, "subEventTypeValue");
+				minLoggedDateQuery.setAttrExpr("subLoggedDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "subLoggedDateValue");
+				minLoggedDateQuery.setExpr("subObjectEventExpr", "subObjectTagExpr", POM_enquiry_and, "subEventTypeExpr");
+				minLoggedDateQuery.setExpr("subWhereExpr", "subObjectEventExpr", POM_enquiry_and, "subLoggedDateExpr");
+				minLoggedDateQuery.setWhereExpr("subWhereExpr");
+
+				auditLogsQuery.setStringValues("eventTypeValue" + szSuffix, { vectorEventTypeNames[indexEventType] });
+
+				auditLogsQuery.setAttrExpr("eventTypeExpr" + szSuffix, IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_equal, "eventTypeValue" + szSuffix);
+				auditLogsQuery.setAttrExpr("loggedDateExpr" + szSuffix, IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_equal, minLoggedDateQuery.getId());
+				auditLogsQuery.setExpr("eventBaselineExpr" + szSuffix, "eventTypeExpr" + szSuffix, POM_enquiry_and, "loggedDateExpr" + szSuffix);
+
+				if (szEventsExprId.empty())
+				{
+					szEventsExprId = "eventBaselineExpr" + szSuffix;
+				}
+				else
+				{
+					auditLogsQuery.setExpr("eventsExpr" + szSuffix, szEventsExprId, POM_enquiry_or, "eventBaselineExpr" + szSuffix);
+					szEventsExprId = "eventsExpr" + szSuffix;
+				}
+			}
+
+			auditLogsQuery.setExpr("whereExpr", "objectTagExpr", POM_enquiry_and, szEventsExprId);
+			auditLogsQuery.setWhereExpr("whereExpr");
+
+			//Sample Query
+			//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0EventTypeName, t_01.pfnd0LoggedDate
+			//FROM PFND0GENERALAUDIT t_01 WHERE (t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA')
+			//AND (((t_01.pfnd0EventTypeName = '__Create') AND (t_01.pfnd0LoggedDate = (SELECT MIN(t_02.pfnd0LoggedDate) FROM PFND0GENERALAUDIT t_02
+			//WHERE ((t_02.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND (t_02.pfnd0EventTypeName = '__Create'))
+			//AND (t_02.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120)))))
+			//OR ((t_01.pfnd0EventTypeName = '__Modify') AND (t_01.pfnd0LoggedDate = (SELECT MIN(t_03.pfnd0LoggedDate) FROM PFND0GENERALAUDIT t_03 WHERE ...))))
+			//ORDER BY t_01.pfnd0LoggedDate DESC;
+
+			return prepared;
+		}
+
+		auditLogsQuery.setStringValues("eventTypeValue", vectorEventTypeNames);
+
+		auditLogsQuery.setAttrExpr("eventTypeExpr", IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_in, "eventTypeValue");
+		auditLogsQuery.setExpr("objectEventExpr", "objectTagExpr", POM_enquiry_and, "eventTypeExpr");
+
+		auditLogsQuery.setAttrExpr("loggedDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "loggedDateValue");
+
+		auditLogsQuery.setExpr("whereExpr", "objectEventExpr", POM_enquiry_and, "loggedDateExpr");
+		auditLogsQuery.setWhereExpr("whereExpr");
+
+		//Sample Query
+		//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0EventTypeName, t_01.pfnd0LoggedDate
+		//FROM PFND0GENERALAUDIT t_01 WHERE (((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA')
+		//AND (t_01.pfnd0EventTypeName IN ('__Create', '__Modify'))) AND (t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120)))
+		//ORDER BY t_01.pfnd0LoggedDate DESC;
+
+		return prepared;
+	}
+
+	void bindAuditEnquiry(PreparedAuditEnquiry &prepared, tag_t tObjectTag, date_t dtLoggedAfterDate)
+	{
+		prepared.enquiry->setTagValues("objectTagValue", { tObjectTag });
+
+		if (prepared.minLoggedDateQuery)
+		{
+			prepared.minLoggedDateQuery->setTagValues("subObjectTagValue", { tObjectTag });
+			prepared.minLoggedDateQuery->setDateValues("subLoggedDateValue", { dtLoggedAfterDate });
+		}
+		else if (!prepared.eventMinLoggedDateQueries.empty())
+		{
+			for (size_t indexEventType = 0; indexEventType < prepared.eventMinLoggedDateQueries.size(); indexEventType++)
+			{
+				prepared.eventMinLoggedDateQueries[indexEventType]->setTagValues("subObjectTagValue", { tObjectTag });
+				prepared.eventMinLoggedDateQueries[indexEventType]->setDateValues("subLoggedDateValue", { dtLoggedAfterDate });
+			}
+		}
+		else
+		{
+			prepared.enquiry->setDateValues("loggedDateValue", { dtLoggedAfterDate });
+		}
+	}
+
+	//reads current values from the baseline row of the pushdown enquiry, pushdownRow is NULL after a fallback to the baseline enquiry
+	class PushdownBaselineVisitor : public il9::utils::AuditLog::AuditBaselineVisitor
+	{
+	public:
+		PushdownBaselineVisitor(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, void **pushdownRow,
+			const std::vector<int> &vectorPropertyCols, const il9::utils::AuditLog::PropertyValueSnapshot &currentValues,
+			il9::utils::AuditLog::AuditValueArena &arena, std::vector< il9::utils::AuditLog::CompactPropertyInfo > &modifiedProperties)
+			: m_propNamesToValidate(propNamesToValidate), m_pushdownRow(pushdownRow), m_vectorPropertyCols(vectorPropertyCols), m_currentValues(currentValues),
+			m_arena(arena), m_modifiedProperties(modifiedProperties)
+		{
+			m_propertyInfo.objectTag = tObjectTag;
+		}
+
+		const il9::utils::AuditLog::SnapshotValue *currentValueOf(size_t indexPropInput) override
+		{
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = m_propNamesToValidate[indexPropInput];
+
+			if (m_pushdownRow == NULL || propertyInput.iType == POM_long_string)
+			{
+				return m_currentValues.getValue(m_propertyInfo.objectTag, propertyInput.szPropertyName);
+			}
+
+			//the database filter treats NULL and default values as different, the comparator has the final say
+			il9::utils::AuditLog::il9_readSnapshotValue(propertyInput.iType, m_pushdownRow[m_vectorPropertyCols[indexPropInput]], m_rowValue);
+			return &m_rowValue;
+		}
+
+		void onModifiedProperty(size_t indexPropInput, const il9::utils::AuditLog::AuditValue &currentValue,
+			const il9::utils::AuditLog::AuditValue &oldValue) override
+		{
+			m_propertyInfo.szPropertyName = m_arena.copy(m_propNamesToValidate[indexPropInput].szPropertyName);
+			m_propertyInfo.currentValue = currentValue;
+			m_propertyInfo.oldValue = oldValue;
+
+			m_modifiedProperties.push_back(m_propertyInfo);
+		}
+
+	private:
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &m_propNamesToValidate;
+		void **m_pushdownRow;
+		const std::vector<int> &m_vectorPropertyCols;
+		const il9::utils::AuditLog::PropertyValueSnapshot &m_currentValues;
+		il9::utils::AuditLog::AuditValueArena &m_arena;
+		std::vector< il9::utils::AuditLog::CompactPropertyInfo > &m_modifiedProperties;
+		il9::utils::AuditLog::CompactPropertyInfo m_propertyInfo;
+		il9::utils::AuditLog::SnapshotValue m_rowValue;
+	};
+}
+
+void il9::utils::AuditLog::il9_getAuditEnquiryCacheStatistics(il9::utils::AuditLog::AuditEnquiryCacheStatistics &statistics)
+{
+	AuditEnquiryCache::instance().statistics(statistics);
+}
+
+void il9::utils::AuditLog::il9_clearAuditEnquiryCache()
+{
+	AuditEnquiryCache::instance().clear();
+}
+
+int il9::utils::AuditLog::il9_prepareAndExecuteQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditQueryMode queryMode,
+	int &nRows, int &nCols, void**** result)
+{
+	return il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, queryMode, IL9_TYPE_FND0GENERALAUDIT,
+		nRows, nCols, result);
+}
+
+int il9::utils::AuditLog::il9_prepareAndExecuteQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditQueryMode queryMode,
+	const std::string &szAuditClassName, int &nRows, int &nCols, void**** result)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput(tObjectTag);
+	journalling.setInput(dtLoggedAfterDate);
+	journalling.setInput(strEventTypeName);
+	journalling.setInput((int)queryMode);
+	journalling.setInput(szAuditClassName);
+
+	for (int indexPropNames = 0; journalling.isEnabled() && indexPropNames < propNamesToValidate.size(); indexPropNames++)
+	{
+		journalling.setInput(propNamesToValidate[indexPropNames].szPropertyName);
+		journalling.setInput(propNamesToValidate[indexPropNames].szPropertyNameOld);
+		journalling.setInput(propNamesToValidate[indexPropNames].iType);
+	}
+
+	journalling.journalRoutineCall();
+
+	std::string szSignature;
+	std::string szObjectClassName;
+
+	try
+	{
+		//input validations
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, tObjectTag, "tObjectTag");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, dtLoggedAfterDate, "dtLoggedAfterDate");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, strEventTypeName, "eventTypeName");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, szAuditClassName, "szAuditClassName");
+
+		for (int indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].szPropertyName, "szPropertyName");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].szPropertyNameOld, "szPropertyNameOld");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].iType, "iType");
+		}
+
+		//the pushdown enquiry joins the class of the object, enquiries are prepared per class
+		if (queryMode == IL9_AUDIT_QUERY_PUSHDOWN_DIFF)
+		{
+			tag_t tClassId = NULLTAG;
+			scoped_smptr<char> spClassName;
+
+			status = POM_class_of_instance(tObjectTag, &tClassId);
+			status = POM_name_of_class(tClassId, &spClassName);
+			il9::utils::AuditLog::il9_traceAuditClass(tObjectTag, spClassName.get());
+
+			szObjectClassName = spClassName.getString();
+		}
+
+		AuditEnquiryCache &cache = AuditEnquiryCache::instance();
+		szSignature = buildAuditEnquirySignature(queryMode, szAuditClassName, strEventTypeName, szObjectClassName, propNamesToValidate);
+
+		//the error was logged when the signature failed, callers fall back without running it again
+		iFail = cache.failureOf(szSignature);
+		if (iFail != ITK_ok) return iFail;
+
+		PreparedAuditEnquiry *prepared = cache.find(szSignature);
+
+		if (prepared == NULL)
+		{
+			prepared = &cache.insert(szSignature, prepareAuditEnquiry(cache.nextEnquiryId(), queryMode, szAuditClassName, strEventTypeName, szObjectClassName,
+				propNamesToValidate));
+		}
+
+		bindAuditEnquiry(*prepared, tObjectTag, dtLoggedAfterDate);
+
+		if (il9::utils::AuditLog::il9_currentAuditProfile() != NULL)
+		{
+			il9::utils::AuditLog::il9_profileAuditEnquiry(szSignature, "tObjectTag=" + getPUID(tObjectTag) + ", dtLoggedAfterDate="
+				+ il9::utils::AuditLog::il9_formatAuditDate(dtLoggedAfterDate));
+		}
+
+		//run query
+		if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n Running Query --> ");
+		prepared->enquiry->execute(nRows, nCols, result);
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+
+		//the join fails for every object of the class when a property is not an attribute of the class, other errors only for this call
+		if (queryMode == IL9_AUDIT_QUERY_PUSHDOWN_DIFF && !szSignature.empty()
+			&& !isPushdownSupportedBySchema(szAuditClassName, szObjectClassName, propNamesToValidate))
+		{
+			AuditEnquiryCache::instance().markFailed(szSignature, iFail);
+		}
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfoPushdown(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditValueArena &arena,
+	std::vector< il9::utils::AuditLog::CompactPropertyInfo > &modifiedProperties)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		int nRows = 0;
+		int nCols = 0;
+		scoped_smptr<void**> spPushdownResult;
+		scoped_smptr<void**> spBaselineResult;
+
+		bool isPushdown = true;
+
+		if (il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, IL9_AUDIT_QUERY_PUSHDOWN_DIFF,
+			nRows, nCols, &spPushdownResult) != ITK_ok)
+		{
+			if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n Pushdown enquiry failed, comparing the baseline in memory");
+
+			isPushdown = false;
+			nRows = 0;
+			nCols = 0;
+
+			status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, IL9_AUDIT_QUERY_BASELINE_ONLY,
+				nRows, nCols, &spBaselineResult);
+		}
+
+		void*** result = isPushdown ? spPushdownResult.get() : spBaselineResult.get();
+
+		size_t numOfModifiedPropertiesBefore = modifiedProperties.size();
+
+		if (nRows > 0 && nCols > 1)
+		{
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+			int baselineRow = nRows - 1;
+
+			//current values come with the row in pushdown mode, long string values (and all values after a fallback) are loaded separately
+			std::vector< il9::utils::AuditLog::ValidatePropertyInput > vectorSnapshotInputs;
+
+			for (int indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+			{
+				if (!isPushdown || propNamesToValidate[indexPropInput].iType == POM_long_string) vectorSnapshotInputs.push_back(propNamesToValidate[indexPropInput]);
+			}
+
+			il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+			if (!vectorSnapshotInputs.empty()) status = currentValues.load({ tObjectTag }, vectorSnapshotInputs);
+
+			std::vector<int> vectorPropertyCols;
+			il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+
+			PushdownBaselineVisitor visitor(tObjectTag, propNamesToValidate, isPushdown ? result[baselineRow] : NULL, vectorPropertyCols, currentValues,
+				arena, modifiedProperties);
+
+			il9::utils::AuditLog::il9_visitAuditBaseline(result, baselineRow, vectorPropertyCols, propNamesToValidate, arena, visitor);
+		}
+
+		//journalling
+		journalling.setOutput("isPushdown", (int)isPushdown);
+		journalling.setOutput("numOfModifiedProperties", (int)(modifiedProperties.size() - numOfModifiedPropertiesBefore));
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::il9_prepareAndExecuteMultiEventQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::vector<std::string> &eventTypeNames,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditQueryMode queryMode, int &nRows, int &nCols,
+	void**** result)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput(tObjectTag);
+	journalling.setInput(dtLoggedAfterDate);
+	journalling.setInput((int)queryMode);
+
+	for (size_t indexEventType = 0; journalling.isEnabled() && indexEventType < eventTypeNames.size(); indexEventType++)
+	{
+		journalling.setInput(eventTypeNames[indexEventType]);
+	}
+
+	journalling.journalRoutineCall();
+
+	try
+	{
+		//input validations
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, tObjectTag, "tObjectTag");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, dtLoggedAfterDate, "dtLoggedAfterDate");
+
+		for (size_t indexEventType = 0; indexEventType < eventTypeNames.size(); indexEventType++)
+		{
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, eventTypeNames[indexEventType], "eventTypeName");
+		}
+
+		for (int indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].szPropertyName, "szPropertyName");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].szPropertyNameOld, "szPropertyNameOld");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, propNamesToValidate[indexPropNames].iType, "iType");
+		}
+
+		//the same set in any order or with duplicates shares one prepared enquiry
+		std::vector<std::string> vectorEventTypeNames(eventTypeNames);
+		std::sort(vectorEventTypeNames.begin(), vectorEventTypeNames.end());
+		vectorEventTypeNames.erase(std::unique(vectorEventTypeNames.begin(), vectorEventTypeNames.end()), vectorEventTypeNames.end());
+
+		if (vectorEventTypeNames.empty())
+		{
+			nRows = 0;
+			nCols = 0;
+			*result = NULL;
+
+			return iFail;
+		}
+
+		std::string szEventTypeNames;
+
+		for (size_t indexEventType = 0; indexEventType < vectorEventTypeNames.size(); indexEventType++)
+		{
+			szEventTypeNames.append(indexEventType > 0 ? "," : "").append(vectorEventTypeNames[indexEventType]);
+		}
+
+		AuditEnquiryCache &cache = AuditEnquiryCache::instance();
+		//pushdown is not offered for several event types, it reads the baselines
+		if (queryMode == IL9_AUDIT_QUERY_PUSHDOWN_DIFF) queryMode = IL9_AUDIT_QUERY_BASELINE_ONLY;
+
+		std::string szSignature = "events|" + buildAuditEnquirySignature(queryMode, IL9_TYPE_FND0GENERALAUDIT, szEventTypeNames, "",
+			propNamesToValidate);
+
+		PreparedAuditEnquiry *prepared = cache.find(szSignature);
+
+		if (prepared == NULL)
+		{
+			prepared = &cache.insert(szSignature, prepareMultiEventAuditEnquiry(cache.nextEnquiryId(), vectorEventTypeNames, propNamesToValidate, queryMode));
+		}
+
+		bindAuditEnquiry(*prepared, tObjectTag, dtLoggedAfterDate);
+
+		if (il9::utils::AuditLog::il9_currentAuditProfile() != NULL)
+		{
+			il9::utils::AuditLog::il9_profileAuditEnquiry(szSignature, "tObjectTag=" + getPUID(tObjectTag) + ", dtLoggedAfterDate="
+				+ il9::utils::AuditLog::il9_formatAuditDate(dtLoggedAfterDate));
+		}
+
+		//run query
+		if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n Running Multi Event Type Query --> ");
+		prepared->enquiry->execute(nRows, nCols, result);
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfoByEventType(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::vector<std::string> &eventTypeNames,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate,
+	std::map< std::string, std::vector< il9::utils::AuditLog::PropertyInfo > > &modifiedPropertiesByEventType)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		int nRows = 0;
+		int nCols = 0;
+		scoped_smptr<void**> spResult;
+
+		//only the oldest record of each event type is read
+		status = il9_prepareAndExecuteMultiEventQuery(tObjectTag, dtLoggedAfterDate, eventTypeNames, propNamesToValidate, IL9_AUDIT_QUERY_BASELINE_ONLY,
+			nRows, nCols, &spResult);
+
+		void*** result = spResult.get();
+
+		if (nRows > 0 && nCols > 2)
+		{
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+			//event type column precedes LOGGED_DATE, rows are ordered newest first so the last row of each event type is its baseline
+			//(several rows of an event type only when its oldest records were logged in the same second)
+			int eventTypeColIndex = nCols - 2;
+
+			std::map<std::string, int> hmBaselineRowByEventType;
+
+			for (int row_index = 0; row_index < nRows; row_index++)
+			{
+				if (result[row_index][eventTypeColIndex] == NULL) continue;
+
+				hmBaselineRowByEventType[(const char *)result[row_index][eventTypeColIndex]] = row_index;
+			}
+
+			//current values are the same for every event type, load them once
+			il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+			status = currentValues.load({ tObjectTag }, propNamesToValidate);
+
+			for (std::map<std::string, int>::const_iterator itBaselineRow = hmBaselineRowByEventType.begin(); itBaselineRow != hmBaselineRowByEventType.end(); itBaselineRow++)
+			{
+				tag_t auditObjectTag = *((tag_t *)result[itBaselineRow->second][0]);
+
+				int numOfModifiedProperties = 0;
+				std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+				std::unordered_set<std::string> hsModifiedPropertyNames;
+
+				//the property pairs end before the event type column, same offsets and rules as the single event type query
+				il9_validateNonLongStringPropertyValues(tObjectTag, itBaselineRow->second, nCols, propNamesToValidate, result,
+					numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+				il9_validateLongStringPropertyValues(tObjectTag, auditObjectTag, propNamesToValidate,
+					numOfModifiedProperties, hsModifiedPropertyNames, modifiedProperties, &currentValues);
+
+				if (numOfModifiedProperties > 0) modifiedPropertiesByEventType[itBaselineRow->first].swap(modifiedProperties);
+			}
+
+			//journalling
+			journalling.setOutput("numOfEventTypes", (int)hmBaselineRowByEventType.size());
+			journalling.journalRoutineCall();
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
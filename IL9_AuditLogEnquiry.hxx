@@ -0,0 +1,226 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogEnquiry.hxx
+* Description:  This file contains declarations of the POM enquiry helpers used to
+*				query Fnd0GeneralAudit records
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGENQUIRY_HXX
+#define IL9_AUDITLOGENQUIRY_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogValue.hxx"
+
+#include <pom/enq/enq.h>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			enum AuditQueryMode
+			{
+				IL9_AUDIT_QUERY_FULL_HISTORY = 0,	//every audit record logged since the given date, newest first
+				IL9_AUDIT_QUERY_BASELINE_ONLY = 1,	//only the oldest audit record logged since the given date
+				IL9_AUDIT_QUERY_PUSHDOWN_DIFF = 2	//oldest audit record joined with the object, only when a property differs
+			};
+
+			/**
+			* Thin wrapper over the POM enquiry ITK for audit queries which need more than IL9SimplePOMEnquiry offers
+			* (sub enquiries, aggregate expressions, control over DISTINCT). The enquiry is deleted when the owning
+			* object goes out of scope. All calls throw IFail on error.
+			*
+			* While an audit trace is recorded or replayed (see IL9_AuditLogTrace.hxx) the select list, where clause and bind
+			* values are kept to key the result; executions are served from the trace during a replay.
+			*/
+			class AuditEnquiry
+			{
+			public:
+				explicit AuditEnquiry(const std::string &szEnquiryId);
+				~AuditEnquiry();
+
+				AuditEnquiry(const AuditEnquiry &) = delete;
+				AuditEnquiry &operator=(const AuditEnquiry &) = delete;
+
+				const std::string &getId() const { return m_szEnquiryId; }
+
+				//creates a sub enquiry of this enquiry, the returned object does not own the sub enquiry
+				AuditEnquiry createSubEnquiry(const std::string &szSubEnquiryId);
+
+				void setDistinct(bool bDistinct);
+				void addSelectAttributes(const std::string &szClassName, const std::vector<std::string> &vectorAttrs);
+				void addSelectExpressions(const std::vector<std::string> &vectorExprIds);
+
+				void setTagValues(const std::string &szValueId, const std::vector<tag_t> &vectorValues);
+				void setStringValues(const std::string &szValueId, const std::vector<std::string> &vectorValues);
+				void setDateValues(const std::string &szValueId, const std::vector<date_t> &vectorValues);
+
+				void setAttrExpr(const std::string &szExprId, const std::string &szClassName, const std::string &szAttrName, int iOperator, const std::string &szValueId);
+				void setJoinExpr(const std::string &szExprId, const std::string &szClassName, const std::string &szAttrName, int iOperator,
+					const std::string &szOtherClassName, const std::string &szOtherAttrName);
+				void setExpr(const std::string &szExprId, const std::string &szLeftExprId, int iOperator, const std::string &szRightExprId);
+				void setWhereExpr(const std::string &szExprId);
+				void addOrderAttribute(const std::string &szClassName, const std::string &szAttrName, int iOrder);
+
+				void execute(int &nRows, int &nCols, void**** result);
+
+			private:
+				AuditEnquiry(const std::string &szEnquiryId, bool bOwner, const std::shared_ptr< std::map<std::string, std::string> > &traceBindValues);
+
+				//select list, where clause and bind values of the enquiry and its sub enquiries
+				std::string traceKey() const;
+
+				std::string m_szEnquiryId;
+				bool m_bOwner;
+
+				//only kept while an audit trace is enabled
+				std::vector< std::pair<std::string, std::string> > m_vectorTraceSelectAttrs;
+				std::string m_szTraceWhereExprId;
+				std::shared_ptr< std::map<std::string, std::string> > m_traceBindValues;	//shared with the sub enquiries
+			};
+
+			//width of the first LOGGED_DATE window tried by AuditLoggedDateWindowPager, one day
+			const long long IL9_AUDIT_INITIAL_WINDOW_SECONDS = 86400;
+
+			/**
+			* Pages a scan of audit records in LOGGED_DATE order with half open windows [start, end) holding at most a page
+			* of records. POM enquiries have no row limit, so the page is bounded by the window instead: MIN(LOGGED_DATE) of
+			* the remaining records starts the next window, which skips gaps of any length, and a COUNT enquiry narrows the
+			* window until it holds no more than iPageSize records. The width is kept for the next window and doubled after a
+			* window which filled less than half a page. A window is never narrower than one second, records logged in the same
+			* second are always read together even when there are more of them than a page.
+			*
+			* The filter builder adds the conditions of the scan (the continuation after the last record read included) to an
+			* enquiry and returns the id of their expression; it is called for every enquiry the pager runs.
+			*/
+			class AuditLoggedDateWindowPager
+			{
+			public:
+				typedef std::function<std::string(AuditEnquiry &enquiry)> FilterBuilder;
+
+				AuditLoggedDateWindowPager(const std::string &szEnquiryId, const std::string &szAuditClassName, const FilterBuilder &filterBuilder, int iPageSize);
+
+				//looks up the oldest record matching the filter, false when there is none left
+				bool findStart();
+
+				//window starting at the record found by findStart, sized to at most a page of records where possible
+				void nextWindow(date_t &dtWindowStart, date_t &dtWindowEnd);
+
+				//adds LOGGED_DATE >= dtWindowStart AND LOGGED_DATE < dtWindowEnd to the filter expression, returns the id of the combined expression
+				std::string addWindowExpr(AuditEnquiry &enquiry, const std::string &szFilterExprId, date_t dtWindowStart, date_t dtWindowEnd) const;
+
+			private:
+				int countRecords(date_t dtWindowStart, date_t dtWindowEnd);
+
+				std::string m_szEnquiryId;
+				std::string m_szAuditClassName;
+				FilterBuilder m_filterBuilder;
+				int m_iPageSize;
+
+				date_t m_dtStart;
+				long long m_windowSeconds;
+			};
+
+			//maximum number of prepared audit enquiries kept per session, least recently used ones are deleted first
+			const int IL9_AUDIT_ENQUIRY_CACHE_SIZE = 64;
+
+			struct AuditEnquiryCacheStatistics
+			{
+				long hits = 0;		//executions which only rebound the object tag and date
+				long misses = 0;		//executions which had to prepare a new enquiry
+				long evictions = 0;	//prepared enquiries deleted to stay within IL9_AUDIT_ENQUIRY_CACHE_SIZE
+				int size = 0;		//prepared enquiries currently cached
+				long skipped = 0;	//executions not run because the pushdown enquiry of their signature failed before
+				int failed = 0;		//signatures whose pushdown enquiry the schema does not allow, kept until il9_clearAuditEnquiryCache
+			};
+
+			void il9_getAuditEnquiryCacheStatistics(AuditEnquiryCacheStatistics &statistics);
+
+			//deletes all prepared enquiries of the session and resets the statistics
+			void il9_clearAuditEnquiryCache();
+
+			/**
+			* Runs the audit enquiry for an object in the requested mode.
+			*
+			* IL9_AUDIT_QUERY_FULL_HISTORY returns every matching audit record ordered by LOGGED_DATE DESC (same as
+			* il9_prepareAndExecuteQuery). IL9_AUDIT_QUERY_BASELINE_ONLY restricts the result to the earliest audit record
+			* logged since dtLoggedAfterDate using a MIN(LOGGED_DATE) sub enquiry, without DISTINCT.
+			*
+			* IL9_AUDIT_QUERY_PUSHDOWN_DIFF selects the same baseline record joined with the live object on fnd0Object = puid
+			* and evaluates the old/current inequality of every property in the database:
+			*	(old <> current) OR (old IS NULL AND current IS NOT NULL) OR (old IS NOT NULL AND current IS NULL)
+			* No row is returned when no property differs. The "property" column of every pair holds the current value read
+			* from the object class instead of the audit record, so a row is evaluated without AOM calls. When the list has
+			* string properties (compared on the collation of the database) or long string properties (not comparable in SQL)
+			* the baseline row is returned whether or not a property differs. The filter is null safe and treats NULL and
+			* default values as different, callers make the final decision with the column comparators
+			* (see il9_getModifiedPropertiesInfoPushdown). A signature whose pushdown enquiry fails because a property is not an
+			* attribute of the object or audit class is logged once and returns the same error without running on later calls
+			* of the session; other errors (lock, timeout) fail the call only.
+			*
+			* In all modes the result columns are puid, property/old property pairs of non long string properties and LOGGED_DATE,
+			* so callers can keep reading the baseline from result[nRows - 1].
+			*
+			* Enquiries are prepared once per session for each (mode, audit class, event type, ordered property list) signature
+			* and kept in a cache; later calls with the same signature only rebind tObjectTag and dtLoggedAfterDate before running.
+			*/
+			int il9_prepareAndExecuteQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditQueryMode queryMode, int &nRows, int &nCols, void**** result);
+
+			//same as above for the audit records of szAuditClassName instead of Fnd0GeneralAudit, e.g. a custom subclass
+			int il9_prepareAndExecuteQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditQueryMode queryMode, const std::string &szAuditClassName,
+				int &nRows, int &nCols, void**** result);
+
+			/**
+			* Enquiry of an object for a set of event types in one pass, ordered by LOGGED_DATE DESC. IL9_AUDIT_QUERY_FULL_HISTORY
+			* returns every record of the event types (EVENT_TYPE_NAME IN (...)); IL9_AUDIT_QUERY_BASELINE_ONLY returns only the
+			* oldest record of each event type, with one MIN(LOGGED_DATE) sub enquiry per event type, and is also used for
+			* IL9_AUDIT_QUERY_PUSHDOWN_DIFF. Result columns are puid, property/old property pairs of non long string properties,
+			* EVENT_TYPE_NAME and LOGGED_DATE, so the event type of a row is result[row][nCols - 2]. The order and duplicates
+			* of eventTypeNames do not matter, an empty list returns no rows.
+			*/
+			int il9_prepareAndExecuteMultiEventQuery(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::vector<std::string> &eventTypeNames,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditQueryMode queryMode, int &nRows, int &nCols, void**** result);
+
+			/**
+			* Multi event type version of the single object il9_getModifiedPropertiesInfo: one baseline only enquiry returns the
+			* oldest audit record of each event type, which is compared against the current values (loaded once) with the same
+			* rules as the single event type function.
+			*
+			* @param modifiedPropertiesByEventType	modified properties keyed by event type, only event types with modified properties are added
+			*/
+			int il9_getModifiedPropertiesInfoByEventType(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::vector<std::string> &eventTypeNames,
+				std::vector< ValidatePropertyInput > propNamesToValidate, std::map< std::string, std::vector< PropertyInfo > > &modifiedPropertiesByEventType);
+
+			/**
+			* Same result as the single object il9_getModifiedPropertiesInfo, evaluated with an IL9_AUDIT_QUERY_PUSHDOWN_DIFF
+			* enquiry: unmodified objects return no row and the current values of non long string properties come with the
+			* audit row instead of one AOM call (or snapshot enquiry) per object. Long string properties are compared in memory
+			* as before. If the join cannot be run for the class of the object (e.g. a property is not a persistent attribute
+			* of it) the baseline is read with IL9_AUDIT_QUERY_BASELINE_ONLY and compared against a snapshot of the object.
+			* Strings are compared in memory, case and trailing blank changes are reported whatever the collation of the database.
+			*
+			* Modified properties are appended to modifiedProperties, their values are kept in the arena.
+			*/
+			int il9_getModifiedPropertiesInfoPushdown(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditValueArena &arena, std::vector< CompactPropertyInfo > &modifiedProperties);
+		}
+	}
+}
+
+#endif
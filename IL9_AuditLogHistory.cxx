@@ -0,0 +1,293 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogHistory.cxx
+* Description:  This file contains definitions of the change history cursor of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogHistory.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogCompare.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_ArgumentValidation.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <sa/audit.h>
+#include <fclasses/tc_date.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+
+#include <memory>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	//long string values are stored comma separated on the audit record, they are kept as a list to compare them as multisets
+	il9::utils::AuditLog::AuditValue longStringValue(const char *pcValue, il9::utils::AuditLog::AuditValueArena &arena)
+	{
+		if (pcValue == NULL) return il9::utils::AuditLog::AuditValue::ofNull(POM_long_string);
+
+		std::vector<std::string_view> vectorValues;
+		il9::utils::AuditLog::il9_tokenizeStringView(std::string_view(pcValue), ',', vectorValues);
+
+		return il9::utils::AuditLog::AuditValue::ofStringList(arena.copyList(vectorValues), vectorValues.size(), ',');
+	}
+}
+
+il9::utils::AuditLog::AuditHistoryCursor::AuditHistoryCursor(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate, int iPageSize)
+	: m_tObjectTag(tObjectTag), m_dtLoggedAfterDate(dtLoggedAfterDate), m_strEventTypeName(strEventTypeName), m_propNamesToValidate(propNamesToValidate),
+	m_iPageSize(iPageSize > 0 ? iPageSize : IL9_AUDIT_DEFAULT_HISTORY_PAGE_SIZE), m_isStarted(false), m_hasPosition(false), m_hasMore(false),
+	m_vectorPropertyStates(propNamesToValidate.size())
+{
+}
+
+void il9::utils::AuditLog::AuditHistoryCursor::resumeAfter(const AuditHistoryPosition &position)
+{
+	m_position = position;
+	m_hasPosition = true;
+}
+
+std::string il9::utils::AuditLog::AuditHistoryCursor::addFilterExpr(AuditEnquiry &enquiry) const
+{
+	enquiry.setTagValues("objectTagValue", { m_tObjectTag });
+	enquiry.setStringValues("eventTypeValue", { m_strEventTypeName });
+
+	enquiry.setAttrExpr("objectTagExpr", IL9_TYPE_FND0GENERALAUDIT, OBJECT_TAG, POM_enquiry_equal, "objectTagValue");
+	enquiry.setAttrExpr("eventTypeExpr", IL9_TYPE_FND0GENERALAUDIT, EVENT_TYPE_NAME, POM_enquiry_equal, "eventTypeValue");
+	enquiry.setExpr("objectEventExpr", "objectTagExpr", POM_enquiry_and, "eventTypeExpr");
+
+	if (!m_hasPosition)
+	{
+		enquiry.setDateValues("loggedDateValue", { m_dtLoggedAfterDate });
+		enquiry.setAttrExpr("loggedDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than_or_eq, "loggedDateValue");
+		enquiry.setExpr("filterExpr", "objectEventExpr", POM_enquiry_and, "loggedDateExpr");
+
+		return "filterExpr";
+	}
+
+	//keyset continuation: (LOGGED_DATE, puid) > (position date, position puid)
+	enquiry.setDateValues("positionDateValue", { m_position.dtLoggedDate });
+	enquiry.setTagValues("positionPuidValue", { m_position.auditObjectTag });
+
+	enquiry.setAttrExpr("afterDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_greater_than, "positionDateValue");
+	enquiry.setAttrExpr("sameDateExpr", IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_equal, "positionDateValue");
+	enquiry.setAttrExpr("afterPuidExpr", IL9_TYPE_FND0GENERALAUDIT, ATTR_PUID, POM_enquiry_greater_than, "positionPuidValue");
+	enquiry.setExpr("sameDateAfterPuidExpr", "sameDateExpr", POM_enquiry_and, "afterPuidExpr");
+	enquiry.setExpr("afterPositionExpr", "afterDateExpr", POM_enquiry_or, "sameDateAfterPuidExpr");
+	enquiry.setExpr("filterExpr", "objectEventExpr", POM_enquiry_and, "afterPositionExpr");
+
+	return "filterExpr";
+}
+
+void il9::utils::AuditLog::AuditHistoryCursor::applyValue(size_t indexPropInput, tag_t auditObjectTag, date_t dtLoggedDate, const AuditValue &oldValue,
+	const AuditValue &newValue, std::vector< PropertyTransition > &transitions)
+{
+	PropertyState &state = m_vectorPropertyStates[indexPropInput];
+	int iType = m_propNamesToValidate[indexPropInput].iType;
+	bool isStringValue = (iType == POM_string || iType == POM_long_string);
+
+	//previous record's value when known, the record's own old value column for the first record
+	AuditValue previousValue = oldValue;
+
+	if (state.isKnown)
+	{
+		if (state.isNull) previousValue = AuditValue::ofNull(iType);
+		else if (isStringValue) previousValue = AuditValue::ofString(state.szValue);
+		else previousValue = state.podValue;
+	}
+
+	if (!il9_isSameAuditValue(previousValue, newValue))
+	{
+		PropertyTransition transition;
+		transition.szPropertyName = m_propNamesToValidate[indexPropInput].szPropertyName;
+		transition.oldValue = (state.isKnown && isStringValue && !state.isNull) ? AuditValue::ofString(m_arena.copy(state.szValue)) : previousValue;
+		transition.newValue = newValue;
+		transition.auditObjectTag = auditObjectTag;
+		transition.dtLoggedDate = dtLoggedDate;
+
+		transitions.push_back(transition);
+	}
+
+	state.isKnown = true;
+	state.isNull = newValue.isNull();
+
+	if (isStringValue) state.szValue = newValue.toString();
+	else state.podValue = newValue;
+}
+
+void il9::utils::AuditLog::AuditHistoryCursor::fetchPage(date_t dtWindowStart, date_t dtWindowEnd, std::vector< PropertyTransition > &transitions)
+{
+	ResultStatus status(0);
+
+	AuditEnquiry pageQuery("IL9AuditHistoryPageQuery");
+	pageQuery.setDistinct(false);
+
+	//same column layout as the audit enquiry: puid, property/old property pairs, LOGGED_DATE
+	std::vector<std::string> vectorSelectAttrs;
+	vectorSelectAttrs.push_back(ATTR_PUID);
+
+	for (size_t indexPropNames = 0; indexPropNames < m_propNamesToValidate.size(); indexPropNames++)
+	{
+		if (m_propNamesToValidate[indexPropNames].iType != POM_long_string)
+		{
+			vectorSelectAttrs.push_back(m_propNamesToValidate[indexPropNames].szPropertyName);
+			vectorSelectAttrs.push_back(m_propNamesToValidate[indexPropNames].szPropertyNameOld);
+		}
+	}
+
+	vectorSelectAttrs.push_back(LOGGED_DATE);
+	pageQuery.addSelectAttributes(IL9_TYPE_FND0GENERALAUDIT, vectorSelectAttrs);
+
+	pageQuery.setWhereExpr(m_pager->addWindowExpr(pageQuery, addFilterExpr(pageQuery), dtWindowStart, dtWindowEnd));
+
+	//puid breaks ties between records logged in the same second so that the order is stable across pages and cursors
+	pageQuery.addOrderAttribute(IL9_TYPE_FND0GENERALAUDIT, LOGGED_DATE, POM_enquiry_asc_order);
+	pageQuery.addOrderAttribute(IL9_TYPE_FND0GENERALAUDIT, ATTR_PUID, POM_enquiry_asc_order);
+
+	//Sample Query
+	//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_stocking_typeOvl, ..., t_01.pfnd0LoggedDate FROM PFND0GENERALAUDIT t_01
+	//WHERE (((t_01.pfnd0Object = 'I6U1smQOvgWMLAAAAAAAAAAAAAA') AND (t_01.pfnd0EventTypeName = '__Modify'))
+	//AND ((t_01.pfnd0LoggedDate > CONVERT(datetime, '2020-12-24 01:33:00', 120))
+	//OR ((t_01.pfnd0LoggedDate = CONVERT(datetime, '2020-12-24 01:33:00', 120)) AND (t_01.puid > 'QWT1smQOvgWMLAAAAAAAAAAAAAA'))))
+	//AND ((t_01.pfnd0LoggedDate >= CONVERT(datetime, '2020-12-24 01:33:00', 120)) AND (t_01.pfnd0LoggedDate < CONVERT(datetime, '2020-12-25 01:33:00', 120)))
+	//ORDER BY t_01.pfnd0LoggedDate ASC, t_01.puid ASC;
+
+	int nRows = 0;
+	int nCols = 0;
+	void*** result = NULL;
+
+	pageQuery.execute(nRows, nCols, &result);
+
+	try
+	{
+		for (int row_index = 0; row_index < nRows && nCols > 1; row_index++)
+		{
+			if (result[row_index][0] == NULL || result[row_index][nCols - 1] == NULL) continue;
+
+			AuditHistoryPosition key;
+			key.auditObjectTag = *((tag_t *)result[row_index][0]);
+			key.dtLoggedDate = *((date_t *)result[row_index][nCols - 1]);
+
+			m_position = key;
+			m_hasPosition = true;
+
+			int col_index = 1;
+
+			for (size_t indexPropInput = 0; indexPropInput < m_propNamesToValidate.size() && col_index < nCols - 2; indexPropInput++)
+			{
+				int iType = m_propNamesToValidate[indexPropInput].iType;
+				if (iType == POM_long_string) continue;
+
+				AuditValue newValue = il9_auditValueOfCell(iType, result[row_index][col_index], m_arena);
+				AuditValue oldValue = il9_auditValueOfCell(iType, result[row_index][col_index + 1], m_arena);
+				col_index += 2;
+
+				applyValue(indexPropInput, key.auditObjectTag, key.dtLoggedDate, oldValue, newValue, transitions);
+			}
+
+			for (size_t indexPropInput = 0; indexPropInput < m_propNamesToValidate.size(); indexPropInput++)
+			{
+				if (m_propNamesToValidate[indexPropInput].iType != POM_long_string) continue;
+
+				//long string values are not part of the enquiry result and are read from the audit record
+				scoped_smptr<char> value;
+				scoped_smptr<char> valueOld;
+
+				status = AOM_ask_value_string(key.auditObjectTag, m_propNamesToValidate[indexPropInput].szPropertyName.c_str(), &value);
+				status = AOM_ask_value_string(key.auditObjectTag, m_propNamesToValidate[indexPropInput].szPropertyNameOld.c_str(), &valueOld);
+
+				applyValue(indexPropInput, key.auditObjectTag, key.dtLoggedDate, longStringValue(valueOld.get(), m_arena), longStringValue(value.get(), m_arena),
+					transitions);
+			}
+		}
+	}
+	catch (IFail &)
+	{
+		if (result != NULL) MEM_free(result);
+		throw;
+	}
+
+	//clean up
+	if (result != NULL) MEM_free(result);
+}
+
+int il9::utils::AuditLog::AuditHistoryCursor::fetchNext(std::vector< PropertyTransition > &transitions, bool &hasMore)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("AuditHistoryCursor::fetchNext", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput(m_tObjectTag);
+	journalling.journalRoutineCall();
+
+	transitions.clear();
+	hasMore = false;
+
+	try
+	{
+		if (!m_isStarted)
+		{
+			//input validations
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, m_tObjectTag, "tObjectTag");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, m_dtLoggedAfterDate, "dtLoggedAfterDate");
+			status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, m_strEventTypeName, "eventTypeName");
+
+			m_pager.reset(new AuditLoggedDateWindowPager("IL9AuditHistoryQuery", IL9_TYPE_FND0GENERALAUDIT,
+				[this](AuditEnquiry &enquiry) { return addFilterExpr(enquiry); }, m_iPageSize));
+
+			m_hasMore = m_pager->findStart();
+			m_isStarted = true;
+		}
+
+		//values of the previous page are released, property states keep their own copy
+		m_arena.clear();
+
+		if (m_hasMore)
+		{
+			date_t dtWindowStart = NULLDATE;
+			date_t dtWindowEnd = NULLDATE;
+
+			m_pager->nextWindow(dtWindowStart, dtWindowEnd);
+			fetchPage(dtWindowStart, dtWindowEnd, transitions);
+
+			//looked up now so that hasMore is exact, the next call starts its window there
+			m_hasMore = m_pager->findStart();
+		}
+
+		hasMore = m_hasMore;
+
+		//journalling
+		journalling.setOutput("numOfTransitions", (int)transitions.size());
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
@@ -0,0 +1,119 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogHistory.hxx
+* Description:  This file contains declarations of the change history cursor of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGHISTORY_HXX
+#define IL9_AUDITLOGHISTORY_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//number of audit records read per page by AuditHistoryCursor
+			const int IL9_AUDIT_DEFAULT_HISTORY_PAGE_SIZE = 200;
+
+			//key of an audit record in the (LOGGED_DATE, puid) order of the history
+			struct AuditHistoryPosition
+			{
+				date_t dtLoggedDate = NULLDATE;
+				tag_t auditObjectTag = NULLTAG;
+			};
+
+			//one value change of a property, made by the audit record auditObjectTag
+			struct PropertyTransition
+			{
+				std::string_view szPropertyName;
+				AuditValue oldValue;
+				AuditValue newValue;
+				tag_t auditObjectTag = NULLTAG;
+				date_t dtLoggedDate = NULLDATE;
+			};
+
+			/**
+			* Streams the change history of an object page by page in (LOGGED_DATE, puid) order.
+			*
+			* Each page is one enquiry for the records after the last record read, (LOGGED_DATE, puid) > (date, puid), within a
+			* LOGGED_DATE window sized by AuditLoggedDateWindowPager to hold at most iPageSize records; only the records of the
+			* current page are held in memory. Records logged in the same second are read in one page, even when there are more
+			* of them than a page. Consecutive records are compared per property and a PropertyTransition is emitted for every
+			* value change; the first record is compared against its own old value column.
+			*
+			* Iteration can be resumed from getPosition() of an earlier cursor with resumeAfter().
+			*/
+			class AuditHistoryCursor
+			{
+			public:
+				AuditHistoryCursor(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, int iPageSize = IL9_AUDIT_DEFAULT_HISTORY_PAGE_SIZE);
+
+				AuditHistoryCursor(const AuditHistoryCursor &) = delete;
+				AuditHistoryCursor &operator=(const AuditHistoryCursor &) = delete;
+
+				//continue after the given audit record, must be called before the first fetchNext
+				void resumeAfter(const AuditHistoryPosition &position);
+
+				/**
+				* Replaces transitions with the transitions of the next page of audit records. The values reference memory
+				* of the cursor and stay valid until the next call. hasMore is false once the history is exhausted.
+				*/
+				int fetchNext(std::vector< PropertyTransition > &transitions, bool &hasMore);
+
+				//last audit record consumed by fetchNext
+				const AuditHistoryPosition &getPosition() const { return m_position; }
+
+			private:
+				//last value seen for a property, owned by the cursor across pages
+				struct PropertyState
+				{
+					bool isKnown = false;
+					bool isNull = true;
+					std::string szValue;
+					AuditValue podValue;
+				};
+
+				//conditions of the history after the current position, returns the id of the expression
+				std::string addFilterExpr(AuditEnquiry &enquiry) const;
+				void fetchPage(date_t dtWindowStart, date_t dtWindowEnd, std::vector< PropertyTransition > &transitions);
+				void applyValue(size_t indexPropInput, tag_t auditObjectTag, date_t dtLoggedDate, const AuditValue &oldValue, const AuditValue &newValue,
+					std::vector< PropertyTransition > &transitions);
+
+				tag_t m_tObjectTag;
+				date_t m_dtLoggedAfterDate;
+				std::string m_strEventTypeName;
+				std::vector< ValidatePropertyInput > m_propNamesToValidate;
+				int m_iPageSize;
+
+				bool m_isStarted;
+				bool m_hasPosition;		//false until a record is read or resumeAfter is called
+				bool m_hasMore;
+				std::unique_ptr< AuditLoggedDateWindowPager > m_pager;
+				AuditHistoryPosition m_position;
+
+				std::vector< PropertyState > m_vectorPropertyStates;
+				AuditValueArena m_arena;
+			};
+		}
+	}
+}
+
+#endif
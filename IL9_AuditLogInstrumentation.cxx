@@ -0,0 +1,50 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogInstrumentation.cxx
+* Description:  This file contains the logging and journalling hooks of the Audit Logs
+*				utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogInstrumentation.hxx"
+
+#include <cstdlib>
+#include <cstring>
+
+Teamcenter::Logging::Logger *il9::utils::AuditLog::il9_getAuditLogger()
+{
+	static Teamcenter::Logging::Logger *logger = Teamcenter::Logging::Logger::getLogger("Teamcenter.IL9.IL9common.il9.utils.AuditLog");
+	return logger;
+}
+
+#ifndef IL9_AUDITLOG_NO_INSTRUMENTATION
+
+bool il9::utils::AuditLog::il9_isAuditEntryExitEnabled()
+{
+	static const bool isEnabled = il9_getAuditLogger()->isDebugEnabled();
+	return isEnabled;
+}
+
+bool il9::utils::AuditLog::il9_isAuditJournallingEnabled()
+{
+	static const bool isEnabled = []()
+	{
+		const char *pcJournal = std::getenv("TC_JOURNAL");
+		return pcJournal != NULL && pcJournal[0] != '\0' && std::strcmp(pcJournal, "NONE") != 0;
+	}();
+
+	return isEnabled;
+}
+
+bool il9::utils::AuditLog::il9_isAuditDebugEnabled()
+{
+	static const bool isEnabled = il9_getAuditLogger()->isDebugEnabled();
+	return isEnabled;
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogInstrumentation.hxx
+* Description:  This file contains the logging and journalling hooks of the Audit Logs
+*				utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGINSTRUMENTATION_HXX
+#define IL9_AUDITLOGINSTRUMENTATION_HXX
+
+#include "IL9_LogEntryExit.hxx"
+#include "IL9_JournalLog.hxx"
+
+#include <mld/logging/Logger.hxx>
+
+#include <optional>
+
+//Define IL9_AUDITLOG_NO_INSTRUMENTATION at build time to compile entry/exit logging and journalling of the
+//Audit Logs utilities out completely. Without it the hooks are enabled or disabled once per process, see
+//il9_isAuditEntryExitEnabled and il9_isAuditJournallingEnabled.
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//logger of the Audit Logs utilities, looked up by name only once per process
+			Teamcenter::Logging::Logger *il9_getAuditLogger();
+
+#ifdef IL9_AUDITLOG_NO_INSTRUMENTATION
+			inline bool il9_isAuditEntryExitEnabled() { return false; }
+			inline bool il9_isAuditJournallingEnabled() { return false; }
+			inline bool il9_isAuditDebugEnabled() { return false; }
+#else
+			//true when the audit logger has debug enabled at the first call
+			bool il9_isAuditEntryExitEnabled();
+
+			//true when TC_JOURNAL is set (and not NONE) at the first call
+			bool il9_isAuditJournallingEnabled();
+
+			//true when the audit logger has debug enabled at the first call, guards building of debug messages
+			bool il9_isAuditDebugEnabled();
+#endif
+
+			//IL9_LogEntryExit which is only constructed when entry/exit logging is enabled
+			class AuditLogEntryExit
+			{
+			public:
+				AuditLogEntryExit(Teamcenter::Logging::Logger *logger, const char *pcFunctionName)
+				{
+					if (il9_isAuditEntryExitEnabled()) m_logEntryExit.emplace(logger, pcFunctionName);
+				}
+
+			private:
+				std::optional<IL9_LogEntryExit> m_logEntryExit;
+			};
+
+			//IL9_JournalLog which is only constructed when journalling is enabled, calls are no-ops otherwise
+			class AuditJournal
+			{
+			public:
+				AuditJournal(const char *pcFunctionName, int *piFail)
+				{
+					if (il9_isAuditJournallingEnabled()) m_journal.emplace(pcFunctionName, piFail);
+				}
+
+				bool isEnabled() const { return m_journal.has_value(); }
+
+				template <typename T>
+				void setInput(const T &value)
+				{
+					if (m_journal) m_journal->setInput(value);
+				}
+
+				template <typename T>
+				void setOutput(const char *pcName, const T &value)
+				{
+					if (m_journal) m_journal->setOutput(pcName, value);
+				}
+
+				void journalRoutineCall()
+				{
+					if (m_journal) m_journal->journalRoutineCall();
+				}
+
+			private:
+				std::optional<il9::IL9_JournalLog> m_journal;
+			};
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,278 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogMultiClass.cxx
+* Description:  This file contains definitions of the functions to fetch Audit Logs
+*				info of properties audited by several audit classes
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogMultiClass.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <sa/audit.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	//properties of one audit class and the baseline row of its enquiry
+	struct AuditClassBaseline
+	{
+		std::string szAuditClassName;
+		std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate;
+		int nRows = 0;
+		int nCols = 0;
+		void ***result = NULL;
+		std::vector<int> vectorPropertyCols;	//see il9_getAuditPropertyColumns
+		tag_t auditObjectTag = NULLTAG;
+		date_t dtLoggedDate = NULLDATE;
+		bool hasLoggedDate = false;
+
+		bool hasAuditRecord() const { return nRows > 0 && nCols > 1; }
+
+		//entry of the property in propNamesToValidate, -1 when the class does not record it
+		int indexOf(const std::string &szPropertyName) const
+		{
+			for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+			{
+				if (propNamesToValidate[indexProp].szPropertyName == szPropertyName) return (int)indexProp;
+			}
+
+			return -1;
+		}
+	};
+
+	//a baseline without LOGGED_DATE is only taken when no other class has a dated one
+	bool isEarlier(const AuditClassBaseline &baseline, const AuditClassBaseline &otherBaseline)
+	{
+		if (!baseline.hasLoggedDate || !otherBaseline.hasLoggedDate) return baseline.hasLoggedDate && !otherBaseline.hasLoggedDate;
+
+		const date_t &dtValue = baseline.dtLoggedDate;
+		const date_t &dtOtherValue = otherBaseline.dtLoggedDate;
+
+		return std::tie(dtValue.year, dtValue.month, dtValue.day, dtValue.hour, dtValue.minute, dtValue.second)
+			< std::tie(dtOtherValue.year, dtOtherValue.month, dtOtherValue.day, dtOtherValue.hour, dtOtherValue.minute, dtOtherValue.second);
+	}
+
+	void rejectConflictingProperty(const std::string &szPropertyName)
+	{
+		il9::utils::AuditLog::il9_getAuditLogger()->error("Property " + szPropertyName + " is listed with conflicting types or old value attributes");
+		throw IFail(il9::utils::AuditLog::IL9_AUDIT_CONFLICTING_PROPERTY_INPUT);
+	}
+
+	/**
+	* Groups the input per audit class in order of appearance, a property is selected once per class. A property has one
+	* type for all classes and one old value attribute per class, classes may name their old value attributes differently.
+	*/
+	void groupByAuditClass(const std::vector< il9::utils::AuditLog::AuditClassPropertyInput > &propNamesToValidate,
+		std::vector< AuditClassBaseline > &vectorBaselines)
+	{
+		std::unordered_map<std::string, int> hmPropertyTypes;
+
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			const std::string &szAuditClassName = propNamesToValidate[indexPropInput].szAuditClassName.empty() ? IL9_TYPE_FND0GENERALAUDIT
+				: propNamesToValidate[indexPropInput].szAuditClassName;
+
+			size_t indexBaseline = 0;
+			while (indexBaseline < vectorBaselines.size() && vectorBaselines[indexBaseline].szAuditClassName != szAuditClassName) indexBaseline++;
+
+			if (indexBaseline == vectorBaselines.size())
+			{
+				vectorBaselines.emplace_back();
+				vectorBaselines.back().szAuditClassName = szAuditClassName;
+			}
+
+			AuditClassBaseline &baseline = vectorBaselines[indexBaseline];
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropInput].propertyInput;
+
+			std::unordered_map<std::string, int>::const_iterator itType = hmPropertyTypes.insert(std::make_pair(propertyInput.szPropertyName, propertyInput.iType)).first;
+			if (itType->second != propertyInput.iType) rejectConflictingProperty(propertyInput.szPropertyName);
+
+			int indexProp = baseline.indexOf(propertyInput.szPropertyName);
+
+			if (indexProp < 0)
+			{
+				baseline.propNamesToValidate.push_back(propertyInput);
+			}
+			else if (baseline.propNamesToValidate[indexProp].szPropertyNameOld != propertyInput.szPropertyNameOld)
+			{
+				rejectConflictingProperty(propertyInput.szPropertyName);
+			}
+		}
+	}
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	const std::vector< il9::utils::AuditLog::AuditClassPropertyInput > &propNamesToValidate, int &numOfModifiedProperties,
+	std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(multi class)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	std::vector< AuditClassBaseline > vectorBaselines;
+
+	try
+	{
+		groupByAuditClass(propNamesToValidate, vectorBaselines);
+
+		//one baseline enquiry per audit class
+		for (size_t indexBaseline = 0; indexBaseline < vectorBaselines.size(); indexBaseline++)
+		{
+			AuditClassBaseline &baseline = vectorBaselines[indexBaseline];
+
+			status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, baseline.propNamesToValidate, IL9_AUDIT_QUERY_BASELINE_ONLY,
+				baseline.szAuditClassName, baseline.nRows, baseline.nCols, &baseline.result);
+
+			if (!baseline.hasAuditRecord()) continue;
+
+			il9::utils::AuditLog::il9_getAuditPropertyColumns(baseline.propNamesToValidate, baseline.nCols, baseline.vectorPropertyCols);
+
+			//puid is the first and LOGGED_DATE the last column
+			baseline.auditObjectTag = *((tag_t *)baseline.result[baseline.nRows - 1][0]);
+			baseline.hasLoggedDate = baseline.result[baseline.nRows - 1][baseline.nCols - 1] != NULL;
+			if (baseline.hasLoggedDate) baseline.dtLoggedDate = *((date_t *)baseline.result[baseline.nRows - 1][baseline.nCols - 1]);
+
+			if (il9::utils::AuditLog::il9_isAuditDebugEnabled())
+			{
+				logger->debug("\n   -> " + baseline.szAuditClassName + " " + getPUID(baseline.auditObjectTag));
+			}
+		}
+
+		//properties of all classes, each once, for the current values; the type is the same for all classes
+		std::vector< il9::utils::AuditLog::ValidatePropertyInput > vectorUniqueProperties;
+		std::unordered_set<std::string> hsPropertyNames;
+
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			if (hsPropertyNames.insert(propNamesToValidate[indexPropInput].propertyInput.szPropertyName).second)
+			{
+				vectorUniqueProperties.push_back(propNamesToValidate[indexPropInput].propertyInput);
+			}
+		}
+
+		bool hasAuditRecord = false;
+		for (size_t indexBaseline = 0; indexBaseline < vectorBaselines.size(); indexBaseline++) hasAuditRecord |= vectorBaselines[indexBaseline].hasAuditRecord();
+
+		if (hasAuditRecord)
+		{
+			il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+			status = currentValues.load({ tObjectTag }, vectorUniqueProperties);
+
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+			//non long string properties first, then long string properties, as the single class function reports them
+			for (int isLongStringPass = 0; isLongStringPass < 2; isLongStringPass++)
+			{
+				for (size_t indexProp = 0; indexProp < vectorUniqueProperties.size(); indexProp++)
+				{
+					const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = vectorUniqueProperties[indexProp];
+					if ((propertyInput.iType == POM_long_string) != (isLongStringPass == 1)) continue;
+
+					//baseline of the property: the oldest one among the classes recording it
+					const AuditClassBaseline *propertyBaseline = NULL;
+					int indexBaselineProp = -1;
+
+					for (size_t indexBaseline = 0; indexBaseline < vectorBaselines.size(); indexBaseline++)
+					{
+						const AuditClassBaseline &baseline = vectorBaselines[indexBaseline];
+						if (!baseline.hasAuditRecord()) continue;
+
+						int indexProp = baseline.indexOf(propertyInput.szPropertyName);
+
+						//long string values are read from the audit record, the other ones need their column in the result
+						bool isRecorded = indexProp >= 0 && (propertyInput.iType == POM_long_string || baseline.vectorPropertyCols[indexProp] > 0);
+
+						if (!isRecorded) continue;
+
+						if (propertyBaseline == NULL || isEarlier(baseline, *propertyBaseline))
+						{
+							propertyBaseline = &baseline;
+							indexBaselineProp = indexProp;
+						}
+					}
+
+					if (propertyBaseline == NULL) continue;
+
+					//old value attribute of the class the baseline comes from
+					const il9::utils::AuditLog::ValidatePropertyInput &baselineInput = propertyBaseline->propNamesToValidate[indexBaselineProp];
+
+					bool isModified = false;
+					il9::utils::AuditLog::PropertyInfo tempPropInfo;
+
+					if (propertyInput.iType == POM_long_string)
+					{
+						status = il9_checkIfLongStringPropertyModified(tObjectTag, propertyBaseline->auditObjectTag, baselineInput.szPropertyName,
+							baselineInput.szPropertyNameOld, isModified, tempPropInfo, &currentValues);
+					}
+					else
+					{
+						status = il9_checkIfPropertyModified(tObjectTag, baselineInput, propertyBaseline->result, propertyBaseline->vectorPropertyCols[indexBaselineProp],
+							propertyBaseline->nRows - 1, isModified, tempPropInfo, &currentValues);
+					}
+
+					if (isModified)
+					{
+						modifiedProperties.push_back(il9::utils::AuditLog::PropertyInfo());
+
+						modifiedProperties.back().szPropertyName = propertyInput.szPropertyName;
+						modifiedProperties.back().szCurrentValue = std::move(tempPropInfo.szCurrentValue);
+						modifiedProperties.back().szOldValue = std::move(tempPropInfo.szOldValue);
+
+						numOfModifiedProperties++;
+					}
+				}
+			}
+
+			il9::utils::AuditLog::il9_profileAuditBytes(modifiedProperties);
+		}
+
+		//journalling
+		journalling.setOutput("numOfAuditClasses", (int)vectorBaselines.size());
+		journalling.setOutput("numOfModifiedProperties", numOfModifiedProperties);
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	for (size_t indexBaseline = 0; indexBaseline < vectorBaselines.size(); indexBaseline++)
+	{
+		if (vectorBaselines[indexBaseline].result != NULL) MEM_free(vectorBaselines[indexBaseline].result);
+	}
+
+	return iFail;
+}
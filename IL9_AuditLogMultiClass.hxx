@@ -0,0 +1,65 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogMultiClass.hxx
+* Description:  This file contains declarations of the functions to fetch Audit Logs
+*				info of properties audited by several audit classes
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGMULTICLASS_HXX
+#define IL9_AUDITLOGMULTICLASS_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//error reported for a property listed with two types, or twice for an audit class with different old value attributes
+			const int IL9_AUDIT_CONFLICTING_PROPERTY_INPUT = 919008;
+
+			//property to validate together with the audit class recording it
+			struct AuditClassPropertyInput
+			{
+				std::string szAuditClassName;		//Fnd0GeneralAudit or a custom audit class, Fnd0GeneralAudit when empty
+				ValidatePropertyInput propertyInput;
+			};
+
+			/**
+			* Version of il9_getModifiedPropertiesInfo for properties recorded by different audit classes (custom
+			* Fnd0GeneralAudit subclasses or secondary audit definitions).
+			*
+			* Properties are grouped per audit class and the baseline (oldest audit record logged since dtLoggedAfterDate)
+			* of every class is read with one IL9_AUDIT_QUERY_BASELINE_ONLY enquiry, prepared and cached per class like the
+			* single class enquiry. A property listed for several classes is compared against the baseline with the oldest
+			* LOGGED_DATE among them, the earlier listed class wins a tie; each class reads the old value from its own old value
+			* attribute. A property listed with two types, or twice for a class with different old value attributes, fails the
+			* call with IL9_AUDIT_CONFLICTING_PROPERTY_INPUT. Current values are loaded once for all classes.
+			* Modified properties are reported as by il9_getModifiedPropertiesInfo: non long string properties in input
+			* order followed by long string properties, each property once.
+			*
+			* @param tObjectTag				tag of the audited object
+			* @param dtLoggedAfterDate		audit records logged on or after this date are considered
+			* @param strEventTypeName		audit event type name e.g. __Modify
+			* @param propNamesToValidate	properties to validate with their audit classes
+			* @param numOfModifiedProperties	incremented by the number of modified properties
+			* @param modifiedProperties	modified properties are appended
+			*/
+			int il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				const std::vector< AuditClassPropertyInput > &propNamesToValidate, int &numOfModifiedProperties,
+				std::vector< PropertyInfo > &modifiedProperties);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,336 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogProfiler.cxx
+* Description:  This file contains definitions of the query profiler and slow query
+*				log of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogProfiler.hxx"
+
+#include <mld/logging/Logger.hxx>
+
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+	const char *const PHASE_NAMES[il9::utils::AuditLog::IL9_AUDIT_NUM_OF_PHASES] = { "run", "decode", "compare" };
+
+	//counters of all entry points, never destroyed so that calls made from static destructors can still be recorded
+	class AuditProfileRegistry
+	{
+	public:
+		static AuditProfileRegistry &instance()
+		{
+			static AuditProfileRegistry *registry = new AuditProfileRegistry();
+			return *registry;
+		}
+
+		void record(const il9::utils::AuditLog::AuditProfileRecord &record, bool isSlow)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			il9::utils::AuditLog::AuditProfileStatistics &statistics = m_hmStatistics[record.szFunctionName];
+
+			statistics.calls++;
+			if (record.iFail != 0) statistics.failedCalls++;
+			if (isSlow) statistics.slowCalls++;
+
+			statistics.enquiries += record.enquiries;
+			statistics.rows += record.rows;
+			statistics.bytesAllocated += record.bytesAllocated;
+			statistics.total.record(record.dTotalMs);
+
+			for (int indexPhase = 0; indexPhase < il9::utils::AuditLog::IL9_AUDIT_NUM_OF_PHASES; indexPhase++)
+			{
+				statistics.phases[indexPhase].record(record.dPhaseMs[indexPhase]);
+			}
+		}
+
+		void statistics(std::map< std::string, il9::utils::AuditLog::AuditProfileStatistics > &statisticsByFunction)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			statisticsByFunction = m_hmStatistics;
+		}
+
+		void reset()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_hmStatistics.clear();
+		}
+
+	private:
+		AuditProfileRegistry() {}
+
+		std::mutex m_mutex;
+		std::map< std::string, il9::utils::AuditLog::AuditProfileStatistics > m_hmStatistics;
+	};
+
+#ifndef IL9_AUDITLOG_NO_INSTRUMENTATION
+	//outermost profiled call and innermost phase of the thread
+	thread_local il9::utils::AuditLog::AuditProfileRecord *t_currentRecord = NULL;
+	thread_local int t_iCurrentPhase = -1;
+
+	std::atomic<bool> &profilingEnabled()
+	{
+		static std::atomic<bool> isEnabled([]()
+		{
+			const char *pcProfile = std::getenv("IL9_AUDIT_PROFILE");
+			return pcProfile != NULL && pcProfile[0] != '\0' && std::strcmp(pcProfile, "0") != 0;
+		}());
+
+		return isEnabled;
+	}
+
+	std::atomic<double> &slowQueryThresholdMs()
+	{
+		static std::atomic<double> dThresholdMs([]()
+		{
+			const char *pcThresholdMs = std::getenv("IL9_AUDIT_SLOW_QUERY_MS");
+			return (pcThresholdMs != NULL && pcThresholdMs[0] != '\0') ? std::atof(pcThresholdMs) : il9::utils::AuditLog::IL9_AUDIT_DEFAULT_SLOW_QUERY_MS;
+		}());
+
+		return dThresholdMs;
+	}
+
+	Teamcenter::Logging::Logger *slowQueryLogger()
+	{
+		static Teamcenter::Logging::Logger *logger = Teamcenter::Logging::Logger::getLogger("Teamcenter.IL9.IL9common.il9.utils.AuditLog.SlowQuery");
+		return logger;
+	}
+
+	void logSlowCall(const il9::utils::AuditLog::AuditProfileRecord &record)
+	{
+		char szTimes[256];
+		snprintf(szTimes, sizeof(szTimes), "%.3f ms (run %.3f ms, decode %.3f ms, compare %.3f ms)", record.dTotalMs,
+			record.dPhaseMs[il9::utils::AuditLog::IL9_AUDIT_PHASE_RUN], record.dPhaseMs[il9::utils::AuditLog::IL9_AUDIT_PHASE_DECODE],
+			record.dPhaseMs[il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE]);
+
+		slowQueryLogger()->warn("\n Slow audit call --> " + record.szFunctionName + " " + szTimes
+			+ "\n   enquiries " + std::to_string(record.enquiries) + ", rows " + std::to_string(record.rows) + ", cols " + std::to_string(record.nCols)
+			+ ", bytes " + std::to_string(record.bytesAllocated) + ", ifail " + std::to_string(record.iFail)
+			+ "\n   signature " + record.szSignature
+			+ "\n   binds " + record.szBindValues);
+	}
+#endif
+}
+
+void il9::utils::AuditLog::AuditLatencyHistogram::record(double dMs)
+{
+	double dUs = dMs * 1000.0;
+	int indexBucket = 0;
+
+	while (indexBucket < IL9_AUDIT_PROFILE_NUM_OF_BUCKETS - 1 && dUs >= (double)(1LL << indexBucket)) indexBucket++;
+
+	buckets[indexBucket]++;
+	count++;
+	dTotalMs += dMs;
+	dMaxMs = std::max(dMaxMs, dMs);
+}
+
+double il9::utils::AuditLog::AuditLatencyHistogram::percentileMs(double dPercentile) const
+{
+	if (count == 0) return 0.0;
+
+	long rank = (long)(dPercentile * count + 0.5);
+	if (rank < 1) rank = 1;
+
+	long cumulative = 0;
+
+	for (int indexBucket = 0; indexBucket < IL9_AUDIT_PROFILE_NUM_OF_BUCKETS - 1; indexBucket++)
+	{
+		cumulative += buckets[indexBucket];
+		if (cumulative >= rank) return std::min(dMaxMs, (double)(1LL << indexBucket) / 1000.0);
+	}
+
+	return dMaxMs;
+}
+
+#ifndef IL9_AUDITLOG_NO_INSTRUMENTATION
+
+bool il9::utils::AuditLog::il9_isAuditProfilingEnabled()
+{
+	return profilingEnabled().load(std::memory_order_relaxed);
+}
+
+void il9::utils::AuditLog::il9_setAuditProfilingEnabled(bool isEnabled)
+{
+	profilingEnabled().store(isEnabled);
+}
+
+double il9::utils::AuditLog::il9_getAuditSlowQueryThresholdMs()
+{
+	return slowQueryThresholdMs().load(std::memory_order_relaxed);
+}
+
+void il9::utils::AuditLog::il9_setAuditSlowQueryThresholdMs(double dThresholdMs)
+{
+	slowQueryThresholdMs().store(dThresholdMs);
+}
+
+il9::utils::AuditLog::AuditProfileRecord *il9::utils::AuditLog::il9_currentAuditProfile()
+{
+	return t_currentRecord;
+}
+
+void il9::utils::AuditLog::il9_profileAuditEnquiry(const std::string &szSignature, const std::string &szBindValues)
+{
+	if (t_currentRecord == NULL || !t_currentRecord->szSignature.empty()) return;
+
+	t_currentRecord->szSignature = szSignature;
+	t_currentRecord->szBindValues = szBindValues;
+}
+
+void il9::utils::AuditLog::il9_profileAuditResult(int nRows, int nCols)
+{
+	if (t_currentRecord == NULL) return;
+
+	t_currentRecord->enquiries++;
+	t_currentRecord->rows += nRows;
+	t_currentRecord->nCols = nCols;
+	t_currentRecord->bytesAllocated += (size_t)nRows * (sizeof(void **) + (size_t)nCols * sizeof(void *));
+}
+
+void il9::utils::AuditLog::il9_profileAuditBytes(size_t bytes)
+{
+	if (t_currentRecord != NULL) t_currentRecord->bytesAllocated += bytes;
+}
+
+void il9::utils::AuditLog::il9_profileAuditBytes(const std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+{
+	if (t_currentRecord == NULL) return;
+
+	size_t bytes = modifiedProperties.capacity() * sizeof(il9::utils::AuditLog::PropertyInfo);
+
+	//values are held in std::any, only string values own memory beyond the struct
+	for (size_t indexProperty = 0; indexProperty < modifiedProperties.size(); indexProperty++)
+	{
+		const il9::utils::AuditLog::PropertyInfo &propertyInfo = modifiedProperties[indexProperty];
+		const std::string *pszCurrentValue = std::any_cast<std::string>(&propertyInfo.szCurrentValue);
+		const std::string *pszOldValue = std::any_cast<std::string>(&propertyInfo.szOldValue);
+
+		bytes += propertyInfo.szPropertyName.capacity();
+		if (pszCurrentValue != NULL) bytes += pszCurrentValue->capacity();
+		if (pszOldValue != NULL) bytes += pszOldValue->capacity();
+	}
+
+	t_currentRecord->bytesAllocated += bytes;
+}
+
+il9::utils::AuditLog::AuditProfiledCall::AuditProfiledCall(const char *pcFunctionName, int *piFail)
+	: m_piFail(piFail), m_isOwner(false)
+{
+	if (t_currentRecord != NULL || !il9_isAuditProfilingEnabled()) return;
+
+	m_record.szFunctionName = pcFunctionName;
+	m_isOwner = true;
+	m_tpStart = std::chrono::steady_clock::now();
+
+	t_currentRecord = &m_record;
+	t_iCurrentPhase = -1;
+}
+
+il9::utils::AuditLog::AuditProfiledCall::~AuditProfiledCall()
+{
+	if (!m_isOwner) return;
+
+	t_currentRecord = NULL;
+	t_iCurrentPhase = -1;
+
+	m_record.dTotalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_tpStart).count();
+	if (m_piFail != NULL) m_record.iFail = *m_piFail;
+
+	bool isSlow = m_record.dTotalMs >= il9_getAuditSlowQueryThresholdMs();
+
+	AuditProfileRegistry::instance().record(m_record, isSlow);
+
+	if (isSlow) logSlowCall(m_record);
+}
+
+il9::utils::AuditLog::AuditProfiledPhase::AuditProfiledPhase(AuditProfilePhase phase)
+	: m_record(t_currentRecord), m_iPhase(phase), m_iPreviousPhase(t_iCurrentPhase)
+{
+	if (m_record == NULL) return;
+
+	m_tpStart = std::chrono::steady_clock::now();
+	t_iCurrentPhase = m_iPhase;
+}
+
+il9::utils::AuditLog::AuditProfiledPhase::~AuditProfiledPhase()
+{
+	//the call may have ended first when the phase outlives it
+	if (m_record == NULL || m_record != t_currentRecord) return;
+
+	double dElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_tpStart).count();
+
+	//the enclosing phase adds its whole lifetime when it ends, take this part back from it
+	m_record->dPhaseMs[m_iPhase] += dElapsedMs;
+	if (m_iPreviousPhase >= 0) m_record->dPhaseMs[m_iPreviousPhase] -= dElapsedMs;
+
+	t_iCurrentPhase = m_iPreviousPhase;
+}
+
+#endif
+
+std::string il9::utils::AuditLog::il9_formatAuditDate(const date_t &dtValue)
+{
+	//months are 0 based in date_t
+	char szDate[32];
+	snprintf(szDate, sizeof(szDate), "%04d-%02d-%02d %02d:%02d:%02d", (int)dtValue.year, (int)dtValue.month + 1, (int)dtValue.day, (int)dtValue.hour,
+		(int)dtValue.minute, (int)dtValue.second);
+
+	return szDate;
+}
+
+void il9::utils::AuditLog::il9_getAuditProfileStatistics(std::map< std::string, il9::utils::AuditLog::AuditProfileStatistics > &statisticsByFunction)
+{
+	AuditProfileRegistry::instance().statistics(statisticsByFunction);
+}
+
+void il9::utils::AuditLog::il9_resetAuditProfileStatistics()
+{
+	AuditProfileRegistry::instance().reset();
+}
+
+void il9::utils::AuditLog::il9_dumpAuditProfileStatistics(std::ostream &output)
+{
+	std::map< std::string, il9::utils::AuditLog::AuditProfileStatistics > statisticsByFunction;
+	AuditProfileRegistry::instance().statistics(statisticsByFunction);
+
+	char szLine[512];
+
+	snprintf(szLine, sizeof(szLine), "%-44s %-8s %8s %6s %6s %9s %10s %12s %10s %10s %10s %10s\n", "function", "phase", "calls", "failed", "slow",
+		"enquiries", "rows", "bytes", "p50 ms", "p99 ms", "max ms", "total ms");
+	output << szLine;
+
+	for (std::map< std::string, il9::utils::AuditLog::AuditProfileStatistics >::const_iterator itStatistics = statisticsByFunction.begin();
+		itStatistics != statisticsByFunction.end(); itStatistics++)
+	{
+		const il9::utils::AuditLog::AuditProfileStatistics &statistics = itStatistics->second;
+
+		snprintf(szLine, sizeof(szLine), "%-44s %-8s %8ld %6ld %6ld %9ld %10ld %12zu %10.3f %10.3f %10.3f %10.3f\n", itStatistics->first.c_str(), "total",
+			statistics.calls, statistics.failedCalls, statistics.slowCalls, statistics.enquiries, statistics.rows, statistics.bytesAllocated,
+			statistics.total.percentileMs(0.50), statistics.total.percentileMs(0.99), statistics.total.dMaxMs, statistics.total.dTotalMs);
+		output << szLine;
+
+		for (int indexPhase = 0; indexPhase < IL9_AUDIT_NUM_OF_PHASES; indexPhase++)
+		{
+			const il9::utils::AuditLog::AuditLatencyHistogram &histogram = statistics.phases[indexPhase];
+
+			snprintf(szLine, sizeof(szLine), "%-44s %-8s %8s %6s %6s %9s %10s %12s %10.3f %10.3f %10.3f %10.3f\n", "", PHASE_NAMES[indexPhase], "", "", "", "", "", "",
+				histogram.percentileMs(0.50), histogram.percentileMs(0.99), histogram.dMaxMs, histogram.dTotalMs);
+			output << szLine;
+		}
+	}
+}
@@ -0,0 +1,188 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogProfiler.hxx
+* Description:  This file contains declarations of the query profiler and slow query
+*				log of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGPROFILER_HXX
+#define IL9_AUDITLOGPROFILER_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//The profiler is compiled out together with the other hooks when IL9_AUDITLOG_NO_INSTRUMENTATION is defined.
+//Otherwise it is enabled when IL9_AUDIT_PROFILE is set (and not 0) at the first call, or with il9_setAuditProfilingEnabled.
+//Calls taking IL9_AUDIT_SLOW_QUERY_MS milliseconds or more (default IL9_AUDIT_DEFAULT_SLOW_QUERY_MS) are written to the
+//logger Teamcenter.IL9.IL9common.il9.utils.AuditLog.SlowQuery.
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			const double IL9_AUDIT_DEFAULT_SLOW_QUERY_MS = 1000.0;
+
+			//buckets of the latency histograms, bucket i counts latencies in [2^(i-1), 2^i) microseconds, the last one everything above
+			const int IL9_AUDIT_PROFILE_NUM_OF_BUCKETS = 24;
+
+			enum AuditProfilePhase
+			{
+				IL9_AUDIT_PHASE_RUN = 0,		//executing enquiries
+				IL9_AUDIT_PHASE_DECODE = 1,		//reading results and current values
+				IL9_AUDIT_PHASE_COMPARE = 2,	//comparing baselines against current values
+				IL9_AUDIT_NUM_OF_PHASES = 3
+			};
+
+			struct AuditLatencyHistogram
+			{
+				long buckets[IL9_AUDIT_PROFILE_NUM_OF_BUCKETS] = {};
+				long count = 0;
+				double dTotalMs = 0.0;
+				double dMaxMs = 0.0;
+
+				void record(double dMs);
+
+				//upper bound of the bucket holding the given share of the latencies, 0 when empty
+				double percentileMs(double dPercentile) const;
+			};
+
+			//what one profiled call did, phases exclude the time of nested phases
+			struct AuditProfileRecord
+			{
+				std::string szFunctionName;
+				std::string szSignature;	//signature of the first enquiry of the call
+				std::string szBindValues;	//bind values of the first enquiry of the call
+				int enquiries = 0;
+				long rows = 0;
+				int nCols = 0;
+				size_t bytesAllocated = 0;	//result matrices and reported values, the allocator itself is not hooked
+				double dPhaseMs[IL9_AUDIT_NUM_OF_PHASES] = {};
+				double dTotalMs = 0.0;
+				int iFail = 0;
+			};
+
+			//counters of one entry point
+			struct AuditProfileStatistics
+			{
+				long calls = 0;
+				long failedCalls = 0;
+				long slowCalls = 0;
+				long enquiries = 0;
+				long rows = 0;
+				size_t bytesAllocated = 0;
+				AuditLatencyHistogram total;
+				AuditLatencyHistogram phases[IL9_AUDIT_NUM_OF_PHASES];
+			};
+
+#ifdef IL9_AUDITLOG_NO_INSTRUMENTATION
+			inline bool il9_isAuditProfilingEnabled() { return false; }
+			inline void il9_setAuditProfilingEnabled(bool) {}
+			inline double il9_getAuditSlowQueryThresholdMs() { return IL9_AUDIT_DEFAULT_SLOW_QUERY_MS; }
+			inline void il9_setAuditSlowQueryThresholdMs(double) {}
+			inline AuditProfileRecord *il9_currentAuditProfile() { return nullptr; }
+			inline void il9_profileAuditEnquiry(const std::string &, const std::string &) {}
+			inline void il9_profileAuditResult(int, int) {}
+			inline void il9_profileAuditBytes(size_t) {}
+			inline void il9_profileAuditBytes(const std::vector< PropertyInfo > &) {}
+
+			class AuditProfiledCall
+			{
+			public:
+				AuditProfiledCall(const char *, int *) {}
+			};
+
+			class AuditProfiledPhase
+			{
+			public:
+				explicit AuditProfiledPhase(AuditProfilePhase) {}
+			};
+#else
+			bool il9_isAuditProfilingEnabled();
+			void il9_setAuditProfilingEnabled(bool isEnabled);
+
+			double il9_getAuditSlowQueryThresholdMs();
+			void il9_setAuditSlowQueryThresholdMs(double dThresholdMs);
+
+			//record of the profiled call active on this thread, NULL when profiling is disabled or no call is active
+			AuditProfileRecord *il9_currentAuditProfile();
+
+			//signature and bind values of the active call, kept from the first enquiry of the call
+			void il9_profileAuditEnquiry(const std::string &szSignature, const std::string &szBindValues);
+
+			//counts an executed enquiry and its result matrix on the active call
+			void il9_profileAuditResult(int nRows, int nCols);
+
+			//counts memory allocated for the active call
+			void il9_profileAuditBytes(size_t bytes);
+
+			//counts the reported property infos and their values
+			void il9_profileAuditBytes(const std::vector< PropertyInfo > &modifiedProperties);
+
+			/**
+			* Profiles an entry point for its lifetime, in the way AuditJournal journals it. Only the outermost profiled call of a
+			* thread is recorded, nested entry points add their enquiries and phases to it. Counters are kept per pcFunctionName,
+			* overloads and methods of the same name pass a distinguishing name instead of __func__.
+			*/
+			class AuditProfiledCall
+			{
+			public:
+				AuditProfiledCall(const char *pcFunctionName, int *piFail);
+				~AuditProfiledCall();
+
+				AuditProfiledCall(const AuditProfiledCall &) = delete;
+				AuditProfiledCall &operator=(const AuditProfiledCall &) = delete;
+
+			private:
+				AuditProfileRecord m_record;
+				int *m_piFail;
+				bool m_isOwner;
+				std::chrono::steady_clock::time_point m_tpStart;
+			};
+
+			//adds its lifetime to a phase of the active call, the time of a nested phase is only counted once for the nested phase
+			class AuditProfiledPhase
+			{
+			public:
+				explicit AuditProfiledPhase(AuditProfilePhase phase);
+				~AuditProfiledPhase();
+
+				AuditProfiledPhase(const AuditProfiledPhase &) = delete;
+				AuditProfiledPhase &operator=(const AuditProfiledPhase &) = delete;
+
+			private:
+				AuditProfileRecord *m_record;
+				int m_iPhase;
+				int m_iPreviousPhase;
+				std::chrono::steady_clock::time_point m_tpStart;
+			};
+#endif
+
+			//date as yyyy-mm-dd hh:mm:ss for bind values
+			std::string il9_formatAuditDate(const date_t &dtValue);
+
+			//counters per entry point since the start of the process or the last reset
+			void il9_getAuditProfileStatistics(std::map< std::string, AuditProfileStatistics > &statisticsByFunction);
+
+			void il9_resetAuditProfileStatistics();
+
+			//writes the counters and latency percentiles per entry point and phase as text
+			void il9_dumpAuditProfileStatistics(std::ostream &output);
+		}
+	}
+}
+
+#endif
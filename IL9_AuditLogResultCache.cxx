@@ -0,0 +1,340 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogResultCache.cxx
+* Description:  This file contains definitions of the audit result cache of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogResultCache.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogBatch.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_AuditLogTrace.hxx"
+
+#include <fclasses/tc_date.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	const char *const LAST_MOD_DATE_ATTR = "last_mod_date";
+
+	struct AuditResultCacheEntry
+	{
+		tag_t tObjectTag = NULLTAG;
+		std::shared_ptr<const il9::utils::AuditLog::CachedAuditBaseline> baseline;
+		std::list<std::string>::iterator itRecentlyUsed;
+	};
+
+	bool isSameDate(const date_t &dtValue, const date_t &dtOtherValue)
+	{
+		return dtValue.year == dtOtherValue.year && dtValue.month == dtOtherValue.month && dtValue.day == dtOtherValue.day
+			&& dtValue.hour == dtOtherValue.hour && dtValue.minute == dtOtherValue.minute && dtValue.second == dtOtherValue.second;
+	}
+
+	std::string buildAuditResultKey(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName)
+	{
+		std::string szKey = std::to_string(tObjectTag);
+
+		szKey.append("|").append(strEventTypeName);
+		szKey.append("|").append(std::to_string(dtLoggedAfterDate.year)).append("-").append(std::to_string(dtLoggedAfterDate.month))
+			.append("-").append(std::to_string(dtLoggedAfterDate.day)).append(" ").append(std::to_string(dtLoggedAfterDate.hour))
+			.append(":").append(std::to_string(dtLoggedAfterDate.minute)).append(":").append(std::to_string(dtLoggedAfterDate.second));
+
+		return szKey;
+	}
+
+	//true when every requested property is part of the entry
+	bool coversProperties(const il9::utils::AuditLog::CachedAuditBaseline &baseline, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			bool isSelected = false;
+
+			for (size_t indexSelected = 0; indexSelected < baseline.propNamesSelected.size() && !isSelected; indexSelected++)
+			{
+				isSelected = baseline.propNamesSelected[indexSelected].szPropertyName == propNamesToValidate[indexPropInput].szPropertyName;
+			}
+
+			if (!isSelected) return false;
+		}
+
+		return true;
+	}
+
+	/**
+	* Session wide LRU of baselines. Every member locks the cache, so concurrent lookups (e.g. from the scan engine
+	* workers) may share it; the enquiry of a miss runs outside the lock and entries hand out shared immutable baselines.
+	*/
+	class AuditResultCache
+	{
+	public:
+		static AuditResultCache &instance()
+		{
+			//never destroyed, cached results must not be freed from static destructors after the session has ended
+			static AuditResultCache *cache = new AuditResultCache();
+			return *cache;
+		}
+
+		//baseline of the key, NULL when there is no entry
+		std::shared_ptr<const il9::utils::AuditLog::CachedAuditBaseline> find(const std::string &szKey)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			std::unordered_map<std::string, AuditResultCacheEntry>::iterator itEntry = m_hmEntries.find(szKey);
+			if (itEntry == m_hmEntries.end()) return NULL;
+
+			m_lstRecentlyUsed.splice(m_lstRecentlyUsed.begin(), m_lstRecentlyUsed, itEntry->second.itRecentlyUsed);
+			return itEntry->second.baseline;
+		}
+
+		void put(const std::string &szKey, tag_t tObjectTag, const std::shared_ptr<const il9::utils::AuditLog::CachedAuditBaseline> &baseline)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			std::unordered_map<std::string, AuditResultCacheEntry>::iterator itEntry = m_hmEntries.find(szKey);
+
+			if (itEntry != m_hmEntries.end())
+			{
+				itEntry->second.baseline = baseline;
+				return;
+			}
+
+			while (!m_lstRecentlyUsed.empty() && m_hmEntries.size() >= il9::utils::AuditLog::IL9_AUDIT_RESULT_CACHE_SIZE)
+			{
+				eraseLocked(m_lstRecentlyUsed.back());
+				m_statistics.evictions++;
+			}
+
+			m_lstRecentlyUsed.push_front(szKey);
+
+			AuditResultCacheEntry &entry = m_hmEntries[szKey];
+			entry.tObjectTag = tObjectTag;
+			entry.baseline = baseline;
+			entry.itRecentlyUsed = m_lstRecentlyUsed.begin();
+
+			m_hmKeysByObject[tObjectTag].insert(szKey);
+		}
+
+		void erase(const std::string &szKey)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			eraseLocked(szKey);
+		}
+
+		void eraseObject(tag_t tObjectTag)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (tObjectTag == NULLTAG)
+			{
+				m_hmEntries.clear();
+				m_hmKeysByObject.clear();
+				m_lstRecentlyUsed.clear();
+				return;
+			}
+
+			std::unordered_map< tag_t, std::unordered_set<std::string> >::iterator itKeys = m_hmKeysByObject.find(tObjectTag);
+			if (itKeys == m_hmKeysByObject.end()) return;
+
+			std::vector<std::string> vectorKeys(itKeys->second.begin(), itKeys->second.end());
+			for (size_t indexKey = 0; indexKey < vectorKeys.size(); indexKey++) eraseLocked(vectorKeys[indexKey]);
+		}
+
+		void count(long il9::utils::AuditLog::AuditResultCacheStatistics::*pCounter)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_statistics.*pCounter += 1;
+		}
+
+		il9::utils::AuditLog::AuditResultCacheStatistics statistics()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			il9::utils::AuditLog::AuditResultCacheStatistics statistics = m_statistics;
+			statistics.size = (int)m_hmEntries.size();
+
+			return statistics;
+		}
+
+	private:
+		AuditResultCache() {}
+
+		void eraseLocked(const std::string &szKey)
+		{
+			std::unordered_map<std::string, AuditResultCacheEntry>::iterator itEntry = m_hmEntries.find(szKey);
+			if (itEntry == m_hmEntries.end()) return;
+
+			std::unordered_map< tag_t, std::unordered_set<std::string> >::iterator itKeys = m_hmKeysByObject.find(itEntry->second.tObjectTag);
+
+			if (itKeys != m_hmKeysByObject.end())
+			{
+				itKeys->second.erase(szKey);
+				if (itKeys->second.empty()) m_hmKeysByObject.erase(itKeys);
+			}
+
+			m_lstRecentlyUsed.erase(itEntry->second.itRecentlyUsed);
+			m_hmEntries.erase(itEntry);
+		}
+
+		std::mutex m_mutex;
+		std::unordered_map<std::string, AuditResultCacheEntry> m_hmEntries;
+		std::unordered_map< tag_t, std::unordered_set<std::string> > m_hmKeysByObject;
+		std::list<std::string> m_lstRecentlyUsed;
+		il9::utils::AuditLog::AuditResultCacheStatistics m_statistics;
+	};
+}
+
+il9::utils::AuditLog::CachedAuditBaseline::~CachedAuditBaseline()
+{
+	if (result != NULL) MEM_free(result);
+}
+
+int il9::utils::AuditLog::CachedAuditBaseline::columnOf(const std::string &szPropertyName) const
+{
+	std::vector<int> vectorPropertyCols;
+	il9_getAuditPropertyColumns(propNamesSelected, nCols, vectorPropertyCols);
+
+	for (size_t indexSelected = 0; indexSelected < propNamesSelected.size(); indexSelected++)
+	{
+		if (propNamesSelected[indexSelected].iType == POM_long_string) continue;
+
+		if (propNamesSelected[indexSelected].szPropertyName == szPropertyName) return vectorPropertyCols[indexSelected];
+	}
+
+	return -1;
+}
+
+int il9::utils::AuditLog::il9_getCachedAuditBaseline(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate, std::shared_ptr<const CachedAuditBaseline> &baseline)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput(tObjectTag);
+	journalling.journalRoutineCall();
+
+	baseline.reset();
+
+	try
+	{
+		AuditResultCache &cache = AuditResultCache::instance();
+		std::string szKey = buildAuditResultKey(tObjectTag, dtLoggedAfterDate, strEventTypeName);
+
+		//only saves of the object log the pre-filter event type, a changed last_mod_date is a potential new audit record
+		//of it; the records of other event types are logged without a save and say nothing about last_mod_date
+		bool isLastModDateBound = (strEventTypeName == IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME);
+		date_t dtObjectLastModDate = NULLDATE;
+
+		if (isLastModDateBound)
+		{
+			status = AOM_ask_value_date(tObjectTag, LAST_MOD_DATE_ATTR, &dtObjectLastModDate);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, LAST_MOD_DATE_ATTR, POM_date, &dtObjectLastModDate);
+		}
+
+		std::vector< ValidatePropertyInput > propNamesToSelect;
+		std::shared_ptr<const CachedAuditBaseline> cachedBaseline = cache.find(szKey);
+
+		if (!cachedBaseline)
+		{
+			cache.count(&AuditResultCacheStatistics::misses);
+			propNamesToSelect = propNamesToValidate;
+		}
+		else if (isLastModDateBound && !isSameDate(cachedBaseline->dtObjectLastModDate, dtObjectLastModDate))
+		{
+			cache.count(&AuditResultCacheStatistics::invalidations);
+			propNamesToSelect = propNamesToValidate;
+		}
+		else if (!coversProperties(*cachedBaseline, propNamesToValidate))
+		{
+			//union of the cached and the requested properties, cached ones first
+			cache.count(&AuditResultCacheStatistics::widenings);
+			propNamesToSelect = cachedBaseline->propNamesSelected;
+
+			for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+			{
+				std::vector< ValidatePropertyInput > vectorRequested(1, propNamesToValidate[indexPropInput]);
+				if (!coversProperties(*cachedBaseline, vectorRequested)) propNamesToSelect.push_back(propNamesToValidate[indexPropInput]);
+			}
+		}
+		else
+		{
+			cache.count(&AuditResultCacheStatistics::hits);
+			baseline = cachedBaseline;
+		}
+
+		if (!baseline)
+		{
+			std::shared_ptr<CachedAuditBaseline> fetchedBaseline = std::make_shared<CachedAuditBaseline>();
+
+			//the widened selection has properties of earlier calls
+			il9::utils::AuditLog::il9_traceAuditPropertyTypes(propNamesToSelect);
+
+			status = il9::utils::AuditLog::il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToSelect,
+				IL9_AUDIT_QUERY_BASELINE_ONLY, fetchedBaseline->nRows, fetchedBaseline->nCols, &fetchedBaseline->result);
+
+			fetchedBaseline->propNamesSelected = propNamesToSelect;
+			fetchedBaseline->dtObjectLastModDate = dtObjectLastModDate;
+
+			//once found the oldest record since the date does not change, while there is none any new record can be the
+			//baseline, so only found baselines are kept
+			if (fetchedBaseline->hasAuditRecord())
+			{
+				fetchedBaseline->auditObjectTag = *((tag_t *)fetchedBaseline->result[fetchedBaseline->nRows - 1][0]);
+				cache.put(szKey, tObjectTag, fetchedBaseline);
+			}
+			else if (cachedBaseline)
+			{
+				cache.erase(szKey);
+			}
+
+			baseline = fetchedBaseline;
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::il9_invalidateAuditResultCache(tag_t tObjectTag)
+{
+	AuditResultCache::instance().eraseObject(tObjectTag);
+}
+
+void il9::utils::AuditLog::il9_getAuditResultCacheStatistics(AuditResultCacheStatistics &statistics)
+{
+	statistics = AuditResultCache::instance().statistics();
+}
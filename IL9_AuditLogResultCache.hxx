@@ -0,0 +1,89 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogResultCache.hxx
+* Description:  This file contains declarations of the audit result cache of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGRESULTCACHE_HXX
+#define IL9_AUDITLOGRESULTCACHE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//maximum number of objects whose baseline audit rows are kept per session
+			const int IL9_AUDIT_RESULT_CACHE_SIZE = 128;
+
+			/**
+			* Baseline audit rows (oldest audit record since a date) of one object for an event type, as returned by the
+			* IL9_AUDIT_QUERY_BASELINE_ONLY audit enquiry. The result is owned by the cache entry and freed with it.
+			*/
+			class CachedAuditBaseline
+			{
+			public:
+				CachedAuditBaseline() : nRows(0), nCols(0), result(NULL), auditObjectTag(NULLTAG) {}
+				~CachedAuditBaseline();
+
+				CachedAuditBaseline(const CachedAuditBaseline &) = delete;
+				CachedAuditBaseline &operator=(const CachedAuditBaseline &) = delete;
+
+				//column of the property value in the result, the old value follows it; -1 when the property was not selected
+				int columnOf(const std::string &szPropertyName) const;
+
+				bool hasAuditRecord() const { return nRows > 0 && nCols > 1; }
+
+				int nRows;
+				int nCols;
+				void ***result;
+				tag_t auditObjectTag;
+
+				//selected properties in result column order, long string properties are listed but own no column
+				std::vector< ValidatePropertyInput > propNamesSelected;
+				date_t dtObjectLastModDate = NULLDATE;	//only read for IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME
+			};
+
+			struct AuditResultCacheStatistics
+			{
+				long hits = 0;			//lookups served without an audit enquiry
+				long misses = 0;		//lookups for objects without a cache entry
+				long widenings = 0;		//entries requeried because a property was not selected yet
+				long invalidations = 0;	//__Modify entries requeried because last_mod_date of the object changed
+				long evictions = 0;
+				int size = 0;
+			};
+
+			/**
+			* Returns the baseline audit rows of tObjectTag covering at least propNamesToValidate. Entries are keyed by
+			* (object, event type, logged after date); a request for a property which is not part of the entry requeries
+			* the union of the cached and requested properties, so per property checks on the same object share one
+			* enquiry. Only baselines with an audit record are kept, the oldest record since the date does not change once
+			* logged. For IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME an entry is also discarded when last_mod_date of the object
+			* has changed since it was filled. The cache is shared by all threads of the session, access is serialized.
+			*/
+			int il9_getCachedAuditBaseline(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate, std::shared_ptr<const CachedAuditBaseline> &baseline);
+
+			//drops the entries of an object, e.g. after writing an audit record without changing the object; NULLTAG drops all
+			void il9_invalidateAuditResultCache(tag_t tObjectTag);
+
+			void il9_getAuditResultCacheStatistics(AuditResultCacheStatistics &statistics);
+		}
+	}
+}
+
+#endif
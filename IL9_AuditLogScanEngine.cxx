@@ -0,0 +1,870 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogScanEngine.cxx
+* Description:  This file contains definitions of the multi-process scan engine of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogScanEngine.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <unordered_set>
+#include <utility>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char **environ;
+#endif
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	//objects of a shard with their modified properties, in input order
+	struct ShardResult
+	{
+		bool isDone = false;
+		int iFail = ITK_ok;
+		std::vector< std::pair< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > > vectorResults;
+		std::vector< std::pair< uint32_t, int > > vectorObjectFailures;	//position in the shard and iFail of objects which were not scanned
+	};
+
+	//hands completed shards to the callback in shard order
+	void deliverShard(size_t shardIndex, ShardResult &shardResult, const std::vector<tag_t> &shardObjectTags,
+		const il9::utils::AuditLog::AuditScanResultCallback &onResult, std::vector< il9::utils::AuditLog::AuditScanShardFailure > &failures)
+	{
+		if (shardResult.iFail != ITK_ok)
+		{
+			il9::utils::AuditLog::AuditScanShardFailure failure;
+			failure.shardIndex = shardIndex;
+			failure.iFail = shardResult.iFail;
+			failure.objectTags = shardObjectTags;
+
+			failures.push_back(failure);
+			return;
+		}
+
+		for (size_t indexResult = 0; indexResult < shardResult.vectorResults.size(); indexResult++)
+		{
+			onResult(shardResult.vectorResults[indexResult].first, shardResult.vectorResults[indexResult].second);
+		}
+
+		for (size_t indexFailure = 0; indexFailure < shardResult.vectorObjectFailures.size(); indexFailure++)
+		{
+			if (shardResult.vectorObjectFailures[indexFailure].first >= shardObjectTags.size()) continue;
+
+			il9::utils::AuditLog::AuditScanShardFailure failure;
+			failure.shardIndex = shardIndex;
+			failure.iFail = shardResult.vectorObjectFailures[indexFailure].second;
+			failure.objectTags.push_back(shardObjectTags[shardResult.vectorObjectFailures[indexFailure].first]);
+
+			failures.push_back(failure);
+		}
+	}
+
+#ifndef _WIN32
+	/**
+	* Wire format between the engine and its workers (same host, native byte order):
+	*   engine -> worker: once LOGGED_DATE bound (date_t), event type, property count (u32), per property
+	*                     name, old name, type (i32); then per shard: shard index (u32), object count (u32), object UIDs
+	*   worker -> engine: 'O' object UID, property count (u32), per property name, current value, old value
+	*                     'F' position of the object in the shard (u32), iFail (i32) for an object UID which did not resolve
+	*                     'E' iFail (i32) once the shard is complete
+	* strings are a u32 length followed by the bytes, values a kind byte followed by the payload.
+	*/
+	enum WireValueKind : uint8_t
+	{
+		WIRE_EMPTY = 0,
+		WIRE_STRING = 1,
+		WIRE_LOGICAL = 2,
+		WIRE_INT = 3,
+		WIRE_DOUBLE = 4,
+		WIRE_DATE = 5,
+		WIRE_TAG = 6
+	};
+
+	class WireWriter
+	{
+	public:
+		template <typename T>
+		void put(const T &value) { m_szBuffer.append((const char *)&value, sizeof(T)); }
+
+		void putString(const std::string &szValue)
+		{
+			put((uint32_t)szValue.size());
+			m_szBuffer.append(szValue);
+		}
+
+		const std::string &buffer() const { return m_szBuffer; }
+		void clear() { m_szBuffer.clear(); }
+
+	private:
+		std::string m_szBuffer;
+	};
+
+	class WireReader
+	{
+	public:
+		WireReader(const char *pcData, size_t size) : m_pcData(pcData), m_size(size), m_offset(0) {}
+
+		template <typename T>
+		bool get(T &value)
+		{
+			if (m_size - m_offset < sizeof(T)) return false;
+
+			std::memcpy(&value, m_pcData + m_offset, sizeof(T));
+			m_offset += sizeof(T);
+
+			return true;
+		}
+
+		bool getString(std::string &szValue)
+		{
+			uint32_t length = 0;
+			if (!get(length) || m_size - m_offset < length) return false;
+
+			szValue.assign(m_pcData + m_offset, length);
+			m_offset += length;
+
+			return true;
+		}
+
+		size_t offset() const { return m_offset; }
+
+	private:
+		const char *m_pcData;
+		size_t m_size;
+		size_t m_offset;
+	};
+
+	void encodeValue(const std::any &value, il9::utils::AuditLog::AuditScanBackend &backend, WireWriter &writer)
+	{
+		if (value.type() == typeid(std::string))
+		{
+			writer.put((uint8_t)WIRE_STRING);
+			writer.putString(std::any_cast<const std::string &>(value));
+		}
+		else if (value.type() == typeid(logical))
+		{
+			writer.put((uint8_t)WIRE_LOGICAL);
+			writer.put((uint8_t)(std::any_cast<logical>(value) ? 1 : 0));
+		}
+		else if (value.type() == typeid(int))
+		{
+			writer.put((uint8_t)WIRE_INT);
+			writer.put((int32_t)std::any_cast<int>(value));
+		}
+		else if (value.type() == typeid(double))
+		{
+			writer.put((uint8_t)WIRE_DOUBLE);
+			writer.put(std::any_cast<double>(value));
+		}
+		else if (value.type() == typeid(date_t))
+		{
+			writer.put((uint8_t)WIRE_DATE);
+			writer.put(std::any_cast<date_t>(value));
+		}
+		else if (value.type() == typeid(tag_t))
+		{
+			//references are only meaningful in the receiving session as UIDs
+			std::string szUid;
+			tag_t tValue = std::any_cast<tag_t>(value);
+
+			if (tValue != NULLTAG) backend.tagToUid(tValue, szUid);
+
+			writer.put((uint8_t)WIRE_TAG);
+			writer.putString(szUid);
+		}
+		else
+		{
+			writer.put((uint8_t)WIRE_EMPTY);
+		}
+	}
+
+	bool decodeValue(WireReader &reader, il9::utils::AuditLog::AuditScanBackend &backend, std::any &value)
+	{
+		uint8_t kind = WIRE_EMPTY;
+		if (!reader.get(kind)) return false;
+
+		switch (kind)
+		{
+			case(WIRE_EMPTY):
+			{
+				value.reset();
+				return true;
+			}
+			case(WIRE_STRING):
+			{
+				std::string szValue;
+				if (!reader.getString(szValue)) return false;
+
+				value = std::move(szValue);
+				return true;
+			}
+			case(WIRE_LOGICAL):
+			{
+				uint8_t lValue = 0;
+				if (!reader.get(lValue)) return false;
+
+				value = (logical)(lValue != 0);
+				return true;
+			}
+			case(WIRE_INT):
+			{
+				int32_t iValue = 0;
+				if (!reader.get(iValue)) return false;
+
+				value = (int)iValue;
+				return true;
+			}
+			case(WIRE_DOUBLE):
+			{
+				double dValue = 0.0;
+				if (!reader.get(dValue)) return false;
+
+				value = dValue;
+				return true;
+			}
+			case(WIRE_DATE):
+			{
+				date_t dtValue = NULLDATE;
+				if (!reader.get(dtValue)) return false;
+
+				value = dtValue;
+				return true;
+			}
+			case(WIRE_TAG):
+			{
+				std::string szUid;
+				if (!reader.getString(szUid)) return false;
+
+				tag_t tValue = NULLTAG;
+				if (!szUid.empty()) backend.uidToTag(szUid, tValue);
+
+				value = tValue;
+				return true;
+			}
+			default:
+			{
+				//treated as a protocol error by the caller
+				throw IFail(il9::utils::AuditLog::IL9_AUDIT_SCAN_WORKER_FAILED);
+			}
+		}
+	}
+
+	//a peer which has exited fails the send with EPIPE instead of raising SIGPIPE in the process
+	bool sendAll(int fd, const std::string &szData)
+	{
+		size_t offset = 0;
+
+		while (offset < szData.size())
+		{
+			ssize_t written = ::send(fd, szData.data() + offset, szData.size() - offset, MSG_NOSIGNAL);
+
+			if (written < 0 && errno == EINTR) continue;
+			if (written <= 0) return false;
+
+			offset += (size_t)written;
+		}
+
+		return true;
+	}
+
+	bool readExact(int fd, char *pcBuffer, size_t size)
+	{
+		size_t offset = 0;
+
+		while (offset < size)
+		{
+			ssize_t numRead = ::read(fd, pcBuffer + offset, size - offset);
+
+			if (numRead < 0 && errno == EINTR) continue;
+			if (numRead <= 0) return false;
+
+			offset += (size_t)numRead;
+		}
+
+		return true;
+	}
+
+	bool readString(int fd, std::string &szValue)
+	{
+		uint32_t length = 0;
+		if (!readExact(fd, (char *)&length, sizeof(length))) return false;
+
+		szValue.resize(length);
+		return length == 0 || readExact(fd, &szValue[0], length);
+	}
+
+	//parameters of the scan, sent to every worker before its first shard
+	std::string encodeScanJob(date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		WireWriter writer;
+		writer.put(dtLoggedAfterDate);
+		writer.putString(strEventTypeName);
+		writer.put((uint32_t)propNamesToValidate.size());
+
+		for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+		{
+			writer.putString(propNamesToValidate[indexProp].szPropertyName);
+			writer.putString(propNamesToValidate[indexProp].szPropertyNameOld);
+			writer.put((int32_t)propNamesToValidate[indexProp].iType);
+		}
+
+		return writer.buffer();
+	}
+
+	bool readScanJob(int fd, date_t &dtLoggedAfterDate, std::string &strEventTypeName, std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		uint32_t numOfProperties = 0;
+
+		if (!readExact(fd, (char *)&dtLoggedAfterDate, sizeof(dtLoggedAfterDate)) || !readString(fd, strEventTypeName)
+			|| !readExact(fd, (char *)&numOfProperties, sizeof(numOfProperties)))
+		{
+			return false;
+		}
+
+		propNamesToValidate.resize(numOfProperties);
+
+		for (uint32_t indexProp = 0; indexProp < numOfProperties; indexProp++)
+		{
+			int32_t iType = 0;
+
+			if (!readString(fd, propNamesToValidate[indexProp].szPropertyName) || !readString(fd, propNamesToValidate[indexProp].szPropertyNameOld)
+				|| !readExact(fd, (char *)&iType, sizeof(iType)))
+			{
+				return false;
+			}
+
+			propNamesToValidate[indexProp].iType = iType;
+		}
+
+		return true;
+	}
+
+	struct WorkerProcess
+	{
+		pid_t pid = -1;
+		int fdSocket = -1;
+		long currentShard = -1;
+		std::string szBuffer;
+	};
+
+	void stopWorker(WorkerProcess &worker, bool bKill)
+	{
+		if (worker.fdSocket >= 0) ::close(worker.fdSocket);
+		if (bKill && worker.pid > 0) ::kill(worker.pid, SIGKILL);
+
+		if (worker.pid > 0)
+		{
+			int iExitStatus = 0;
+			while (::waitpid(worker.pid, &iExitStatus, 0) < 0 && errno == EINTR) {}
+		}
+
+		worker = WorkerProcess();
+	}
+
+	//executable of the workers: the option, IL9_AUDIT_SCAN_WORKER or IL9_AuditLogScanWorker on the PATH
+	std::string workerPathOf(const il9::utils::AuditLog::AuditScanOptions &options)
+	{
+		if (!options.szWorkerPath.empty()) return options.szWorkerPath;
+
+		const char *pcWorkerPath = std::getenv("IL9_AUDIT_SCAN_WORKER");
+
+		return (pcWorkerPath != NULL && *pcWorkerPath != '\0') ? pcWorkerPath : il9::utils::AuditLog::IL9_AUDIT_SCAN_WORKER_EXECUTABLE;
+	}
+
+	/**
+	* Starts a worker executable with its end of a socket pair as stdin and sends it the scan job. The worker is a new
+	* program which opens its own ITK session, nothing of this process but the environment is used by it.
+	*/
+	bool startWorker(WorkerProcess &worker, const std::string &szWorkerPath, const std::string &szScanJob)
+	{
+		int fdsSocket[2];
+
+		if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fdsSocket) != 0) return false;
+
+		//workers started later must not hold this worker's socket open, only the stdin copy is inherited
+		::fcntl(fdsSocket[0], F_SETFD, FD_CLOEXEC);
+		::fcntl(fdsSocket[1], F_SETFD, FD_CLOEXEC);
+
+		posix_spawn_file_actions_t fileActions;
+		::posix_spawn_file_actions_init(&fileActions);
+		::posix_spawn_file_actions_adddup2(&fileActions, fdsSocket[1], STDIN_FILENO);
+
+		char *argv[] = { const_cast<char *>(szWorkerPath.c_str()), NULL };
+		pid_t pid = -1;
+
+		int iSpawnError = ::posix_spawnp(&pid, szWorkerPath.c_str(), &fileActions, NULL, argv, environ);
+
+		::posix_spawn_file_actions_destroy(&fileActions);
+		::close(fdsSocket[1]);
+
+		if (iSpawnError != 0)
+		{
+			::close(fdsSocket[0]);
+			return false;
+		}
+
+		worker.pid = pid;
+		worker.fdSocket = fdsSocket[0];
+		worker.currentShard = -1;
+		worker.szBuffer.clear();
+
+		if (!sendAll(worker.fdSocket, szScanJob))
+		{
+			stopWorker(worker, true);
+			return false;
+		}
+
+		return true;
+	}
+
+	//decodes the complete records buffered for a worker, returns false on a protocol error
+	bool consumeWorkerOutput(WorkerProcess &worker, ShardResult &shardResult, il9::utils::AuditLog::AuditScanBackend &backend)
+	{
+		size_t consumed = 0;
+
+		for (;;)
+		{
+			WireReader reader(worker.szBuffer.data() + consumed, worker.szBuffer.size() - consumed);
+
+			uint8_t recordType = 0;
+			if (!reader.get(recordType)) break;
+
+			if (recordType == 'E')
+			{
+				int32_t iFail = ITK_ok;
+				if (!reader.get(iFail)) break;
+
+				shardResult.isDone = true;
+				shardResult.iFail = iFail;
+				worker.currentShard = -1;
+
+				consumed += reader.offset();
+				break;
+			}
+
+			if (recordType == 'F')
+			{
+				uint32_t indexObject = 0;
+				int32_t iFail = ITK_ok;
+				if (!reader.get(indexObject) || !reader.get(iFail)) break;
+
+				shardResult.vectorObjectFailures.push_back(std::make_pair(indexObject, (int)iFail));
+
+				consumed += reader.offset();
+				continue;
+			}
+
+			if (recordType != 'O') return false;
+
+			std::string szUid;
+			uint32_t numOfProperties = 0;
+			if (!reader.getString(szUid) || !reader.get(numOfProperties)) break;
+
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties(numOfProperties);
+			bool isComplete = true;
+
+			for (uint32_t indexProperty = 0; indexProperty < numOfProperties && isComplete; indexProperty++)
+			{
+				isComplete = reader.getString(modifiedProperties[indexProperty].szPropertyName)
+					&& decodeValue(reader, backend, modifiedProperties[indexProperty].szCurrentValue)
+					&& decodeValue(reader, backend, modifiedProperties[indexProperty].szOldValue);
+			}
+
+			//record not fully received yet
+			if (!isComplete) break;
+
+			tag_t tObjectTag = NULLTAG;
+			backend.uidToTag(szUid, tObjectTag);
+
+			shardResult.vectorResults.push_back(std::make_pair(tObjectTag, std::move(modifiedProperties)));
+			consumed += reader.offset();
+		}
+
+		worker.szBuffer.erase(0, consumed);
+		return true;
+	}
+#endif
+}
+
+int il9::utils::AuditLog::AuditScanEngine::run(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult, std::vector< AuditScanShardFailure > &failures)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)objectTags.size());
+	journalling.setInput(m_options.iNumOfWorkers);
+	journalling.journalRoutineCall();
+
+	try
+	{
+		int iShardSize = (m_options.iShardSize > 0) ? m_options.iShardSize : IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE;
+
+		//drop null tags and duplicates while keeping the caller's order
+		std::vector< std::vector<tag_t> > shards;
+		std::unordered_set<tag_t> hsSeenObjectTags;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			if (objectTags[indexObject] == NULLTAG || !hsSeenObjectTags.insert(objectTags[indexObject]).second) continue;
+
+			if (shards.empty() || shards.back().size() >= (size_t)iShardSize) shards.push_back(std::vector<tag_t>());
+			shards.back().push_back(objectTags[indexObject]);
+		}
+
+		bool bUseWorkers = m_options.iNumOfWorkers > 1 && shards.size() > 1;
+
+#ifdef _WIN32
+		bUseWorkers = false;
+#endif
+
+		if (bUseWorkers) runInWorkers(shards, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, onResult, failures);
+		else runInProcess(shards, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, onResult, failures);
+
+		//journalling
+		journalling.setOutput("numOfShards", (int)shards.size());
+		journalling.setOutput("numOfFailures", (int)failures.size());
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::AuditScanEngine::runInProcess(const std::vector< std::vector<tag_t> > &shards, date_t dtLoggedAfterDate,
+	const std::string &strEventTypeName, const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+	std::vector< AuditScanShardFailure > &failures)
+{
+	for (size_t shardIndex = 0; shardIndex < shards.size(); shardIndex++)
+	{
+		ShardResult shardResult;
+		std::map< tag_t, std::vector< PropertyInfo > > modifiedPropertiesByObject;
+
+		shardResult.iFail = m_backend.getModifiedPropertiesInfo(shards[shardIndex], dtLoggedAfterDate, strEventTypeName, propNamesToValidate,
+			modifiedPropertiesByObject);
+
+		for (size_t indexObject = 0; indexObject < shards[shardIndex].size() && shardResult.iFail == ITK_ok; indexObject++)
+		{
+			std::map< tag_t, std::vector< PropertyInfo > >::iterator itObject = modifiedPropertiesByObject.find(shards[shardIndex][indexObject]);
+			if (itObject != modifiedPropertiesByObject.end()) shardResult.vectorResults.push_back(std::make_pair(itObject->first, std::move(itObject->second)));
+		}
+
+		deliverShard(shardIndex, shardResult, shards[shardIndex], onResult, failures);
+	}
+}
+
+#ifdef _WIN32
+
+void il9::utils::AuditLog::AuditScanEngine::runInWorkers(const std::vector< std::vector<tag_t> > &shards, date_t dtLoggedAfterDate,
+	const std::string &strEventTypeName, const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+	std::vector< AuditScanShardFailure > &failures)
+{
+	runInProcess(shards, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, onResult, failures);
+}
+
+#else
+
+void il9::utils::AuditLog::AuditScanEngine::runInWorkers(const std::vector< std::vector<tag_t> > &shards, date_t dtLoggedAfterDate,
+	const std::string &strEventTypeName, const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+	std::vector< AuditScanShardFailure > &failures)
+{
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+
+	std::string szWorkerPath = workerPathOf(m_options);
+	std::string szScanJob = encodeScanJob(dtLoggedAfterDate, strEventTypeName, propNamesToValidate);
+
+	size_t numOfWorkers = std::min((size_t)m_options.iNumOfWorkers, shards.size());
+	size_t inFlightLimit = numOfWorkers + (size_t)std::max(0, m_options.iMaxPendingShards);
+	int numOfRestarts = 0;
+
+	std::vector<WorkerProcess> vectorWorkers(numOfWorkers);
+	std::map<size_t, ShardResult> hmShardResults;
+
+	for (size_t indexWorker = 0; indexWorker < numOfWorkers; indexWorker++)
+	{
+		if (!startWorker(vectorWorkers[indexWorker], szWorkerPath, szScanJob))
+		{
+			logger->error("Could not start audit scan worker process " + szWorkerPath);
+		}
+	}
+
+	//isolates the failure of a worker to its current shard and replaces the worker
+	auto failWorker = [&](WorkerProcess &worker)
+	{
+		if (worker.currentShard >= 0)
+		{
+			ShardResult &shardResult = hmShardResults[(size_t)worker.currentShard];
+			shardResult.vectorResults.clear();
+			shardResult.vectorObjectFailures.clear();
+			shardResult.iFail = IL9_AUDIT_SCAN_WORKER_FAILED;
+			shardResult.isDone = true;
+		}
+
+		stopWorker(worker, true);
+
+		if (numOfRestarts < m_options.iMaxWorkerRestarts)
+		{
+			numOfRestarts++;
+			startWorker(worker, szWorkerPath, szScanJob);
+		}
+	};
+
+	size_t nextToDispatch = 0;
+	size_t nextToDeliver = 0;
+
+	while (nextToDeliver < shards.size())
+	{
+		//dispatch to idle workers within the in-flight window
+		bool hasLiveWorker = false;
+
+		for (size_t indexWorker = 0; indexWorker < vectorWorkers.size(); indexWorker++)
+		{
+			WorkerProcess &worker = vectorWorkers[indexWorker];
+			if (worker.pid <= 0) continue;
+
+			hasLiveWorker = true;
+
+			if (worker.currentShard >= 0 || nextToDispatch >= shards.size() || nextToDispatch >= nextToDeliver + inFlightLimit) continue;
+
+			WireWriter writer;
+			writer.put((uint32_t)nextToDispatch);
+			writer.put((uint32_t)shards[nextToDispatch].size());
+
+			for (size_t indexObject = 0; indexObject < shards[nextToDispatch].size(); indexObject++)
+			{
+				std::string szUid;
+				m_backend.tagToUid(shards[nextToDispatch][indexObject], szUid);
+				writer.putString(szUid);
+			}
+
+			worker.currentShard = (long)nextToDispatch;
+			hmShardResults[nextToDispatch] = ShardResult();
+			nextToDispatch++;
+
+			if (!sendAll(worker.fdSocket, writer.buffer())) failWorker(worker);
+		}
+
+		//no worker left: the remaining shards fail
+		if (!hasLiveWorker)
+		{
+			for (; nextToDispatch < shards.size(); nextToDispatch++)
+			{
+				ShardResult &shardResult = hmShardResults[nextToDispatch];
+				shardResult.iFail = IL9_AUDIT_SCAN_WORKER_FAILED;
+				shardResult.isDone = true;
+			}
+		}
+
+		//deliver completed shards in order
+		std::map<size_t, ShardResult>::iterator itShardResult = hmShardResults.find(nextToDeliver);
+
+		if (itShardResult != hmShardResults.end() && itShardResult->second.isDone)
+		{
+			deliverShard(nextToDeliver, itShardResult->second, shards[nextToDeliver], onResult, failures);
+			hmShardResults.erase(itShardResult);
+			nextToDeliver++;
+			continue;
+		}
+
+		//wait for output of the busy workers
+		std::vector<pollfd> vectorPollFds;
+		std::vector<size_t> vectorPolledWorkers;
+
+		for (size_t indexWorker = 0; indexWorker < vectorWorkers.size(); indexWorker++)
+		{
+			if (vectorWorkers[indexWorker].pid <= 0 || vectorWorkers[indexWorker].currentShard < 0) continue;
+
+			pollfd pollFd;
+			pollFd.fd = vectorWorkers[indexWorker].fdSocket;
+			pollFd.events = POLLIN;
+			pollFd.revents = 0;
+
+			vectorPollFds.push_back(pollFd);
+			vectorPolledWorkers.push_back(indexWorker);
+		}
+
+		if (vectorPollFds.empty()) continue;
+
+		if (::poll(vectorPollFds.data(), (nfds_t)vectorPollFds.size(), -1) < 0)
+		{
+			if (errno == EINTR) continue;
+
+			//the busy workers can no longer be observed, their shards fail
+			logger->error("Could not wait for audit scan worker processes");
+
+			for (size_t indexPoll = 0; indexPoll < vectorPolledWorkers.size(); indexPoll++) failWorker(vectorWorkers[vectorPolledWorkers[indexPoll]]);
+			continue;
+		}
+
+		for (size_t indexPoll = 0; indexPoll < vectorPollFds.size(); indexPoll++)
+		{
+			if (vectorPollFds[indexPoll].revents == 0) continue;
+
+			WorkerProcess &worker = vectorWorkers[vectorPolledWorkers[indexPoll]];
+
+			char acBuffer[64 * 1024];
+			ssize_t numRead = ::read(worker.fdSocket, acBuffer, sizeof(acBuffer));
+
+			if (numRead < 0 && errno == EINTR) continue;
+
+			if (numRead <= 0)
+			{
+				logger->error("Audit scan worker process exited while scanning a shard");
+				failWorker(worker);
+				continue;
+			}
+
+			worker.szBuffer.append(acBuffer, (size_t)numRead);
+
+			bool isValidOutput = false;
+
+			try
+			{
+				isValidOutput = consumeWorkerOutput(worker, hmShardResults[(size_t)worker.currentShard], m_backend);
+			}
+			catch (IFail &)
+			{
+				isValidOutput = false;
+			}
+
+			if (!isValidOutput)
+			{
+				logger->error("Audit scan worker process sent an invalid record");
+				failWorker(worker);
+			}
+		}
+	}
+
+	//closing the socket ends the worker loop
+	for (size_t indexWorker = 0; indexWorker < vectorWorkers.size(); indexWorker++)
+	{
+		if (vectorWorkers[indexWorker].pid > 0) stopWorker(vectorWorkers[indexWorker], false);
+	}
+}
+
+int il9::utils::AuditLog::il9_runAuditScanWorker(int fdEngine, AuditScanBackend &backend)
+{
+	date_t dtLoggedAfterDate = NULLDATE;
+	std::string strEventTypeName;
+	std::vector< ValidatePropertyInput > propNamesToValidate;
+
+	if (!readScanJob(fdEngine, dtLoggedAfterDate, strEventTypeName, propNamesToValidate)) return 1;
+
+	if (backend.openWorkerSession() != ITK_ok) return 1;
+
+	WireWriter writer;
+
+	for (;;)
+	{
+		uint32_t header[2] = { 0, 0 };
+		if (!readExact(fdEngine, (char *)header, sizeof(header))) break;
+
+		//object UIDs of the shard, the ones which do not resolve are reported back instead of being scanned
+		std::vector<tag_t> vectorObjectTags;
+		vectorObjectTags.reserve(header[1]);
+
+		bool isValidShard = true;
+		writer.clear();
+
+		for (uint32_t indexObject = 0; indexObject < header[1] && isValidShard; indexObject++)
+		{
+			std::string szUid;
+			isValidShard = readString(fdEngine, szUid);
+
+			if (!isValidShard) break;
+
+			tag_t tObjectTag = NULLTAG;
+			int iObjectFail = backend.uidToTag(szUid, tObjectTag);
+
+			if (iObjectFail == ITK_ok && tObjectTag != NULLTAG)
+			{
+				vectorObjectTags.push_back(tObjectTag);
+				continue;
+			}
+
+			writer.put((uint8_t)'F');
+			writer.put(indexObject);
+			writer.put((int32_t)((iObjectFail != ITK_ok) ? iObjectFail : IL9_AUDIT_SCAN_OBJECT_NOT_FOUND));
+		}
+
+		if (!isValidShard) break;
+
+		std::map< tag_t, std::vector< PropertyInfo > > modifiedPropertiesByObject;
+		int iFail = backend.getModifiedPropertiesInfo(vectorObjectTags, dtLoggedAfterDate, strEventTypeName, propNamesToValidate, modifiedPropertiesByObject);
+
+		for (size_t indexObject = 0; indexObject < vectorObjectTags.size() && iFail == ITK_ok; indexObject++)
+		{
+			std::map< tag_t, std::vector< PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.find(vectorObjectTags[indexObject]);
+			if (itObject == modifiedPropertiesByObject.end()) continue;
+
+			std::string szUid;
+			backend.tagToUid(itObject->first, szUid);
+
+			writer.put((uint8_t)'O');
+			writer.putString(szUid);
+			writer.put((uint32_t)itObject->second.size());
+
+			for (size_t indexProperty = 0; indexProperty < itObject->second.size(); indexProperty++)
+			{
+				writer.putString(itObject->second[indexProperty].szPropertyName);
+				encodeValue(itObject->second[indexProperty].szCurrentValue, backend, writer);
+				encodeValue(itObject->second[indexProperty].szOldValue, backend, writer);
+			}
+		}
+
+		writer.put((uint8_t)'E');
+		writer.put((int32_t)iFail);
+
+		if (!sendAll(fdEngine, writer.buffer())) break;
+	}
+
+	backend.closeWorkerSession();
+
+	return 0;
+}
+
+#endif
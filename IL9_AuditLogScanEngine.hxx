@@ -0,0 +1,104 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogScanEngine.hxx
+* Description:  This file contains declarations of the multi-process scan engine of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGSCANENGINE_HXX
+#define IL9_AUDITLOGSCANENGINE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogBackend.hxx"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//error reported for a shard whose worker process exited or broke the protocol
+			const int IL9_AUDIT_SCAN_WORKER_FAILED = 919001;
+
+			//error reported for an object whose UID the worker could not resolve to a tag of its session
+			const int IL9_AUDIT_SCAN_OBJECT_NOT_FOUND = 919007;
+
+			//worker program searched on the PATH when neither szWorkerPath nor IL9_AUDIT_SCAN_WORKER is set
+			const char *const IL9_AUDIT_SCAN_WORKER_EXECUTABLE = "IL9_AuditLogScanWorker";
+
+			struct AuditScanOptions
+			{
+				int iNumOfWorkers = 1;			//worker processes, 1 or less runs the shards in the calling process
+				int iShardSize = 2000;			//objects per shard handed to a worker
+				int iMaxPendingShards = 4;		//completed shards buffered ahead of the shard being delivered
+				int iMaxWorkerRestarts = 2;		//replacements started for workers which died
+				std::string szWorkerPath;		//worker executable, IL9_AUDIT_SCAN_WORKER or IL9_AUDIT_SCAN_WORKER_EXECUTABLE when empty
+			};
+
+			//a failed shard with all its objects, or a single object of a shard which the worker could not resolve
+			struct AuditScanShardFailure
+			{
+				size_t shardIndex = 0;
+				int iFail = ITK_ok;
+				std::vector<tag_t> objectTags;
+			};
+
+			//receives the modified properties of one object, objects are delivered in the order of the input list
+			typedef std::function<void(tag_t tObjectTag, std::vector< PropertyInfo > &modifiedProperties)> AuditScanResultCallback;
+
+			/**
+			* Shards an object list and scans the shards in parallel worker processes. Workers are separate executables
+			* (see il9_runAuditScanWorker) started with posix_spawn, each logs in with its own ITK session; nothing of the
+			* calling process but its environment is inherited. The backend of the engine only converts tags to UIDs and back.
+			* Workers stream their results back over a socket pair; results are merged and delivered in input order. At most iNumOfWorkers + iMaxPendingShards shards are in flight ahead of the next shard to
+			* deliver, so a slow consumer or slow shard holds back dispatching instead of buffering the whole scan.
+			*
+			* A shard whose worker fails is reported in failures and does not stop the other shards; an object the worker cannot
+			* resolve is reported there on its own while the rest of its shard is delivered. On Windows and with
+			* iNumOfWorkers <= 1 all shards run in the calling process, through the backend, with the same ordering and isolation.
+			*/
+			class AuditScanEngine
+			{
+			public:
+				AuditScanEngine(AuditScanBackend &backend, const AuditScanOptions &options) : m_backend(backend), m_options(options) {}
+
+				int run(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+					std::vector< AuditScanShardFailure > &failures);
+
+			private:
+				void runInProcess(const std::vector< std::vector<tag_t> > &shards, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+					std::vector< AuditScanShardFailure > &failures);
+
+				void runInWorkers(const std::vector< std::vector<tag_t> > &shards, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, const AuditScanResultCallback &onResult,
+					std::vector< AuditScanShardFailure > &failures);
+
+				AuditScanBackend &m_backend;
+				AuditScanOptions m_options;
+			};
+
+#ifndef _WIN32
+			/**
+			* Body of a worker executable: reads the scan job and then shards from fdEngine (the stdin the engine passed),
+			* opens the ITK session through the backend and answers every shard on the same socket until the engine closes it.
+			* Returns the exit code of the worker.
+			*/
+			int il9_runAuditScanWorker(int fdEngine, AuditScanBackend &backend);
+#endif
+		}
+	}
+}
+
+#endif
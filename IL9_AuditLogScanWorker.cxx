@@ -0,0 +1,34 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogScanWorker.cxx
+* Description:  This file contains the worker executable of the scan engine of the
+*				Audit Logs utilities
+*
+*				Build: link with the module sources and itk_main like other ITK batch
+*				programs, install as IL9_AuditLogScanWorker on the PATH of the
+*				scanning process or set IL9_AUDIT_SCAN_WORKER.
+*
+*				Started by AuditScanEngine only: stdin is the socket to the engine.
+*				Logs in with ITK_auto_login (TC_USER_ID/TC_USER_PASSWORD/TC_GROUP or
+*				the auto login settings of the environment).
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogScanEngine.hxx"
+#include "IL9_AuditLogBackend.hxx"
+
+#include <tc/tc.h>
+
+#include <unistd.h>
+
+int ITK_user_main(int, char *[])
+{
+	il9::utils::AuditLog::ItkAuditScanBackend backend;
+
+	return il9::utils::AuditLog::il9_runAuditScanWorker(STDIN_FILENO, backend);
+}
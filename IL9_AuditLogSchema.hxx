@@ -0,0 +1,341 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSchema.hxx
+* Description:  This file contains the compile time typed property schema of the Audit
+*				Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGSCHEMA_HXX
+#define IL9_AUDITLOGSCHEMA_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+
+#include <pom/pom/pom.h>
+
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+* Declares a tracked property for an AuditPropertySchema.
+*
+*	IL9_AUDIT_PROPERTY(StockingType, "il9_stocking_type", "il9_stocking_typeOvl", POM_string);
+*	IL9_AUDIT_PROPERTY(ShelfLifeDuration, "il9_shelf_life_duration", "il9_shelf_life_durationOvl", POM_int);
+*	typedef il9::utils::AuditLog::AuditPropertySchema<StockingType, ShelfLifeDuration> MaterialAuditSchema;
+*/
+#define IL9_AUDIT_PROPERTY(StructName, PropertyName, PropertyNameOld, PomType) \
+	struct StructName \
+	{ \
+		static constexpr const char *szPropertyName = PropertyName; \
+		static constexpr const char *szPropertyNameOld = PropertyNameOld; \
+		static constexpr int iType = PomType; \
+	}
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			/**
+			* Type specialized comparison of an old value cell of the enquiry result against the current value of the
+			* snapshot. A NULL old value cell and a NULL current value are both read as the default value of the type
+			* (empty string, 0, false, NULLDATE, NULLTAG).
+			*/
+			template <int iType>
+			struct AuditColumnComparator;
+
+			template <>
+			struct AuditColumnComparator<POM_string>
+			{
+				static std::string_view oldValue(const void *pOldCell) { return pOldCell != NULL ? std::string_view((const char *)pOldCell) : std::string_view(); }
+				static std::string_view currentValue(const SnapshotValue &current) { return !current.isNull ? std::string_view(current.szValue) : std::string_view(); }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current) { return oldValue(pOldCell) != currentValue(current); }
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = std::string(currentValue(current));
+					propertyInfo.szOldValue = std::string(oldValue(pOldCell));
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_logical>
+			{
+				static logical oldValue(const void *pOldCell) { return pOldCell != NULL ? *((const logical *)pOldCell) : false; }
+				static logical currentValue(const SnapshotValue &current) { return !current.isNull ? current.lValue : false; }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current) { return oldValue(pOldCell) != currentValue(current); }
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = currentValue(current);
+					propertyInfo.szOldValue = oldValue(pOldCell);
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_int>
+			{
+				static int oldValue(const void *pOldCell) { return pOldCell != NULL ? *((const int *)pOldCell) : 0; }
+				static int currentValue(const SnapshotValue &current) { return !current.isNull ? current.iValue : 0; }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current) { return oldValue(pOldCell) != currentValue(current); }
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = currentValue(current);
+					propertyInfo.szOldValue = oldValue(pOldCell);
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_double>
+			{
+				static double oldValue(const void *pOldCell) { return pOldCell != NULL ? *((const double *)pOldCell) : 0.0; }
+				static double currentValue(const SnapshotValue &current) { return !current.isNull ? current.dValue : 0.0; }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current) { return oldValue(pOldCell) != currentValue(current); }
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = currentValue(current);
+					propertyInfo.szOldValue = oldValue(pOldCell);
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_date>
+			{
+				static date_t oldValue(const void *pOldCell) { return pOldCell != NULL ? *((const date_t *)pOldCell) : NULLDATE; }
+				static date_t currentValue(const SnapshotValue &current) { return !current.isNull ? current.dtValue : NULLDATE; }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current)
+				{
+					//field wise comparison, same result as POM_compare_dates without the ITK call
+					date_t dtOldValue = oldValue(pOldCell);
+					date_t dtCurrentValue = currentValue(current);
+					return dtOldValue.year != dtCurrentValue.year || dtOldValue.month != dtCurrentValue.month || dtOldValue.day != dtCurrentValue.day
+						|| dtOldValue.hour != dtCurrentValue.hour || dtOldValue.minute != dtCurrentValue.minute || dtOldValue.second != dtCurrentValue.second;
+				}
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = currentValue(current);
+					propertyInfo.szOldValue = oldValue(pOldCell);
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_external_reference>
+			{
+				static tag_t oldValue(const void *pOldCell) { return pOldCell != NULL ? *((const tag_t *)pOldCell) : NULLTAG; }
+				static tag_t currentValue(const SnapshotValue &current) { return !current.isNull ? current.tValue : NULLTAG; }
+				static bool isModified(const void *pOldCell, const SnapshotValue &current) { return oldValue(pOldCell) != currentValue(current); }
+				static void fill(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+				{
+					propertyInfo.szCurrentValue = currentValue(current);
+					propertyInfo.szOldValue = oldValue(pOldCell);
+				}
+			};
+
+			template <>
+			struct AuditColumnComparator<POM_typed_reference> : AuditColumnComparator<POM_external_reference> {};
+
+			template <>
+			struct AuditColumnComparator<POM_untyped_reference> : AuditColumnComparator<POM_external_reference> {};
+
+			//compares one column and boxes the values into propertyInfo only when the property is modified
+			template <int iType>
+			bool il9_checkAuditColumn(const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+			{
+				if (!AuditColumnComparator<iType>::isModified(pOldCell, current)) return false;
+
+				AuditColumnComparator<iType>::fill(pOldCell, current, propertyInfo);
+				return true;
+			}
+
+			//same for a type only known at run time, long strings and unknown types are never reported
+			inline bool il9_checkAuditColumn(int iType, const void *pOldCell, const SnapshotValue &current, PropertyInfo &propertyInfo)
+			{
+				switch (iType)
+				{
+					case(POM_string): return il9_checkAuditColumn<POM_string>(pOldCell, current, propertyInfo);
+					case(POM_logical): return il9_checkAuditColumn<POM_logical>(pOldCell, current, propertyInfo);
+					case(POM_int): return il9_checkAuditColumn<POM_int>(pOldCell, current, propertyInfo);
+					case(POM_double): return il9_checkAuditColumn<POM_double>(pOldCell, current, propertyInfo);
+					case(POM_date): return il9_checkAuditColumn<POM_date>(pOldCell, current, propertyInfo);
+					case(POM_external_reference):
+					case(POM_typed_reference):
+					case(POM_untyped_reference): return il9_checkAuditColumn<POM_external_reference>(pOldCell, current, propertyInfo);
+					default: return false;
+				}
+			}
+
+			/**
+			* Compile time description of a fixed set of tracked properties (see IL9_AUDIT_PROPERTY).
+			*
+			* The property input list (and so the select attributes of the audit enquiry), the result column of every
+			* property and a type specialized comparator per column are generated from the declaration, so evaluating a
+			* result row needs neither the runtime switch on iType nor the std::any boxing of unmodified values.
+			*/
+			template <typename... Properties>
+			class AuditPropertySchema
+			{
+			public:
+				static constexpr size_t size = sizeof...(Properties);
+				static constexpr std::array<int, sizeof...(Properties)> propertyTypes = { { Properties::iType... } };
+
+				//result column of the property value for every property, -1 for long strings which are not selected
+				static constexpr std::array<int, sizeof...(Properties)> columnOffsets = []()
+				{
+					std::array<int, sizeof...(Properties)> offsets = {};
+					int col = 1;
+
+					for (size_t index = 0; index < sizeof...(Properties); index++)
+					{
+						if (propertyTypes[index] == POM_long_string)
+						{
+							offsets[index] = -1;
+						}
+						else
+						{
+							offsets[index] = col;
+							col += 2;
+						}
+					}
+
+					return offsets;
+				}();
+
+				//property input of the schema, built once, in the format of the runtime API
+				static const std::vector< ValidatePropertyInput > &propertyInputs()
+				{
+					static const std::vector< ValidatePropertyInput > inputs = { ValidatePropertyInput{ Properties::szPropertyName, Properties::szPropertyNameOld, Properties::iType }... };
+					return inputs;
+				}
+
+				/**
+				* Evaluates the result row of an object. Non long string properties are compared first, in schema order,
+				* followed by long string properties, same output order as il9_getModifiedPropertiesInfo.
+				*/
+				static void evaluateRow(tag_t tObjectTag, tag_t auditObjectTag, void ***result, int row, const PropertyValueSnapshot &snapshot,
+					int &numOfModifiedProperties, std::vector< PropertyInfo > &modifiedProperties)
+				{
+					evaluateColumns<false>(std::index_sequence_for<Properties...>(), tObjectTag, auditObjectTag, result, row, snapshot, numOfModifiedProperties, modifiedProperties);
+					evaluateColumns<true>(std::index_sequence_for<Properties...>(), tObjectTag, auditObjectTag, result, row, snapshot, numOfModifiedProperties, modifiedProperties);
+				}
+
+			private:
+				template <bool bLongString, size_t... Index>
+				static void evaluateColumns(std::index_sequence<Index...>, tag_t tObjectTag, tag_t auditObjectTag, void ***result, int row,
+					const PropertyValueSnapshot &snapshot, int &numOfModifiedProperties, std::vector< PropertyInfo > &modifiedProperties)
+				{
+					(evaluateColumn<bLongString, Index, Properties>(tObjectTag, auditObjectTag, result, row, snapshot, numOfModifiedProperties, modifiedProperties), ...);
+				}
+
+				template <bool bLongString, size_t Index, typename Property>
+				static void evaluateColumn(tag_t tObjectTag, tag_t auditObjectTag, void ***result, int row, const PropertyValueSnapshot &snapshot,
+					int &numOfModifiedProperties, std::vector< PropertyInfo > &modifiedProperties)
+				{
+					if constexpr (bLongString && Property::iType == POM_long_string)
+					{
+						bool isModified = false;
+						PropertyInfo propertyInfo;
+
+						il9_checkIfLongStringPropertyModified(tObjectTag, auditObjectTag, Property::szPropertyName, Property::szPropertyNameOld, isModified,
+							propertyInfo, &snapshot);
+
+						if (isModified)
+						{
+							propertyInfo.szPropertyName = Property::szPropertyName;
+							modifiedProperties.push_back(std::move(propertyInfo));
+							numOfModifiedProperties++;
+						}
+					}
+					else if constexpr (!bLongString && Property::iType != POM_long_string)
+					{
+						const SnapshotValue *current = snapshot.getValue(tObjectTag, Index);
+						if (current == NULL) return;
+
+						//value column at columnOffsets[Index], old value column next to it
+						const void *pOldCell = result[row][columnOffsets[Index] + 1];
+
+						if (AuditColumnComparator<Property::iType>::isModified(pOldCell, *current))
+						{
+							modifiedProperties.push_back(PropertyInfo());
+							modifiedProperties.back().szPropertyName = Property::szPropertyName;
+							AuditColumnComparator<Property::iType>::fill(pOldCell, *current, modifiedProperties.back());
+							numOfModifiedProperties++;
+						}
+					}
+				}
+			};
+
+			/**
+			* il9_getModifiedPropertiesInfo for a compile time schema, e.g.
+			*	il9_getModifiedPropertiesInfo<MaterialAuditSchema>(tItemRevision, dtLastRelease, "__Modify", numOfModifiedProperties, modifiedProperties);
+			*/
+			template <typename Schema>
+			int il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				int &numOfModifiedProperties, std::vector< PropertyInfo > &modifiedProperties)
+			{
+				int iFail = ITK_ok;
+				Teamcenter::ResultStatus status(0);
+
+				//logger
+				Teamcenter::Logging::Logger *logger = il9_getAuditLogger();
+				AuditLogEntryExit logEntryExit(logger, __func__);
+
+				//profiling
+				AuditProfiledCall profiledCall(__func__, &iFail);
+
+				//journalling
+				AuditJournal journalling(__func__, &iFail);
+				journalling.journalRoutineCall();
+
+				try
+				{
+					int nRows = 0;
+					int nCols = 0;
+					void*** result = NULL;
+
+					status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, Schema::propertyInputs(), IL9_AUDIT_QUERY_BASELINE_ONLY,
+						nRows, nCols, &result);
+
+					if (nRows > 0 && nCols > 1)
+					{
+						tag_t auditObjectTag = *((tag_t *)result[nRows - 1][0]);
+
+						PropertyValueSnapshot currentValues;
+						status = currentValues.load({ tObjectTag }, Schema::propertyInputs());
+
+						Schema::evaluateRow(tObjectTag, auditObjectTag, result, nRows - 1, currentValues, numOfModifiedProperties, modifiedProperties);
+
+						journalling.setOutput("numOfModifiedProperties", numOfModifiedProperties);
+						journalling.journalRoutineCall();
+					}
+
+					if (result != NULL) MEM_free(result);
+				}
+				catch (IFail &exception)
+				{
+					iFail = exception.ifail();
+					logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+				}
+
+				return iFail;
+			}
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,280 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogService.cxx
+* Description:  This file contains definitions of the coalescing audit query service
+*				of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogService.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	bool isSelected(const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesSelected, const std::string &szPropertyName)
+	{
+		for (size_t indexProp = 0; indexProp < propNamesSelected.size(); indexProp++)
+		{
+			if (propNamesSelected[indexProp].szPropertyName == szPropertyName) return true;
+		}
+
+		return false;
+	}
+
+	bool isCovered(const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesSelected,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+		{
+			if (!isSelected(propNamesSelected, propNamesToValidate[indexProp].szPropertyName)) return false;
+		}
+
+		return true;
+	}
+
+	void mergeProperties(std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesSelected,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+		{
+			if (!isSelected(propNamesSelected, propNamesToValidate[indexProp].szPropertyName)) propNamesSelected.push_back(propNamesToValidate[indexProp]);
+		}
+	}
+
+	/**
+	* Appends the share of a lookup result requested by propNamesToValidate in the order il9_getModifiedPropertiesInfo
+	* reports it: non long string properties in input order followed by long string properties, each name once.
+	*/
+	int appendRequestedProperties(const std::vector< il9::utils::AuditLog::PropertyInfo > &lookupProperties,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+	{
+		if (lookupProperties.empty()) return 0;
+
+		std::unordered_map<std::string, const il9::utils::AuditLog::PropertyInfo *> hmPropertyByName;
+		hmPropertyByName.reserve(lookupProperties.size());
+
+		for (size_t indexProp = 0; indexProp < lookupProperties.size(); indexProp++)
+		{
+			hmPropertyByName.emplace(lookupProperties[indexProp].szPropertyName, &lookupProperties[indexProp]);
+		}
+
+		int numOfAppended = 0;
+		std::unordered_set<std::string> hsAppendedPropertyNames;
+
+		for (int isLongStringPass = 0; isLongStringPass < 2; isLongStringPass++)
+		{
+			for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+			{
+				if ((propNamesToValidate[indexProp].iType == POM_long_string) != (isLongStringPass == 1)) continue;
+
+				std::unordered_map<std::string, const il9::utils::AuditLog::PropertyInfo *>::const_iterator itProperty =
+					hmPropertyByName.find(propNamesToValidate[indexProp].szPropertyName);
+
+				if (itProperty == hmPropertyByName.end() || !hsAppendedPropertyNames.insert(itProperty->first).second) continue;
+
+				modifiedProperties.push_back(*itProperty->second);
+				numOfAppended++;
+			}
+		}
+
+		return numOfAppended;
+	}
+}
+
+bool il9::utils::AuditLog::AuditQueryService::LookupKey::operator<(const LookupKey &other) const
+{
+	return std::tie(tObjectTag, dtLoggedAfterDate.year, dtLoggedAfterDate.month, dtLoggedAfterDate.day, dtLoggedAfterDate.hour, dtLoggedAfterDate.minute,
+		dtLoggedAfterDate.second, strEventTypeName) < std::tie(other.tObjectTag, other.dtLoggedAfterDate.year, other.dtLoggedAfterDate.month,
+		other.dtLoggedAfterDate.day, other.dtLoggedAfterDate.hour, other.dtLoggedAfterDate.minute, other.dtLoggedAfterDate.second, other.strEventTypeName);
+}
+
+il9::utils::AuditLog::AuditQueryService::AuditQueryService(const AuditQueryServiceOptions &options)
+	: m_options(options), m_numOfPending(0)
+{
+}
+
+int il9::utils::AuditLog::AuditQueryService::getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+	const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, int &numOfModifiedProperties,
+	std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+{
+	int iFail = ITK_ok;
+
+	//logger and journal are not thread safe, they are written under m_executionMutex which is never held while a request waits
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	std::optional<il9::utils::AuditLog::AuditLogEntryExit> logEntryExit;
+	std::optional<il9::utils::AuditLog::AuditJournal> journalling;
+
+	{
+		std::lock_guard<std::mutex> executionLock(m_executionMutex);
+
+		//logger
+		logEntryExit.emplace(logger, __func__);
+
+		//journalling
+		journalling.emplace(__func__, &iFail);
+		journalling->journalRoutineCall();
+	}
+
+	LookupKey key = { tObjectTag, dtLoggedAfterDate, strEventTypeName };
+	std::shared_ptr<Lookup> lookup;
+	bool isLeader = false;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_statistics.requests++;
+
+	if (m_numOfPending >= m_options.iMaxPendingRequests)
+	{
+		m_statistics.rejected++;
+		lock.unlock();
+
+		iFail = IL9_AUDIT_SERVICE_OVERLOADED;
+
+		std::lock_guard<std::mutex> executionLock(m_executionMutex);
+		logger->warn("audit query service overloaded, request rejected");
+
+		journalling.reset();
+		logEntryExit.reset();
+
+		return iFail;
+	}
+
+	m_numOfPending++;
+	m_statistics.maxPending = std::max(m_statistics.maxPending, m_numOfPending);
+
+	LookupSlot &slot = m_slots[key];
+
+	if (slot.running && isCovered(slot.running->propNamesToValidate, propNamesToValidate))
+	{
+		lookup = slot.running;
+		m_statistics.coalesced++;
+	}
+	else if (slot.queued)
+	{
+		mergeProperties(slot.queued->propNamesToValidate, propNamesToValidate);
+		lookup = slot.queued;
+		m_statistics.merged++;
+	}
+	else
+	{
+		lookup = std::make_shared<Lookup>();
+		lookup->propNamesToValidate = propNamesToValidate;
+		isLeader = true;
+
+		if (slot.running) slot.queued = lookup;
+		else slot.running = lookup;
+	}
+
+	if (isLeader) execute(key, lookup, lock);
+
+	m_cvLookupDone.wait(lock, [&lookup]() { return lookup->isDone; });
+	m_numOfPending--;
+	lock.unlock();
+
+	//the result of a finished lookup is not modified any more
+	iFail = lookup->iFail;
+
+	if (iFail == ITK_ok && !lookup->exception) numOfModifiedProperties += appendRequestedProperties(lookup->modifiedProperties, propNamesToValidate, modifiedProperties);
+
+	std::lock_guard<std::mutex> executionLock(m_executionMutex);
+
+	if (lookup->exception)
+	{
+		journalling.reset();
+		logEntryExit.reset();
+
+		std::rethrow_exception(lookup->exception);
+	}
+
+	//journalling
+	journalling->setOutput("numOfModifiedProperties", numOfModifiedProperties);
+	journalling->setOutput("isCoalesced", (int)!isLeader);
+	journalling->journalRoutineCall();
+
+	journalling.reset();
+	logEntryExit.reset();
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::AuditQueryService::execute(const LookupKey &key, const std::shared_ptr<Lookup> &lookup, std::unique_lock<std::mutex> &lock)
+{
+	//a queued lookup starts once the running lookup of its key has finished and promoted it
+	m_cvLookupDone.wait(lock, [this, &key, &lookup]() { return m_slots[key].running == lookup; });
+
+	//properties of a running lookup are no longer merged into
+	std::vector< ValidatePropertyInput > propNamesToValidate = lookup->propNamesToValidate;
+	m_statistics.lookups++;
+
+	lock.unlock();
+
+	int iFail = ITK_ok;
+	std::exception_ptr lookupException;
+	int numOfModifiedProperties = 0;
+	std::vector< PropertyInfo > modifiedProperties;
+
+	try
+	{
+		std::lock_guard<std::mutex> executionLock(m_executionMutex);
+
+		iFail = il9_getModifiedPropertiesInfo(key.tObjectTag, key.dtLoggedAfterDate, key.strEventTypeName, propNamesToValidate, numOfModifiedProperties,
+			modifiedProperties);
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+	}
+	catch (...)
+	{
+		//the lookup is finished as failed below, its requests must not wait forever and rethrow the exception
+		lookupException = std::current_exception();
+		modifiedProperties.clear();
+	}
+
+	lock.lock();
+
+	lookup->iFail = iFail;
+	lookup->exception = lookupException;
+	lookup->modifiedProperties.swap(modifiedProperties);
+	lookup->isDone = true;
+
+	std::map< LookupKey, LookupSlot >::iterator itSlot = m_slots.find(key);
+	itSlot->second.running = itSlot->second.queued;
+	itSlot->second.queued.reset();
+
+	if (!itSlot->second.running) m_slots.erase(itSlot);
+
+	m_cvLookupDone.notify_all();
+}
+
+void il9::utils::AuditLog::AuditQueryService::getStatistics(il9::utils::AuditLog::AuditQueryServiceStatistics &statistics)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	statistics = m_statistics;
+}
+
+il9::utils::AuditLog::AuditQueryService &il9::utils::AuditLog::il9_getAuditQueryService()
+{
+	static AuditQueryService service;
+
+	return service;
+}
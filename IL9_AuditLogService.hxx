@@ -0,0 +1,125 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogService.hxx
+* Description:  This file contains declarations of the coalescing audit query service
+*				of the Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGSERVICE_HXX
+#define IL9_AUDITLOGSERVICE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//error returned when a request would exceed iMaxPendingRequests of the service
+			const int IL9_AUDIT_SERVICE_OVERLOADED = 919003;
+
+			struct AuditQueryServiceOptions
+			{
+				int iMaxPendingRequests = 256;	//requests in the service at a time, further requests fail with IL9_AUDIT_SERVICE_OVERLOADED
+			};
+
+			struct AuditQueryServiceStatistics
+			{
+				long requests = 0;
+				long lookups = 0;		//lookups executed against the database
+				long coalesced = 0;		//requests served by a running lookup covering their properties
+				long merged = 0;		//requests whose properties were merged into a queued lookup
+				long rejected = 0;		//requests failed with IL9_AUDIT_SERVICE_OVERLOADED
+				int maxPending = 0;		//high water mark of the requests in the service
+			};
+
+			/**
+			* Serves il9_getModifiedPropertiesInfo to concurrent handlers with single flight coalescing.
+			*
+			* Lookups are keyed by (object, event type, logged after date). While a lookup runs, a request for the same key
+			* whose properties are all selected by it waits for it and takes its share of the result. Other requests for the
+			* key are merged into one queued lookup selecting the union of their properties, which runs once the running
+			* lookup has finished; at most one lookup per key is queued. Every request receives exactly the properties it
+			* asked for, in the order il9_getModifiedPropertiesInfo reports them.
+			*
+			* ITK and the session caches of these utilities are not thread safe, lookups are therefore executed one at a
+			* time. Threads must not call the utilities directly while others use the service. An exception other than IFail
+			* thrown by a lookup is rethrown to every request which waited for it.
+			*/
+			class AuditQueryService
+			{
+			public:
+				explicit AuditQueryService(const AuditQueryServiceOptions &options = AuditQueryServiceOptions());
+
+				AuditQueryService(const AuditQueryService &) = delete;
+				AuditQueryService &operator=(const AuditQueryService &) = delete;
+
+				//same contract as il9_getModifiedPropertiesInfo, safe to call from multiple threads
+				int getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, int &numOfModifiedProperties,
+					std::vector< PropertyInfo > &modifiedProperties);
+
+				void getStatistics(AuditQueryServiceStatistics &statistics);
+
+			private:
+				struct LookupKey
+				{
+					tag_t tObjectTag;
+					date_t dtLoggedAfterDate;
+					std::string strEventTypeName;
+
+					bool operator<(const LookupKey &other) const;
+				};
+
+				//one execution of il9_getModifiedPropertiesInfo shared by the requests which joined it
+				struct Lookup
+				{
+					std::vector< ValidatePropertyInput > propNamesToValidate;
+					bool isDone = false;
+					int iFail = ITK_ok;
+					std::exception_ptr exception;		//set when the lookup threw something other than IFail
+					std::vector< PropertyInfo > modifiedProperties;
+				};
+
+				struct LookupSlot
+				{
+					std::shared_ptr<Lookup> running;
+					std::shared_ptr<Lookup> queued;
+				};
+
+				//runs a lookup the caller leads, m_mutex is held by lock on entry and on return
+				void execute(const LookupKey &key, const std::shared_ptr<Lookup> &lookup, std::unique_lock<std::mutex> &lock);
+
+				AuditQueryServiceOptions m_options;
+
+				std::mutex m_mutex;					//guards the slots, counters and statistics
+				std::condition_variable m_cvLookupDone;
+				std::map< LookupKey, LookupSlot > m_slots;
+				int m_numOfPending;
+				AuditQueryServiceStatistics m_statistics;
+
+				std::mutex m_executionMutex;		//held while a lookup runs or a request logs or journals, lookups of different keys run one at a time
+			};
+
+			//process wide service with default options
+			AuditQueryService &il9_getAuditQueryService();
+		}
+	}
+}
+
+#endif
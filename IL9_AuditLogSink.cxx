@@ -0,0 +1,388 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSink.cxx
+* Description:  This file contains definitions of the streaming output sinks of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogSink.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_BusinessObjectUtils.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <sa/audit.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <cmath>
+#include <cstdio>
+#include <string_view>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	bool isStringType(int iType)
+	{
+		return iType == POM_string || iType == POM_long_string;
+	}
+
+	//numbers and logicals are not quoted in JSON
+	bool isLiteralType(int iType)
+	{
+		return iType == POM_logical || iType == POM_int || iType == POM_double;
+	}
+
+	//values without text, written as empty CSV fields and JSON null
+	bool isNullText(const il9::utils::AuditLog::AuditValue &value)
+	{
+		if (value.isNull()) return true;
+
+		switch (value.getType())
+		{
+			case(POM_string):
+			case(POM_long_string):
+			case(POM_logical):
+			case(POM_int):
+			case(POM_date):
+				return false;
+			case(POM_double):
+				//JSON has no representation for infinities and NaN
+				return !std::isfinite(value.asDouble());
+			case(POM_external_reference):
+			case(POM_typed_reference):
+			case(POM_untyped_reference):
+				return value.asTag() == NULLTAG;
+			default:
+				return true;
+		}
+	}
+
+	/**
+	* Passes the text of the value to visitPiece, long string lists piece by piece with their delimiter in between so
+	* that they are never joined. Scalars are formatted into a stack buffer, references are written as PUIDs.
+	*/
+	template <typename PieceVisitor>
+	void visitAuditValueText(const il9::utils::AuditLog::AuditValue &value, PieceVisitor &&visitPiece)
+	{
+		if (isNullText(value)) return;
+
+		char szBuffer[32];
+
+		switch (value.getType())
+		{
+			case(POM_string):
+			{
+				visitPiece(value.asStringView());
+				break;
+			}
+			case(POM_long_string):
+			{
+				char cDelimiter = value.getDelimiter();
+
+				for (size_t indexValue = 0; indexValue < value.listSize(); indexValue++)
+				{
+					if (indexValue > 0) visitPiece(std::string_view(&cDelimiter, 1));
+					visitPiece(value.listValue(indexValue));
+				}
+
+				break;
+			}
+			case(POM_logical):
+			{
+				visitPiece(value.asLogical() ? "true" : "false");
+				break;
+			}
+			case(POM_int):
+			{
+				int length = snprintf(szBuffer, sizeof(szBuffer), "%d", value.asInt());
+				visitPiece(std::string_view(szBuffer, (size_t)length));
+				break;
+			}
+			case(POM_double):
+			{
+				int length = snprintf(szBuffer, sizeof(szBuffer), "%.17g", value.asDouble());
+				visitPiece(std::string_view(szBuffer, (size_t)length));
+				break;
+			}
+			case(POM_date):
+			{
+				visitPiece(il9::utils::AuditLog::il9_formatAuditDate(value.asDate()));
+				break;
+			}
+			default:
+			{
+				//references, null tags are handled above
+				visitPiece(getPUID(value.asTag()));
+			}
+		}
+	}
+
+	void writePiece(std::ostream &output, std::string_view svPiece)
+	{
+		output.write(svPiece.data(), (std::streamsize)svPiece.size());
+	}
+
+	//quotes the piece as per RFC 4180, doubling embedded quotes
+	void writeCsvQuotedPiece(std::ostream &output, std::string_view svPiece)
+	{
+		size_t start = 0;
+
+		for (size_t quote = svPiece.find('"'); quote != std::string_view::npos; quote = svPiece.find('"', start))
+		{
+			writePiece(output, svPiece.substr(start, quote + 1 - start));
+			output.put('"');
+			start = quote + 1;
+		}
+
+		writePiece(output, svPiece.substr(start));
+	}
+
+	void writeCsvValue(std::ostream &output, const il9::utils::AuditLog::AuditValue &value)
+	{
+		//only (long) string values can hold separators or quotes, and comma separated lists always need quoting
+		bool isQuoted = false;
+
+		if (isStringType(value.getType()))
+		{
+			visitAuditValueText(value, [&isQuoted](std::string_view svPiece) {
+				if (svPiece.find_first_of(",\"\r\n") != std::string_view::npos) isQuoted = true;
+			});
+		}
+
+		if (!isQuoted)
+		{
+			visitAuditValueText(value, [&output](std::string_view svPiece) { writePiece(output, svPiece); });
+			return;
+		}
+
+		output.put('"');
+		visitAuditValueText(value, [&output](std::string_view svPiece) { writeCsvQuotedPiece(output, svPiece); });
+		output.put('"');
+	}
+
+	void writeJsonEscapedPiece(std::ostream &output, std::string_view svPiece)
+	{
+		size_t start = 0;
+
+		for (size_t index = 0; index < svPiece.size(); index++)
+		{
+			unsigned char cValue = (unsigned char)svPiece[index];
+			if (cValue >= 0x20 && cValue != '"' && cValue != '\\') continue;
+
+			writePiece(output, svPiece.substr(start, index - start));
+			start = index + 1;
+
+			switch (cValue)
+			{
+				case('"'): output << "\\\""; break;
+				case('\\'): output << "\\\\"; break;
+				case('\n'): output << "\\n"; break;
+				case('\r'): output << "\\r"; break;
+				case('\t'): output << "\\t"; break;
+				default:
+				{
+					char szEscaped[8];
+					snprintf(szEscaped, sizeof(szEscaped), "\\u%04x", (unsigned int)cValue);
+					output << szEscaped;
+				}
+			}
+		}
+
+		writePiece(output, svPiece.substr(start));
+	}
+
+	void writeJsonString(std::ostream &output, std::string_view svValue)
+	{
+		output.put('"');
+		writeJsonEscapedPiece(output, svValue);
+		output.put('"');
+	}
+
+	void writeJsonValue(std::ostream &output, const il9::utils::AuditLog::AuditValue &value)
+	{
+		if (isNullText(value))
+		{
+			output << "null";
+			return;
+		}
+
+		bool isQuoted = !isLiteralType(value.getType());
+
+		if (isQuoted) output.put('"');
+		visitAuditValueText(value, [&output](std::string_view svPiece) { writeJsonEscapedPiece(output, svPiece); });
+		if (isQuoted) output.put('"');
+	}
+
+	//passes the modified properties of the baseline row to the sink
+	class SinkBaselineVisitor : public il9::utils::AuditLog::AuditBaselineVisitor
+	{
+	public:
+		SinkBaselineVisitor(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+			const il9::utils::AuditLog::PropertyValueSnapshot &currentValues, il9::utils::AuditLog::AuditDiffSink &sink)
+			: m_propNamesToValidate(propNamesToValidate), m_currentValues(currentValues), m_sink(sink)
+		{
+			m_propertyInfo.objectTag = tObjectTag;
+		}
+
+		const il9::utils::AuditLog::SnapshotValue *currentValueOf(size_t indexPropInput) override
+		{
+			return m_currentValues.getValue(m_propertyInfo.objectTag, indexPropInput);
+		}
+
+		void onModifiedProperty(size_t indexPropInput, const il9::utils::AuditLog::AuditValue &currentValue,
+			const il9::utils::AuditLog::AuditValue &oldValue) override
+		{
+			m_propertyInfo.szPropertyName = m_propNamesToValidate[indexPropInput].szPropertyName;
+			m_propertyInfo.currentValue = currentValue;
+			m_propertyInfo.oldValue = oldValue;
+
+			m_sink.onModifiedProperty(m_propertyInfo);
+		}
+
+	private:
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &m_propNamesToValidate;
+		const il9::utils::AuditLog::PropertyValueSnapshot &m_currentValues;
+		il9::utils::AuditLog::AuditDiffSink &m_sink;
+		il9::utils::AuditLog::CompactPropertyInfo m_propertyInfo;
+	};
+}
+
+il9::utils::AuditLog::AuditCsvDiffWriter::AuditCsvDiffWriter(std::ostream &output, bool isHeaderWritten)
+	: m_output(output), m_numOfRows(0)
+{
+	if (isHeaderWritten) m_output << "object,property,current_value,old_value\n";
+}
+
+void il9::utils::AuditLog::AuditCsvDiffWriter::onModifiedProperty(const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo)
+{
+	m_output << getPUID(propertyInfo.objectTag);
+	m_output.put(',');
+
+	if (propertyInfo.szPropertyName.find_first_of(",\"\r\n") == std::string_view::npos) writePiece(m_output, propertyInfo.szPropertyName);
+	else
+	{
+		m_output.put('"');
+		writeCsvQuotedPiece(m_output, propertyInfo.szPropertyName);
+		m_output.put('"');
+	}
+
+	m_output.put(',');
+	writeCsvValue(m_output, propertyInfo.currentValue);
+	m_output.put(',');
+	writeCsvValue(m_output, propertyInfo.oldValue);
+	m_output.put('\n');
+
+	m_numOfRows++;
+}
+
+il9::utils::AuditLog::AuditJsonDiffWriter::AuditJsonDiffWriter(std::ostream &output)
+	: m_output(output), m_numOfRows(0), m_isClosed(false)
+{
+	m_output.put('[');
+}
+
+il9::utils::AuditLog::AuditJsonDiffWriter::~AuditJsonDiffWriter()
+{
+	close();
+}
+
+void il9::utils::AuditLog::AuditJsonDiffWriter::onModifiedProperty(const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo)
+{
+	if (m_isClosed) return;
+
+	if (m_numOfRows > 0) m_output.put(',');
+	m_output << "\n{\"object\":";
+	writeJsonString(m_output, getPUID(propertyInfo.objectTag));
+	m_output << ",\"property\":";
+	writeJsonString(m_output, propertyInfo.szPropertyName);
+	m_output << ",\"currentValue\":";
+	writeJsonValue(m_output, propertyInfo.currentValue);
+	m_output << ",\"oldValue\":";
+	writeJsonValue(m_output, propertyInfo.oldValue);
+	m_output.put('}');
+
+	m_numOfRows++;
+}
+
+void il9::utils::AuditLog::AuditJsonDiffWriter::close()
+{
+	if (m_isClosed) return;
+
+	m_output << (m_numOfRows > 0 ? "\n]\n" : "]\n");
+	m_output.flush();
+	m_isClosed = true;
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate, il9::utils::AuditLog::AuditDiffSink &sink)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall("il9_getModifiedPropertiesInfo(sink)", &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.journalRoutineCall();
+
+	int nRows = 0;
+	int nCols = 0;
+	void*** result = NULL;
+
+	try
+	{
+		//only the oldest audit record since dtLoggedAfterDate is compared, do not fetch the whole history
+		status = il9_prepareAndExecuteQuery(tObjectTag, dtLoggedAfterDate, strEventTypeName, propNamesToValidate,
+			IL9_AUDIT_QUERY_BASELINE_ONLY, nRows, nCols, &result);
+
+		if (nRows > 0 && nCols > 1)
+		{
+			il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+			status = currentValues.load({ tObjectTag }, propNamesToValidate);
+
+			il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_COMPARE);
+
+			std::vector<int> vectorPropertyCols;
+			il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+
+			//values live until the sink has been called for them
+			il9::utils::AuditLog::AuditValueArena arena(4 * 1024);
+			SinkBaselineVisitor visitor(tObjectTag, propNamesToValidate, currentValues, sink);
+
+			int numOfModifiedProperties = il9::utils::AuditLog::il9_visitAuditBaseline(result, nRows - 1, vectorPropertyCols, propNamesToValidate, arena, visitor);
+
+			//journalling
+			journalling.setOutput("numOfModifiedProperties", numOfModifiedProperties);
+			journalling.journalRoutineCall();
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	//clean up
+	if (result != NULL) MEM_free(result);
+
+	return iFail;
+}
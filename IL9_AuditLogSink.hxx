@@ -0,0 +1,114 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSink.hxx
+* Description:  This file contains the streaming output sinks of the Audit Logs
+*				utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGSINK_HXX
+#define IL9_AUDITLOGSINK_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogBatch.hxx"
+#include "IL9_AuditLogValue.hxx"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			/**
+			* Receives the modified properties as they are found, instead of collecting them into result vectors.
+			* The property name and the values reference memory owned by the caller of onModifiedProperty and are only
+			* valid during the call, a sink keeping them has to copy them (e.g. with CompactPropertyInfo::toPropertyInfo).
+			*/
+			class AuditDiffSink
+			{
+			public:
+				virtual ~AuditDiffSink() {}
+
+				virtual void onModifiedProperty(const CompactPropertyInfo &propertyInfo) = 0;
+			};
+
+			/**
+			* Writes one CSV line per modified property: object,property,current_value,old_value. Objects and reference
+			* values are written as PUIDs, dates as yyyy-mm-dd hh:mm:ss, NULL values as empty fields. Fields are quoted
+			* as per RFC 4180 when needed.
+			*/
+			class AuditCsvDiffWriter : public AuditDiffSink
+			{
+			public:
+				explicit AuditCsvDiffWriter(std::ostream &output, bool isHeaderWritten = true);
+
+				void onModifiedProperty(const CompactPropertyInfo &propertyInfo) override;
+
+				long getNumOfRows() const { return m_numOfRows; }
+
+			private:
+				std::ostream &m_output;
+				long m_numOfRows;
+			};
+
+			/**
+			* Writes a JSON array with one object per modified property:
+			* {"object":"<puid>","property":"<name>","currentValue":<value>,"oldValue":<value>}. Values keep their type,
+			* numbers and logicals are written unquoted and NULL values as null. The array is closed by close() or the
+			* destructor.
+			*/
+			class AuditJsonDiffWriter : public AuditDiffSink
+			{
+			public:
+				explicit AuditJsonDiffWriter(std::ostream &output);
+				~AuditJsonDiffWriter();
+
+				AuditJsonDiffWriter(const AuditJsonDiffWriter &) = delete;
+				AuditJsonDiffWriter &operator=(const AuditJsonDiffWriter &) = delete;
+
+				void onModifiedProperty(const CompactPropertyInfo &propertyInfo) override;
+
+				void close();
+
+				long getNumOfRows() const { return m_numOfRows; }
+
+			private:
+				std::ostream &m_output;
+				long m_numOfRows;
+				bool m_isClosed;
+			};
+
+			/**
+			* Same as il9_getModifiedPropertiesInfo but passes every modified property to the sink as soon as it is found.
+			* Values are compared as AuditValue and never boxed into std::any.
+			*
+			* @param tObjectTag				tag of the audited object
+			* @param dtLoggedAfterDate		audit records logged on or after this date are considered
+			* @param strEventTypeName		audit event type name e.g. __Modify
+			* @param propNamesToValidate	properties to validate
+			* @param sink					receives the modified properties
+			*/
+			int il9_getModifiedPropertiesInfo(tag_t tObjectTag, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditDiffSink &sink);
+
+			/**
+			* Batch version of the above, see il9_getModifiedPropertiesInfo in IL9_AuditLogBatch.hxx. Chunks are diffed
+			* column by column as in the compact overload; the values of a chunk are released once the chunk has been
+			* passed to the sink, so memory does not grow with the number of objects.
+			*/
+			int il9_getModifiedPropertiesInfo(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditDiffSink &sink, int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+		}
+	}
+}
+
+#endif
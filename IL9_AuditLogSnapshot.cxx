@@ -0,0 +1,370 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSnapshot.cxx
+* Description:  This file contains definitions to bulk load current property values
+*				of audited objects
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_AuditLogTrace.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <fclasses/tc_date.h>
+#include <pom/pom/pom.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <tccore/aom_prop.h>
+#include "IL9_JournalLog.hxx"
+
+#include <algorithm>
+#include <map>
+
+
+using namespace Teamcenter;
+
+std::vector<il9::utils::AuditLog::SnapshotValue> &il9::utils::AuditLog::PropertyValueSnapshot::valuesOf(tag_t tObjectTag)
+{
+	std::vector<SnapshotValue> &vectorValues = m_hmValuesByObject[tObjectTag];
+	if (vectorValues.size() != m_hmPropertyIndex.size()) vectorValues.resize(m_hmPropertyIndex.size());
+
+	return vectorValues;
+}
+
+const il9::utils::AuditLog::SnapshotValue *il9::utils::AuditLog::PropertyValueSnapshot::getValue(tag_t tObjectTag, const std::string &szPropertyName) const
+{
+	std::unordered_map<tag_t, std::vector<SnapshotValue> >::const_iterator itObject = m_hmValuesByObject.find(tObjectTag);
+	if (itObject == m_hmValuesByObject.end()) return NULL;
+
+	std::unordered_map<std::string, size_t>::const_iterator itProperty = m_hmPropertyIndex.find(szPropertyName);
+	if (itProperty == m_hmPropertyIndex.end() || itProperty->second >= itObject->second.size()) return NULL;
+
+	return &itObject->second[itProperty->second];
+}
+
+const il9::utils::AuditLog::SnapshotValue *il9::utils::AuditLog::PropertyValueSnapshot::getValue(tag_t tObjectTag, size_t propertyIndex) const
+{
+	if (propertyIndex >= m_vectorSlotOfInput.size()) return NULL;
+
+	std::unordered_map<tag_t, std::vector<SnapshotValue> >::const_iterator itObject = m_hmValuesByObject.find(tObjectTag);
+	if (itObject == m_hmValuesByObject.end() || m_vectorSlotOfInput[propertyIndex] >= itObject->second.size()) return NULL;
+
+	return &itObject->second[m_vectorSlotOfInput[propertyIndex]];
+}
+
+void il9::utils::AuditLog::PropertyValueSnapshot::clear()
+{
+	m_hmPropertyIndex.clear();
+	m_vectorSlotOfInput.clear();
+	m_hmValuesByObject.clear();
+}
+
+void il9::utils::AuditLog::PropertyValueSnapshot::loadChunkByEnquiry(const std::string &szClassName, const std::vector<tag_t> &vectorObjectTags,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate)
+{
+	int nRows = 0;
+	int nCols = 0;
+	void*** result = NULL;
+
+	{
+		AuditEnquiry currentValuesQuery("IL9CurrentPropertyValuesQuery");
+		currentValuesQuery.setDistinct(false);
+
+		//puid column first, then one column per non long string property in input order
+		std::vector<std::string> vectorSelectAttrs;
+		vectorSelectAttrs.push_back(ATTR_PUID);
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			if (propNamesToValidate[indexPropNames].iType != POM_long_string) vectorSelectAttrs.push_back(propNamesToValidate[indexPropNames].szPropertyName);
+		}
+
+		currentValuesQuery.addSelectAttributes(szClassName, vectorSelectAttrs);
+
+		currentValuesQuery.setTagValues("objectTagsValue", vectorObjectTags);
+		currentValuesQuery.setAttrExpr("objectTagsExpr", szClassName, ATTR_PUID, POM_enquiry_in, "objectTagsValue");
+		currentValuesQuery.setWhereExpr("objectTagsExpr");
+
+		//Sample Query
+		//SELECT t_01.puid, t_01.pil9_stocking_type, t_01.pil9_batch_class, ... FROM PIL9_MATERIALREVISION t_01
+		//WHERE (t_01.puid IN ('I6U1smQOvgWMLAAAAAAAAAAAAAA', 'QBZ1smQOvgWMLAAAAAAAAAAAAAA'))
+		currentValuesQuery.execute(nRows, nCols, &result);
+	}
+
+	for (int row = 0; row < nRows; row++)
+	{
+		if (result[row][0] == NULL) continue;
+
+		std::vector<SnapshotValue> &vectorValues = valuesOf(*((tag_t *)result[row][0]));
+
+		int col = 1;
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			const ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropNames];
+			if (propertyInput.iType == POM_long_string) continue;
+
+			il9_readSnapshotValue(propertyInput.iType, result[row][col++], vectorValues[m_vectorSlotOfInput[indexPropNames]]);
+		}
+	}
+
+	if (result != NULL) MEM_free(result);
+}
+
+void il9::utils::AuditLog::PropertyValueSnapshot::loadObjectByAOM(tag_t tObjectTag, const std::vector< ValidatePropertyInput > &propNamesToValidate, bool bLongStringOnly)
+{
+	std::vector<SnapshotValue> &vectorValues = valuesOf(tObjectTag);
+
+	for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+	{
+		const ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropNames];
+		if (bLongStringOnly && propertyInput.iType != POM_long_string) continue;
+
+		il9_readSnapshotValueByAOM(tObjectTag, propertyInput, vectorValues[m_vectorSlotOfInput[indexPropNames]]);
+	}
+}
+
+void il9::utils::AuditLog::il9_readSnapshotValueByAOM(tag_t tObjectTag, const ValidatePropertyInput &propertyInput, SnapshotValue &snapshotValue)
+{
+	ResultStatus status(0);
+
+	const char *pcPropertyName = propertyInput.szPropertyName.c_str();
+
+	snapshotValue = SnapshotValue();
+
+	snapshotValue.iType = propertyInput.iType;
+	snapshotValue.isNull = false;
+
+	switch (propertyInput.iType)
+	{
+		case(POM_long_string):
+		{
+			scoped_smptr<char*> value;
+			int num_of_values = 0;
+			status = AOM_ask_value_strings(tObjectTag, pcPropertyName, &num_of_values, &value);
+			il9::utils::AuditLog::il9_traceAuditValues(tObjectTag, pcPropertyName, num_of_values, value.get());
+
+			snapshotValue.vectorValues.reserve(num_of_values);
+
+			for (int currValueIndex = 0; currValueIndex < num_of_values; currValueIndex++)
+			{
+				snapshotValue.vectorValues.push_back(value.get()[currValueIndex]);
+			}
+
+			break;
+		}
+		case(POM_string):
+		{
+			scoped_smptr<char> spCurrentValue;
+			status = AOM_ask_value_string(tObjectTag, pcPropertyName, &spCurrentValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_string, spCurrentValue.get());
+
+			snapshotValue.isNull = (spCurrentValue.get() == NULL);
+			if (!snapshotValue.isNull) snapshotValue.szValue.assign(spCurrentValue.getString());
+
+			break;
+		}
+		case(POM_logical):
+		{
+			status = AOM_ask_value_logical(tObjectTag, pcPropertyName, &snapshotValue.lValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_logical, &snapshotValue.lValue);
+			break;
+		}
+		case(POM_int):
+		{
+			status = AOM_ask_value_int(tObjectTag, pcPropertyName, &snapshotValue.iValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_int, &snapshotValue.iValue);
+			break;
+		}
+		case(POM_date):
+		{
+			status = AOM_ask_value_date(tObjectTag, pcPropertyName, &snapshotValue.dtValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_date, &snapshotValue.dtValue);
+			break;
+		}
+		case(POM_external_reference):
+		case(POM_typed_reference):
+		case(POM_untyped_reference):
+		{
+			status = AOM_ask_value_tag(tObjectTag, pcPropertyName, &snapshotValue.tValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_external_reference, &snapshotValue.tValue);
+			break;
+		}
+		case(POM_double):
+		{
+			status = AOM_ask_value_double(tObjectTag, pcPropertyName, &snapshotValue.dValue);
+			il9::utils::AuditLog::il9_traceAuditValue(tObjectTag, pcPropertyName, POM_double, &snapshotValue.dValue);
+			break;
+		}
+		default:
+		{
+			snapshotValue.isNull = true;
+		}
+	}
+}
+
+int il9::utils::AuditLog::PropertyValueSnapshot::load(const std::vector<tag_t> &objectTags, const std::vector< ValidatePropertyInput > &propNamesToValidate,
+	int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)objectTags.size());
+	journalling.setInput((int)propNamesToValidate.size());
+	journalling.journalRoutineCall();
+
+	//reading current values, the enquiries are counted as run
+	il9::utils::AuditLog::AuditProfiledPhase profiledPhase(il9::utils::AuditLog::IL9_AUDIT_PHASE_DECODE);
+
+	try
+	{
+		if (iChunkSize <= 0) iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE;
+
+		clear();
+
+		bool hasLongStringProperty = false;
+		bool hasOtherProperty = false;
+
+		for (size_t indexPropNames = 0; indexPropNames < propNamesToValidate.size(); indexPropNames++)
+		{
+			//a property listed twice shares the slot of its first occurrence
+			std::pair<std::unordered_map<std::string, size_t>::iterator, bool> itSlot =
+				m_hmPropertyIndex.insert({ propNamesToValidate[indexPropNames].szPropertyName, m_hmPropertyIndex.size() });
+			m_vectorSlotOfInput.push_back(itSlot.first->second);
+
+			if (propNamesToValidate[indexPropNames].iType == POM_long_string) hasLongStringProperty = true;
+			else hasOtherProperty = true;
+		}
+
+		//objects are queried per class since the attributes are selected from the object's own class
+		std::map< std::string, std::vector<tag_t> > hmObjectsByClass;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			if (objectTags[indexObject] == NULLTAG || m_hmValuesByObject.count(objectTags[indexObject]) > 0) continue;
+
+			valuesOf(objectTags[indexObject]);
+
+			if (!hasOtherProperty) continue;
+
+			tag_t tClassId = NULLTAG;
+			scoped_smptr<char> spClassName;
+
+			status = POM_class_of_instance(objectTags[indexObject], &tClassId);
+			status = POM_name_of_class(tClassId, &spClassName);
+			il9::utils::AuditLog::il9_traceAuditClass(objectTags[indexObject], spClassName.get());
+
+			hmObjectsByClass[spClassName.getString()].push_back(objectTags[indexObject]);
+		}
+
+		for (std::map< std::string, std::vector<tag_t> >::const_iterator itClass = hmObjectsByClass.begin(); itClass != hmObjectsByClass.end(); itClass++)
+		{
+			const std::vector<tag_t> &vectorClassObjects = itClass->second;
+
+			for (size_t chunkStart = 0; chunkStart < vectorClassObjects.size(); chunkStart += iChunkSize)
+			{
+				size_t chunkEnd = std::min(vectorClassObjects.size(), chunkStart + (size_t)iChunkSize);
+				std::vector<tag_t> vectorChunkObjectTags(vectorClassObjects.begin() + chunkStart, vectorClassObjects.begin() + chunkEnd);
+
+				try
+				{
+					loadChunkByEnquiry(itClass->first, vectorChunkObjectTags, propNamesToValidate);
+				}
+				catch (IFail &exception)
+				{
+					//property list is not selectable from this class, read the values through the property layer
+					if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) logger->debug("\n Bulk load failed for class " + itClass->first + ", falling back to AOM: " + exception.getMessage());
+
+					for (size_t indexObject = 0; indexObject < vectorChunkObjectTags.size(); indexObject++)
+					{
+						loadObjectByAOM(vectorChunkObjectTags[indexObject], propNamesToValidate, false);
+					}
+				}
+			}
+		}
+
+		if (hasLongStringProperty)
+		{
+			for (std::unordered_map<tag_t, std::vector<SnapshotValue> >::const_iterator itObject = m_hmValuesByObject.begin(); itObject != m_hmValuesByObject.end(); itObject++)
+			{
+				loadObjectByAOM(itObject->first, propNamesToValidate, true);
+			}
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::il9_readSnapshotValue(int iType, const void *pCell, SnapshotValue &snapshotValue)
+{
+	//the value is reused across properties, a NULL cell must not keep the value of the previous one
+	snapshotValue = SnapshotValue();
+
+	snapshotValue.iType = iType;
+	snapshotValue.isNull = (pCell == NULL);
+
+	if (pCell == NULL) return;
+
+	switch (iType)
+	{
+		case(POM_string):
+		{
+			snapshotValue.szValue.assign((const char *)pCell);
+			break;
+		}
+		case(POM_logical):
+		{
+			snapshotValue.lValue = *((const logical *)pCell);
+			break;
+		}
+		case(POM_int):
+		{
+			snapshotValue.iValue = *((const int *)pCell);
+			break;
+		}
+		case(POM_date):
+		{
+			snapshotValue.dtValue = *((const date_t *)pCell);
+			break;
+		}
+		case(POM_external_reference):
+		case(POM_typed_reference):
+		case(POM_untyped_reference):
+		{
+			snapshotValue.tValue = *((const tag_t *)pCell);
+			break;
+		}
+		case(POM_double):
+		{
+			snapshotValue.dValue = *((const double *)pCell);
+			break;
+		}
+		default:
+		{
+			snapshotValue.isNull = true;
+		}
+	}
+}
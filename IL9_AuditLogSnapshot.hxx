@@ -0,0 +1,110 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSnapshot.hxx
+* Description:  This file contains declarations to bulk load current property values
+*				of audited objects
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGSNAPSHOT_HXX
+#define IL9_AUDITLOGSNAPSHOT_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogBatch.hxx"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//current value of one property of one object
+			struct SnapshotValue
+			{
+				int iType = 0;
+				bool isNull = true;
+
+				logical lValue = false;
+				int iValue = 0;
+				double dValue = 0.0;
+				date_t dtValue = NULLDATE;
+				tag_t tValue = NULLTAG;
+				std::string szValue;
+
+				//values of POM_long_string properties, these are stored as string arrays on the object
+				std::vector<std::string> vectorValues;
+			};
+
+			/**
+			* In-memory snapshot of the current values of a property list across a set of objects.
+			*
+			* Non long string properties are loaded with one POM enquiry per object class and chunk of objects
+			* (SELECT puid, <attrs> FROM <class> WHERE puid IN (...)) instead of one AOM_ask_value_* call per property
+			* and object. If the enquiry cannot be run for a class (e.g. a property is not a persistent attribute of it)
+			* the values of that chunk are loaded through AOM. Long string properties are array valued on the object and
+			* are loaded once per object with AOM_ask_value_strings.
+			*/
+			class PropertyValueSnapshot
+			{
+			public:
+				int load(const std::vector<tag_t> &objectTags, const std::vector< ValidatePropertyInput > &propNamesToValidate,
+					int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+
+				//returns NULL when the object or property is not part of the snapshot
+				const SnapshotValue *getValue(tag_t tObjectTag, const std::string &szPropertyName) const;
+
+				//same as above, by position of the property in the list passed to load; a name listed twice gives the same value at both positions
+				const SnapshotValue *getValue(tag_t tObjectTag, size_t propertyIndex) const;
+
+				void clear();
+
+			private:
+				void loadChunkByEnquiry(const std::string &szClassName, const std::vector<tag_t> &vectorObjectTags,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate);
+				void loadObjectByAOM(tag_t tObjectTag, const std::vector< ValidatePropertyInput > &propNamesToValidate, bool bLongStringOnly);
+
+				std::vector<SnapshotValue> &valuesOf(tag_t tObjectTag);
+
+				std::unordered_map<std::string, size_t> m_hmPropertyIndex;		//value slot by property name
+				std::vector<size_t> m_vectorSlotOfInput;						//value slot by position in the list passed to load
+				std::unordered_map<tag_t, std::vector<SnapshotValue> > m_hmValuesByObject;
+			};
+
+			//reads the current value of one property with AOM_ask_value_*, the fallback of PropertyValueSnapshot::load when the enquiry cannot be run
+			void il9_readSnapshotValueByAOM(tag_t tObjectTag, const ValidatePropertyInput &propertyInput, SnapshotValue &snapshotValue);
+
+			//reads the enquiry result cell of a non long string property into snapshotValue, a NULL cell gives a NULL value with all fields at their defaults
+			void il9_readSnapshotValue(int iType, const void *pCell, SnapshotValue &snapshotValue);
+		}
+	}
+}
+
+/**
+* Overloads of the audit log helpers which read the current property values from a PropertyValueSnapshot.
+* When snapshot is NULL or does not contain the value, the value is fetched with AOM_ask_value_* as before.
+*/
+int il9_checkIfPropertyModified(tag_t ObjectTag, il9::utils::AuditLog::ValidatePropertyInput validatePropertyInput, void ***result, int col, int row, bool &isModified,
+	il9::utils::AuditLog::PropertyInfo &propertyInfo, const il9::utils::AuditLog::PropertyValueSnapshot *snapshot);
+
+int il9_checkIfLongStringPropertyModified(tag_t ObjectTag, tag_t auditObjectTag, std::string szPropertyName, std::string szPropertyNameOld, bool &isModified,
+	il9::utils::AuditLog::PropertyInfo &propertyInfo, const il9::utils::AuditLog::PropertyValueSnapshot *snapshot);
+
+int il9_validateNonLongStringPropertyValues(tag_t ObjectTag, int row_index, int nCols, std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate,
+	void ***result, int &numOfModifiedProperties, std::unordered_set<std::string> &hsModifiedPropertyNames,
+	std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties, const il9::utils::AuditLog::PropertyValueSnapshot *snapshot);
+
+int il9_validateLongStringPropertyValues(tag_t ObjectTag, tag_t auditObjectTag, std::vector< il9::utils::AuditLog::ValidatePropertyInput > propNamesToValidate,
+	int &numOfModifiedProperties, std::unordered_set<std::string> &hsModifiedPropertyNames,
+	std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties, const il9::utils::AuditLog::PropertyValueSnapshot *snapshot);
+
+#endif
@@ -0,0 +1,799 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogTrace.cxx
+* Description:  This file contains definitions of the record and replay trace of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogTrace.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogResultCache.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	//file layout: TRACE_FILE_MAGIC followed by records, each a record type byte and its fields in native byte order
+	const char TRACE_FILE_MAGIC[8] = { 'I', 'L', '9', 'A', 'T', 'R', 'C', '1' };
+
+	enum TraceRecordType
+	{
+		TRACE_RECORD_CALL = 1,
+		TRACE_RECORD_ENQUIRY = 2,
+		TRACE_RECORD_ATTRIBUTE = 3,
+		TRACE_RECORD_CLASS = 4
+	};
+
+	class TraceOutput
+	{
+	public:
+		explicit TraceOutput(std::string &szBuffer) : m_szBuffer(szBuffer) {}
+
+		template <typename T>
+		void put(const T &value)
+		{
+			m_szBuffer.append((const char *)&value, sizeof(T));
+		}
+
+		void putString(const std::string &szValue)
+		{
+			put((uint32_t)szValue.size());
+			m_szBuffer.append(szValue);
+		}
+
+		void putValue(const il9::utils::AuditLog::AuditTraceValue &value)
+		{
+			put((int32_t)value.iType);
+			put((uint8_t)value.isNull);
+
+			if (value.isNull) return;
+
+			switch (value.iType)
+			{
+				case(POM_string): putString(value.szValue); break;
+				case(POM_long_string):
+				{
+					put((uint32_t)value.vectorValues.size());
+					for (size_t indexValue = 0; indexValue < value.vectorValues.size(); indexValue++) putString(value.vectorValues[indexValue]);
+					break;
+				}
+				case(POM_logical): put((uint8_t)(value.lValue ? 1 : 0)); break;
+				case(POM_int): put((int32_t)value.iValue); break;
+				case(POM_double): put(value.dValue); break;
+				case(POM_date): put(value.dtValue); break;
+				default: put(value.tValue); break;
+			}
+		}
+
+	private:
+		std::string &m_szBuffer;
+	};
+
+	//reads the fields written by TraceOutput, throws IL9_AUDIT_TRACE_ERROR on a truncated trace
+	class TraceInput
+	{
+	public:
+		TraceInput(const char *pcData, size_t size) : m_pcData(pcData), m_remaining(size) {}
+
+		bool isAtEnd() const { return m_remaining == 0; }
+
+		template <typename T>
+		T get()
+		{
+			T value;
+			std::memcpy(&value, take(sizeof(T)), sizeof(T));
+
+			return value;
+		}
+
+		std::string getString()
+		{
+			uint32_t length = get<uint32_t>();
+			return std::string(take(length), length);
+		}
+
+		il9::utils::AuditLog::AuditTraceValue getValue()
+		{
+			il9::utils::AuditLog::AuditTraceValue value;
+			value.iType = get<int32_t>();
+			value.isNull = get<uint8_t>() != 0;
+
+			if (value.isNull) return value;
+
+			switch (value.iType)
+			{
+				case(POM_string): value.szValue = getString(); break;
+				case(POM_long_string):
+				{
+					uint32_t numOfValues = get<uint32_t>();
+					for (uint32_t indexValue = 0; indexValue < numOfValues; indexValue++) value.vectorValues.push_back(getString());
+					break;
+				}
+				case(POM_logical): value.lValue = get<uint8_t>() != 0; break;
+				case(POM_int): value.iValue = get<int32_t>(); break;
+				case(POM_double): value.dValue = get<double>(); break;
+				case(POM_date): value.dtValue = get<date_t>(); break;
+				default: value.tValue = get<tag_t>(); break;
+			}
+
+			return value;
+		}
+
+	private:
+		const char *take(size_t size)
+		{
+			if (size > m_remaining) throw IFail(il9::utils::AuditLog::IL9_AUDIT_TRACE_ERROR);
+
+			const char *pcField = m_pcData;
+			m_pcData += size;
+			m_remaining -= size;
+
+			return pcField;
+		}
+
+		const char *m_pcData;
+		size_t m_remaining;
+	};
+
+	il9::utils::AuditLog::AuditTraceCall getCall(TraceInput &input)
+	{
+		il9::utils::AuditLog::AuditTraceCall call;
+		call.iFunction = input.get<int32_t>();
+		call.tObjectTag = input.get<tag_t>();
+		call.dtLoggedAfterDate = input.get<date_t>();
+		call.strEventTypeName = input.getString();
+
+		uint32_t numOfProperties = input.get<uint32_t>();
+
+		for (uint32_t indexProp = 0; indexProp < numOfProperties; indexProp++)
+		{
+			il9::utils::AuditLog::ValidatePropertyInput propertyInput;
+			propertyInput.szPropertyName = input.getString();
+			propertyInput.szPropertyNameOld = input.getString();
+			propertyInput.iType = input.get<int32_t>();
+
+			call.propNamesToValidate.push_back(propertyInput);
+		}
+
+		call.iFail = input.get<int32_t>();
+
+		uint32_t numOfOutputs = input.get<uint32_t>();
+		for (uint32_t indexOutput = 0; indexOutput < numOfOutputs; indexOutput++) call.vectorOutputs.push_back(input.getString());
+
+		call.dElapsedMs = input.get<double>();
+
+		return call;
+	}
+
+	il9::utils::AuditLog::AuditTraceEnquiry getEnquiry(TraceInput &input)
+	{
+		il9::utils::AuditLog::AuditTraceEnquiry enquiry;
+		enquiry.szKey = input.getString();
+
+		uint32_t nCols = input.get<uint32_t>();
+		for (uint32_t indexColumn = 0; indexColumn < nCols; indexColumn++) enquiry.vectorColumnTypes.push_back(input.get<int32_t>());
+
+		enquiry.nRows = input.get<int32_t>();
+		if (enquiry.nRows < 0) throw IFail(il9::utils::AuditLog::IL9_AUDIT_TRACE_ERROR);
+
+		for (size_t indexCell = 0; indexCell < (size_t)enquiry.nRows * nCols; indexCell++) enquiry.vectorCells.push_back(input.getValue());
+
+		return enquiry;
+	}
+
+	std::string formatAnyValue(const std::any &anyValue)
+	{
+		if (const std::string *pszValue = std::any_cast<std::string>(&anyValue)) return *pszValue;
+		if (const logical *plValue = std::any_cast<logical>(&anyValue)) return *plValue ? "true" : "false";
+		if (const int *piValue = std::any_cast<int>(&anyValue)) return std::to_string(*piValue);
+		if (const double *pdValue = std::any_cast<double>(&anyValue)) return std::to_string(*pdValue);
+		if (const date_t *pdtValue = std::any_cast<date_t>(&anyValue)) return il9::utils::AuditLog::il9_formatAuditDate(*pdtValue);
+		if (const tag_t *ptValue = std::any_cast<tag_t>(&anyValue)) return std::to_string(*ptValue);
+
+		return std::string();
+	}
+
+	std::string formatPropertyInfo(const il9::utils::AuditLog::PropertyInfo &propertyInfo)
+	{
+		return propertyInfo.szPropertyName + "\t" + formatAnyValue(propertyInfo.szCurrentValue) + "\t" + formatAnyValue(propertyInfo.szOldValue);
+	}
+}
+
+int il9::utils::AuditLog::AuditTrace::read(const std::string &szFilePath)
+{
+	int iFail = ITK_ok;
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+
+	try
+	{
+		std::ifstream streamFile(szFilePath.c_str(), std::ios::in | std::ios::binary);
+		if (!streamFile.is_open()) throw IFail(IL9_AUDIT_TRACE_ERROR);
+
+		std::string szContents((std::istreambuf_iterator<char>(streamFile)), std::istreambuf_iterator<char>());
+
+		if (szContents.size() < sizeof(TRACE_FILE_MAGIC) || std::memcmp(szContents.data(), TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC)) != 0)
+		{
+			throw IFail(IL9_AUDIT_TRACE_ERROR);
+		}
+
+		m_vectorCalls.clear();
+		m_hmEnquiries.clear();
+		m_vectorAttributes.clear();
+		m_vectorClasses.clear();
+
+		TraceInput input(szContents.data() + sizeof(TRACE_FILE_MAGIC), szContents.size() - sizeof(TRACE_FILE_MAGIC));
+
+		while (!input.isAtEnd())
+		{
+			switch (input.get<uint8_t>())
+			{
+				case(TRACE_RECORD_CALL):
+				{
+					m_vectorCalls.push_back(getCall(input));
+					break;
+				}
+				case(TRACE_RECORD_ENQUIRY):
+				{
+					AuditTraceEnquiry enquiry = getEnquiry(input);
+					m_hmEnquiries.emplace(enquiry.szKey, std::move(enquiry));
+					break;
+				}
+				case(TRACE_RECORD_ATTRIBUTE):
+				{
+					AuditTraceAttribute attribute;
+					attribute.tObjectTag = input.get<tag_t>();
+					attribute.szAttrName = input.getString();
+					attribute.value = input.getValue();
+
+					m_vectorAttributes.push_back(std::move(attribute));
+					break;
+				}
+				case(TRACE_RECORD_CLASS):
+				{
+					tag_t tObjectTag = input.get<tag_t>();
+					m_vectorClasses.push_back({ tObjectTag, input.getString() });
+					break;
+				}
+				default:
+				{
+					throw IFail(IL9_AUDIT_TRACE_ERROR);
+				}
+			}
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error("audit trace " + szFilePath + " cannot be read");
+	}
+
+	return iFail;
+}
+
+const il9::utils::AuditLog::AuditTraceEnquiry *il9::utils::AuditLog::AuditTrace::findEnquiry(const std::string &szKey) const
+{
+	std::unordered_map<std::string, AuditTraceEnquiry>::const_iterator itEnquiry = m_hmEnquiries.find(szKey);
+	return (itEnquiry != m_hmEnquiries.end()) ? &itEnquiry->second : NULL;
+}
+
+std::vector<std::string> il9::utils::AuditLog::il9_formatAuditTraceOutputs(const std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+{
+	std::vector<std::string> vectorOutputs;
+	vectorOutputs.reserve(modifiedProperties.size());
+
+	for (size_t indexProp = 0; indexProp < modifiedProperties.size(); indexProp++) vectorOutputs.push_back(formatPropertyInfo(modifiedProperties[indexProp]));
+
+	return vectorOutputs;
+}
+
+std::vector<std::string> il9::utils::AuditLog::il9_formatAuditTraceOutputs(const std::vector< il9::utils::AuditLog::ModifiedPropertyInfo > &modifiedProperties)
+{
+	std::vector<std::string> vectorOutputs;
+	vectorOutputs.reserve(modifiedProperties.size());
+
+	for (size_t indexProp = 0; indexProp < modifiedProperties.size(); indexProp++)
+	{
+		vectorOutputs.push_back(std::to_string(modifiedProperties[indexProp].objectTag) + "\t" + formatPropertyInfo(modifiedProperties[indexProp].propertyInfo));
+	}
+
+	return vectorOutputs;
+}
+
+#ifndef IL9_AUDITLOG_NO_INSTRUMENTATION
+namespace
+{
+	void putCall(TraceOutput &output, const il9::utils::AuditLog::AuditTraceCall &call)
+	{
+		output.put((uint8_t)TRACE_RECORD_CALL);
+		output.put((int32_t)call.iFunction);
+		output.put(call.tObjectTag);
+		output.put(call.dtLoggedAfterDate);
+		output.putString(call.strEventTypeName);
+
+		output.put((uint32_t)call.propNamesToValidate.size());
+
+		for (size_t indexProp = 0; indexProp < call.propNamesToValidate.size(); indexProp++)
+		{
+			output.putString(call.propNamesToValidate[indexProp].szPropertyName);
+			output.putString(call.propNamesToValidate[indexProp].szPropertyNameOld);
+			output.put((int32_t)call.propNamesToValidate[indexProp].iType);
+		}
+
+		output.put((int32_t)call.iFail);
+		output.put((uint32_t)call.vectorOutputs.size());
+		for (size_t indexOutput = 0; indexOutput < call.vectorOutputs.size(); indexOutput++) output.putString(call.vectorOutputs[indexOutput]);
+
+		output.put(call.dElapsedMs);
+	}
+
+	void putEnquiry(TraceOutput &output, const il9::utils::AuditLog::AuditTraceEnquiry &enquiry)
+	{
+		output.put((uint8_t)TRACE_RECORD_ENQUIRY);
+		output.putString(enquiry.szKey);
+
+		output.put((uint32_t)enquiry.vectorColumnTypes.size());
+		for (size_t indexColumn = 0; indexColumn < enquiry.vectorColumnTypes.size(); indexColumn++) output.put((int32_t)enquiry.vectorColumnTypes[indexColumn]);
+
+		output.put((int32_t)enquiry.nRows);
+		for (size_t indexCell = 0; indexCell < enquiry.vectorCells.size(); indexCell++) output.putValue(enquiry.vectorCells[indexCell]);
+	}
+
+	//enquiry cell or AOM answer of the given POM type, NULL for a NULL value
+	il9::utils::AuditLog::AuditTraceValue traceValueOf(int iType, const void *pValue)
+	{
+		il9::utils::AuditLog::AuditTraceValue value;
+		value.iType = iType;
+		value.isNull = (pValue == NULL);
+
+		if (value.isNull) return value;
+
+		switch (iType)
+		{
+			case(POM_string):
+			case(POM_long_string):
+			{
+				value.iType = POM_string;
+				value.szValue = (const char *)pValue;
+				break;
+			}
+			case(POM_logical): value.lValue = *((const logical *)pValue); break;
+			case(POM_int): value.iValue = *((const int *)pValue); break;
+			case(POM_double): value.dValue = *((const double *)pValue); break;
+			case(POM_date): value.dtValue = *((const date_t *)pValue); break;
+			default: value.tValue = *((const tag_t *)pValue); break;
+		}
+
+		return value;
+	}
+
+	size_t cellSize(const il9::utils::AuditLog::AuditTraceValue &value)
+	{
+		switch (value.iType)
+		{
+			case(POM_string): return value.szValue.size() + 1;
+			case(POM_logical): return sizeof(logical);
+			case(POM_int): return sizeof(int);
+			case(POM_double): return sizeof(double);
+			case(POM_date): return sizeof(date_t);
+			default: return sizeof(tag_t);
+		}
+	}
+
+	std::atomic<const il9::utils::AuditLog::AuditTrace *> &replayedTrace()
+	{
+		static std::atomic<const il9::utils::AuditLog::AuditTrace *> trace(nullptr);
+		return trace;
+	}
+
+	void clearSessionCaches()
+	{
+		il9::utils::AuditLog::il9_clearAuditEnquiryCache();
+		il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+	}
+
+	//what the outermost traced call of a thread has read so far
+	struct TracedCallState
+	{
+		int depth = 0;
+		bool isRecording = false;
+		il9::utils::AuditLog::AuditTraceCall call;
+		std::vector<il9::utils::AuditLog::AuditTraceEnquiry> vectorEnquiries;
+		std::vector<il9::utils::AuditLog::AuditTraceAttribute> vectorAttributes;
+		std::vector< std::pair<tag_t, std::string> > vectorClasses;
+		std::unordered_map<std::string, int> hmAttributeTypes;
+		std::chrono::steady_clock::time_point tpStart;
+
+		void reset()
+		{
+			call = il9::utils::AuditLog::AuditTraceCall();
+			vectorEnquiries.clear();
+			vectorAttributes.clear();
+			vectorClasses.clear();
+			hmAttributeTypes.clear();
+		}
+	};
+
+	TracedCallState &tracedCallState()
+	{
+		thread_local TracedCallState state;
+		return state;
+	}
+
+	/**
+	* Trace file being recorded. Enquiries, attributes and classes are written once per key, records of a call are
+	* appended when the call ends so calls of concurrent threads do not interleave.
+	*/
+	class AuditTraceRecorder
+	{
+	public:
+		static AuditTraceRecorder &instance()
+		{
+			static AuditTraceRecorder recorder;
+			return recorder;
+		}
+
+		bool isRecording() const { return m_isRecording; }
+
+		int start(const std::string &szFilePath)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			closeFile();
+
+			m_streamFile.open(szFilePath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if (!m_streamFile.is_open()) return il9::utils::AuditLog::IL9_AUDIT_TRACE_ERROR;
+
+			m_streamFile.write(TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+			m_isRecording = true;
+
+			return ITK_ok;
+		}
+
+		void stop()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			closeFile();
+		}
+
+		void write(const TracedCallState &state)
+		{
+			std::string szBuffer;
+			TraceOutput output(szBuffer);
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (!m_isRecording) return;
+
+			for (size_t indexEnquiry = 0; indexEnquiry < state.vectorEnquiries.size(); indexEnquiry++)
+			{
+				if (m_hsEnquiryKeys.insert(state.vectorEnquiries[indexEnquiry].szKey).second) putEnquiry(output, state.vectorEnquiries[indexEnquiry]);
+			}
+
+			for (size_t indexAttribute = 0; indexAttribute < state.vectorAttributes.size(); indexAttribute++)
+			{
+				const il9::utils::AuditLog::AuditTraceAttribute &attribute = state.vectorAttributes[indexAttribute];
+				if (!m_hsAttributes.insert({ attribute.tObjectTag, attribute.szAttrName }).second) continue;
+
+				output.put((uint8_t)TRACE_RECORD_ATTRIBUTE);
+				output.put(attribute.tObjectTag);
+				output.putString(attribute.szAttrName);
+				output.putValue(attribute.value);
+			}
+
+			for (size_t indexClass = 0; indexClass < state.vectorClasses.size(); indexClass++)
+			{
+				if (!m_hsClassObjects.insert(state.vectorClasses[indexClass].first).second) continue;
+
+				output.put((uint8_t)TRACE_RECORD_CLASS);
+				output.put(state.vectorClasses[indexClass].first);
+				output.putString(state.vectorClasses[indexClass].second);
+			}
+
+			putCall(output, state.call);
+
+			m_streamFile.write(szBuffer.data(), szBuffer.size());
+			m_streamFile.flush();
+
+			if (!m_streamFile.good())
+			{
+				il9::utils::AuditLog::il9_getAuditLogger()->error("audit trace cannot be written, recording stopped");
+				closeFile();
+			}
+		}
+
+	private:
+		AuditTraceRecorder() : m_isRecording(false)
+		{
+			//recording through the environment starts before the first enquiry, the caches hold nothing to clear yet
+			const char *pcFilePath = std::getenv("IL9_AUDIT_TRACE");
+			if (pcFilePath != NULL && pcFilePath[0] != '\0') start(pcFilePath);
+		}
+
+		void closeFile()
+		{
+			m_isRecording = false;
+
+			if (m_streamFile.is_open()) m_streamFile.close();
+
+			m_hsEnquiryKeys.clear();
+			m_hsAttributes.clear();
+			m_hsClassObjects.clear();
+		}
+
+		std::mutex m_mutex;
+		std::atomic<bool> m_isRecording;
+		std::ofstream m_streamFile;
+		std::unordered_set<std::string> m_hsEnquiryKeys;
+		std::set< std::pair<tag_t, std::string> > m_hsAttributes;
+		std::unordered_set<tag_t> m_hsClassObjects;
+	};
+
+	//types of the property columns, from the object and from the audit record
+	void registerAttributeTypes(TracedCallState &state, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+		{
+			if (propNamesToValidate[indexProp].iType == POM_long_string) continue;
+
+			state.hmAttributeTypes[propNamesToValidate[indexProp].szPropertyName] = propNamesToValidate[indexProp].iType;
+			state.hmAttributeTypes[propNamesToValidate[indexProp].szPropertyNameOld] = propNamesToValidate[indexProp].iType;
+		}
+	}
+
+	//POM type of a selected attribute, -1 when unknown
+	int columnTypeOf(const TracedCallState &state, const std::string &szAttrName)
+	{
+		if (szAttrName == ATTR_PUID || szAttrName == OBJECT_TAG) return POM_external_reference;
+		if (szAttrName == LOGGED_DATE) return POM_date;
+		if (szAttrName == EVENT_TYPE_NAME) return POM_string;
+
+		std::unordered_map<std::string, int>::const_iterator itType = state.hmAttributeTypes.find(szAttrName);
+		return (itType != state.hmAttributeTypes.end()) ? itType->second : -1;
+	}
+}
+
+bool il9::utils::AuditLog::il9_isAuditTraceRecording()
+{
+	return AuditTraceRecorder::instance().isRecording();
+}
+
+int il9::utils::AuditLog::il9_startAuditTraceRecording(const std::string &szFilePath)
+{
+	int iFail = AuditTraceRecorder::instance().start(szFilePath);
+
+	//enquiries prepared or baselines cached before would not be recorded
+	if (iFail == ITK_ok) clearSessionCaches();
+
+	return iFail;
+}
+
+void il9::utils::AuditLog::il9_stopAuditTraceRecording()
+{
+	AuditTraceRecorder::instance().stop();
+}
+
+void il9::utils::AuditLog::il9_setAuditTraceReplay(const il9::utils::AuditLog::AuditTrace *trace)
+{
+	replayedTrace() = trace;
+	clearSessionCaches();
+}
+
+bool il9::utils::AuditLog::il9_isAuditTraceReplaying()
+{
+	return replayedTrace().load() != nullptr;
+}
+
+bool il9::utils::AuditLog::il9_isAuditTraceEnabled()
+{
+	return il9_isAuditTraceRecording() || il9_isAuditTraceReplaying();
+}
+
+void il9::utils::AuditLog::il9_replayAuditEnquiry(const std::string &szKey, int &nRows, int &nCols, void ****result)
+{
+	nRows = 0;
+	nCols = 0;
+	*result = NULL;
+
+	const AuditTrace *trace = replayedTrace().load();
+	const AuditTraceEnquiry *enquiry = (trace != nullptr) ? trace->findEnquiry(szKey) : NULL;
+
+	if (enquiry == NULL)
+	{
+		if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) il9::utils::AuditLog::il9_getAuditLogger()->debug("\n Enquiry not in the audit trace: " + szKey);
+		throw IFail(IL9_AUDIT_TRACE_MISS);
+	}
+
+	nRows = enquiry->nRows;
+	nCols = (int)enquiry->vectorColumnTypes.size();
+
+	if (nRows == 0) return;
+
+	//one allocation freed with a single MEM_free, like POM_enquiry_execute
+	size_t pointerBytes = sizeof(void **) * nRows + sizeof(void *) * nRows * nCols;
+	size_t dataBytes = 0;
+
+	for (size_t indexCell = 0; indexCell < enquiry->vectorCells.size(); indexCell++)
+	{
+		if (!enquiry->vectorCells[indexCell].isNull) dataBytes += (cellSize(enquiry->vectorCells[indexCell]) + 7) & ~(size_t)7;
+	}
+
+	char *pcBlock = (char *)MEM_alloc((int)(pointerBytes + dataBytes));
+
+	void ***pRows = (void ***)pcBlock;
+	void **pCells = (void **)(pcBlock + sizeof(void **) * nRows);
+	char *pcData = pcBlock + pointerBytes;
+
+	for (int row = 0; row < nRows; row++)
+	{
+		pRows[row] = pCells + (size_t)row * nCols;
+
+		for (int col = 0; col < nCols; col++)
+		{
+			const AuditTraceValue &value = enquiry->vectorCells[(size_t)row * nCols + col];
+
+			if (value.isNull)
+			{
+				pRows[row][col] = NULL;
+				continue;
+			}
+
+			switch (value.iType)
+			{
+				case(POM_string): std::memcpy(pcData, value.szValue.c_str(), value.szValue.size() + 1); break;
+				case(POM_logical): std::memcpy(pcData, &value.lValue, sizeof(logical)); break;
+				case(POM_int): std::memcpy(pcData, &value.iValue, sizeof(int)); break;
+				case(POM_double): std::memcpy(pcData, &value.dValue, sizeof(double)); break;
+				case(POM_date): std::memcpy(pcData, &value.dtValue, sizeof(date_t)); break;
+				default: std::memcpy(pcData, &value.tValue, sizeof(tag_t)); break;
+			}
+
+			pRows[row][col] = pcData;
+			pcData += (cellSize(value) + 7) & ~(size_t)7;
+		}
+	}
+
+	*result = pRows;
+}
+
+void il9::utils::AuditLog::il9_traceAuditEnquiry(const std::string &szKey, const std::vector< std::pair<std::string, std::string> > &vectorSelectAttrs,
+	int nRows, int nCols, void ***result)
+{
+	TracedCallState &state = tracedCallState();
+	if (!state.isRecording) return;
+
+	AuditTraceEnquiry enquiry;
+	enquiry.szKey = szKey;
+	enquiry.nRows = nRows;
+
+	for (size_t indexAttr = 0; indexAttr < vectorSelectAttrs.size(); indexAttr++)
+	{
+		int iType = columnTypeOf(state, vectorSelectAttrs[indexAttr].second);
+
+		if (iType < 0)
+		{
+			if (il9::utils::AuditLog::il9_isAuditDebugEnabled()) il9::utils::AuditLog::il9_getAuditLogger()->debug("\n Enquiry not traced, unknown column " + vectorSelectAttrs[indexAttr].second);
+			return;
+		}
+
+		enquiry.vectorColumnTypes.push_back(iType);
+	}
+
+	//order attributes which are not selected come back as extra columns the select list does not describe
+	if ((int)enquiry.vectorColumnTypes.size() != nCols && nRows > 0) return;
+
+	enquiry.vectorCells.reserve((size_t)nRows * nCols);
+
+	for (int row = 0; row < nRows; row++)
+	{
+		for (int col = 0; col < nCols; col++) enquiry.vectorCells.push_back(traceValueOf(enquiry.vectorColumnTypes[col], result[row][col]));
+	}
+
+	state.vectorEnquiries.push_back(std::move(enquiry));
+}
+
+void il9::utils::AuditLog::il9_traceAuditValue(tag_t tObjectTag, const char *pcAttrName, int iType, const void *pValue)
+{
+	TracedCallState &state = tracedCallState();
+	if (!state.isRecording) return;
+
+	state.vectorAttributes.push_back({ tObjectTag, pcAttrName, traceValueOf(iType, pValue) });
+}
+
+void il9::utils::AuditLog::il9_traceAuditValues(tag_t tObjectTag, const char *pcAttrName, int numOfValues, char **pcValues)
+{
+	TracedCallState &state = tracedCallState();
+	if (!state.isRecording) return;
+
+	AuditTraceAttribute attribute;
+	attribute.tObjectTag = tObjectTag;
+	attribute.szAttrName = pcAttrName;
+	attribute.value.iType = POM_long_string;
+	attribute.value.isNull = false;
+
+	for (int indexValue = 0; indexValue < numOfValues; indexValue++) attribute.value.vectorValues.push_back(pcValues[indexValue]);
+
+	state.vectorAttributes.push_back(std::move(attribute));
+}
+
+void il9::utils::AuditLog::il9_traceAuditClass(tag_t tObjectTag, const char *pcClassName)
+{
+	TracedCallState &state = tracedCallState();
+	if (!state.isRecording) return;
+
+	state.vectorClasses.push_back({ tObjectTag, pcClassName });
+}
+
+void il9::utils::AuditLog::il9_traceAuditPropertyTypes(const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+{
+	TracedCallState &state = tracedCallState();
+	if (!state.isRecording) return;
+
+	registerAttributeTypes(state, propNamesToValidate);
+}
+
+il9::utils::AuditLog::AuditTracedCall::AuditTracedCall(il9::utils::AuditLog::AuditTraceFunction function, tag_t tObjectTag, const date_t &dtLoggedAfterDate,
+	const std::string &strEventTypeName, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate, size_t numOfPreviousOutputs,
+	int *piFail) : m_isOwner(false), m_numOfPreviousOutputs(numOfPreviousOutputs), m_piFail(piFail)
+{
+	TracedCallState &state = tracedCallState();
+
+	if (state.depth++ > 0 || !il9_isAuditTraceRecording()) return;
+
+	m_isOwner = true;
+
+	state.reset();
+	state.isRecording = true;
+	state.tpStart = std::chrono::steady_clock::now();
+
+	state.call.iFunction = function;
+	state.call.tObjectTag = tObjectTag;
+	state.call.dtLoggedAfterDate = dtLoggedAfterDate;
+	state.call.strEventTypeName = strEventTypeName;
+	state.call.propNamesToValidate = propNamesToValidate;
+
+	registerAttributeTypes(state, propNamesToValidate);
+}
+
+il9::utils::AuditLog::AuditTracedCall::~AuditTracedCall()
+{
+	TracedCallState &state = tracedCallState();
+	state.depth--;
+
+	if (!m_isOwner) return;
+
+	state.call.iFail = *m_piFail;
+	state.call.vectorOutputs.swap(m_vectorOutputs);
+	state.call.dElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - state.tpStart).count();
+
+	AuditTraceRecorder::instance().write(state);
+
+	state.isRecording = false;
+	state.reset();
+}
+#endif
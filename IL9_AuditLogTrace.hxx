@@ -0,0 +1,215 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogTrace.hxx
+* Description:  This file contains declarations of the record and replay trace of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGTRACE_HXX
+#define IL9_AUDITLOGTRACE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+//Recording is compiled out together with the other hooks when IL9_AUDITLOG_NO_INSTRUMENTATION is defined.
+//Otherwise calls of il9_getModifiedPropertiesInfo and il9_trackPropertyValueChange are recorded when IL9_AUDIT_TRACE
+//names a file at the first call, or after il9_startAuditTraceRecording.
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//trace file cannot be written or read
+			const int IL9_AUDIT_TRACE_ERROR = 919004;
+
+			//replayed enquiry is not part of the trace
+			const int IL9_AUDIT_TRACE_MISS = 919005;
+
+			enum AuditTraceFunction
+			{
+				IL9_AUDIT_TRACE_GET_MODIFIED_PROPERTIES_INFO = 1,
+				IL9_AUDIT_TRACE_TRACK_PROPERTY_VALUE_CHANGE = 2
+			};
+
+			//typed enquiry cell or AOM answer; long string values of AOM_ask_value_strings are kept in vectorValues
+			struct AuditTraceValue
+			{
+				int iType = 0;
+				bool isNull = true;
+				logical lValue = false;
+				int iValue = 0;
+				double dValue = 0.0;
+				date_t dtValue = NULLDATE;
+				tag_t tValue = NULLTAG;
+				std::string szValue;
+				std::vector<std::string> vectorValues;
+			};
+
+			//result of one enquiry, keyed by its select list and bind values
+			struct AuditTraceEnquiry
+			{
+				std::string szKey;
+				std::vector<int> vectorColumnTypes;
+				int nRows = 0;
+				std::vector<AuditTraceValue> vectorCells;	//row by row
+			};
+
+			struct AuditTraceAttribute
+			{
+				tag_t tObjectTag = NULLTAG;
+				std::string szAttrName;
+				AuditTraceValue value;
+			};
+
+			//one recorded entry point call with its inputs and outputs
+			struct AuditTraceCall
+			{
+				int iFunction = 0;
+				tag_t tObjectTag = NULLTAG;
+				date_t dtLoggedAfterDate = NULLDATE;
+				std::string strEventTypeName;
+				std::vector< ValidatePropertyInput > propNamesToValidate;
+				int iFail = ITK_ok;
+				std::vector<std::string> vectorOutputs;		//modified properties as text, see il9_formatAuditTraceOutputs
+				double dElapsedMs = 0.0;					//time of the recorded call, database included
+			};
+
+			/**
+			* Contents of a trace file. Enquiry results and AOM answers are recorded once per key, calls in the order they
+			* finished. A trace only holds what the recorded calls read, replaying other calls or a changed property list
+			* fails with IL9_AUDIT_TRACE_MISS.
+			*/
+			class AuditTrace
+			{
+			public:
+				int read(const std::string &szFilePath);
+
+				const std::vector<AuditTraceCall> &getCalls() const { return m_vectorCalls; }
+				const std::vector<AuditTraceAttribute> &getAttributes() const { return m_vectorAttributes; }
+				const std::vector< std::pair<tag_t, std::string> > &getClasses() const { return m_vectorClasses; }
+
+				//NULL when the enquiry was not recorded
+				const AuditTraceEnquiry *findEnquiry(const std::string &szKey) const;
+
+			private:
+				std::vector<AuditTraceCall> m_vectorCalls;
+				std::unordered_map<std::string, AuditTraceEnquiry> m_hmEnquiries;
+				std::vector<AuditTraceAttribute> m_vectorAttributes;
+				std::vector< std::pair<tag_t, std::string> > m_vectorClasses;
+			};
+
+			//modified properties as "name<TAB>current value<TAB>old value" lines, prefixed with the audit record for il9_trackPropertyValueChange
+			std::vector<std::string> il9_formatAuditTraceOutputs(const std::vector< PropertyInfo > &modifiedProperties);
+			std::vector<std::string> il9_formatAuditTraceOutputs(const std::vector< ModifiedPropertyInfo > &modifiedProperties);
+
+#ifdef IL9_AUDITLOG_NO_INSTRUMENTATION
+			inline bool il9_isAuditTraceRecording() { return false; }
+			inline int il9_startAuditTraceRecording(const std::string &) { return ITK_ok; }
+			inline void il9_stopAuditTraceRecording() {}
+			inline void il9_setAuditTraceReplay(const AuditTrace *) {}
+			inline bool il9_isAuditTraceReplaying() { return false; }
+			inline void il9_replayAuditEnquiry(const std::string &, int &nRows, int &nCols, void ****result) { nRows = 0; nCols = 0; *result = NULL; }
+			inline bool il9_isAuditTraceEnabled() { return false; }
+			inline void il9_traceAuditEnquiry(const std::string &, const std::vector< std::pair<std::string, std::string> > &, int, int, void ***) {}
+			inline void il9_traceAuditValue(tag_t, const char *, int, const void *) {}
+			inline void il9_traceAuditValues(tag_t, const char *, int, char **) {}
+			inline void il9_traceAuditClass(tag_t, const char *) {}
+			inline void il9_traceAuditPropertyTypes(const std::vector< ValidatePropertyInput > &) {}
+
+			class AuditTracedCall
+			{
+			public:
+				AuditTracedCall(AuditTraceFunction, tag_t, const date_t &, const std::string &, const std::vector< ValidatePropertyInput > &, size_t, int *) {}
+
+				template <typename T>
+				void setOutput(const T &) {}
+			};
+#else
+			bool il9_isAuditTraceRecording();
+
+			//starts recording into szFilePath, a running recording is stopped first; clears the prepared enquiry cache
+			int il9_startAuditTraceRecording(const std::string &szFilePath);
+
+			void il9_stopAuditTraceRecording();
+
+			/**
+			* Serves the enquiries of AuditEnquiry from the trace instead of POM while set, NULL stops the replay. Current values
+			* and audit record attributes read through AOM are not served here, the replay harness loads them into its
+			* stand-in ITK layer. Clears the prepared enquiry and result caches so enquiries are keyed from their first execution.
+			*/
+			void il9_setAuditTraceReplay(const AuditTrace *trace);
+
+			bool il9_isAuditTraceReplaying();
+
+			//result of the enquiry with the given key from the replayed trace, allocated like a POM result; throws IL9_AUDIT_TRACE_MISS
+			void il9_replayAuditEnquiry(const std::string &szKey, int &nRows, int &nCols, void ****result);
+
+			//true while recording or replaying, enquiries keep their select list and bind values for the key
+			bool il9_isAuditTraceEnabled();
+
+			/**
+			* Hooks recording what a traced call reads, no-ops outside of a traced call. Cell types of an enquiry are taken
+			* from the attribute names of the select list (class, attribute); an attribute which is neither an audit record
+			* column nor a property registered by the call or il9_traceAuditPropertyTypes leaves the enquiry unrecorded.
+			*/
+			void il9_traceAuditEnquiry(const std::string &szKey, const std::vector< std::pair<std::string, std::string> > &vectorSelectAttrs, int nRows, int nCols,
+				void ***result);
+
+			//answer of AOM_ask_value_* of the given POM type, pValue points to the value like an enquiry cell (char * for strings)
+			void il9_traceAuditValue(tag_t tObjectTag, const char *pcAttrName, int iType, const void *pValue);
+
+			//answer of AOM_ask_value_strings
+			void il9_traceAuditValues(tag_t tObjectTag, const char *pcAttrName, int numOfValues, char **pcValues);
+
+			void il9_traceAuditClass(tag_t tObjectTag, const char *pcClassName);
+
+			//registers the column types of properties an enquiry selects besides the ones passed to the traced call
+			void il9_traceAuditPropertyTypes(const std::vector< ValidatePropertyInput > &propNamesToValidate);
+
+			/**
+			* Records an entry point call for its lifetime, in the way AuditJournal journals it. Only the outermost traced call
+			* of a thread is recorded; it is written to the trace with everything it read when it ends. Outputs start after the
+			* numOfPreviousOutputs entries the caller's vector held on entry.
+			*/
+			class AuditTracedCall
+			{
+			public:
+				AuditTracedCall(AuditTraceFunction function, tag_t tObjectTag, const date_t &dtLoggedAfterDate, const std::string &strEventTypeName,
+					const std::vector< ValidatePropertyInput > &propNamesToValidate, size_t numOfPreviousOutputs, int *piFail);
+				~AuditTracedCall();
+
+				AuditTracedCall(const AuditTracedCall &) = delete;
+				AuditTracedCall &operator=(const AuditTracedCall &) = delete;
+
+				template <typename T>
+				void setOutput(const T &modifiedProperties)
+				{
+					if (m_isOwner) m_vectorOutputs = il9_formatAuditTraceOutputs(T(modifiedProperties.begin() + std::min(m_numOfPreviousOutputs,
+						modifiedProperties.size()), modifiedProperties.end()));
+				}
+
+			private:
+				bool m_isOwner;
+				size_t m_numOfPreviousOutputs;
+				int *m_piFail;
+				std::vector<std::string> m_vectorOutputs;
+			};
+#endif
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,414 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogValue.cxx
+* Description:  This file contains the compact property value representation of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogSchema.hxx"
+#include "IL9_AuditLogCompare.hxx"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+il9::utils::AuditLog::AuditValueArena::AuditValueArena(size_t blockSize) : m_blockSize(blockSize), m_pcCurrent(NULL), m_remaining(0), m_bytesAllocated(0)
+{
+}
+
+void *il9::utils::AuditLog::AuditValueArena::allocate(size_t size, size_t alignment)
+{
+	size_t padding = (alignment - ((size_t)m_pcCurrent % alignment)) % alignment;
+
+	if (m_pcCurrent == NULL || padding + size > m_remaining)
+	{
+		//oversized requests get a block of their own
+		size_t newBlockSize = std::max(m_blockSize, size + alignment);
+
+		m_blocks.push_back(std::unique_ptr<char[]>(new char[newBlockSize]));
+		m_pcCurrent = m_blocks.back().get();
+		m_remaining = newBlockSize;
+		m_bytesAllocated += newBlockSize;
+
+		padding = (alignment - ((size_t)m_pcCurrent % alignment)) % alignment;
+	}
+
+	void *pMemory = m_pcCurrent + padding;
+
+	m_pcCurrent += padding + size;
+	m_remaining -= padding + size;
+
+	return pMemory;
+}
+
+std::string_view il9::utils::AuditLog::AuditValueArena::copy(std::string_view svValue)
+{
+	if (svValue.empty()) return std::string_view();
+
+	char *pcData = (char *)allocate(svValue.size(), 1);
+	std::memcpy(pcData, svValue.data(), svValue.size());
+
+	return std::string_view(pcData, svValue.size());
+}
+
+const std::string_view *il9::utils::AuditLog::AuditValueArena::copyList(const std::vector<std::string_view> &vectorValues)
+{
+	if (vectorValues.empty()) return NULL;
+
+	std::string_view *pValues = (std::string_view *)allocate(sizeof(std::string_view) * vectorValues.size(), alignof(std::string_view));
+
+	for (size_t index = 0; index < vectorValues.size(); index++)
+	{
+		new (pValues + index) std::string_view(copy(vectorValues[index]));
+	}
+
+	return pValues;
+}
+
+void il9::utils::AuditLog::AuditValueArena::clear()
+{
+	m_blocks.clear();
+	m_pcCurrent = NULL;
+	m_remaining = 0;
+	m_bytesAllocated = 0;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofNull(int iType)
+{
+	AuditValue value;
+	value.m_iType = iType;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofLogical(logical lValue)
+{
+	AuditValue value;
+	value.m_iType = POM_logical;
+	value.m_isNull = false;
+	value.m_value.lValue = lValue;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofInt(int iValue)
+{
+	AuditValue value;
+	value.m_iType = POM_int;
+	value.m_isNull = false;
+	value.m_value.iValue = iValue;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofDouble(double dValue)
+{
+	AuditValue value;
+	value.m_iType = POM_double;
+	value.m_isNull = false;
+	value.m_value.dValue = dValue;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofDate(date_t dtValue)
+{
+	AuditValue value;
+	value.m_iType = POM_date;
+	value.m_isNull = false;
+	value.m_value.dtValue = dtValue;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofTag(tag_t tValue, int iType)
+{
+	AuditValue value;
+	value.m_iType = iType;
+	value.m_isNull = false;
+	value.m_value.tValue = tValue;
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofString(std::string_view svValue)
+{
+	AuditValue value;
+	value.m_iType = POM_string;
+	value.m_isNull = false;
+	value.m_value.stringValue.pcData = svValue.data();
+	value.m_value.stringValue.length = svValue.size();
+
+	return value;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::AuditValue::ofStringList(const std::string_view *pValues, size_t count, char cDelimiter)
+{
+	AuditValue value;
+	value.m_iType = POM_long_string;
+	value.m_isNull = false;
+	value.m_cDelimiter = cDelimiter;
+	value.m_value.listValue.pValues = pValues;
+	value.m_value.listValue.count = count;
+
+	return value;
+}
+
+std::string il9::utils::AuditLog::AuditValue::toString() const
+{
+	if (m_isNull) return std::string();
+
+	if (m_iType == POM_string) return std::string(asStringView());
+
+	if (m_iType == POM_long_string)
+	{
+		std::vector<std::string_view> vectorValues(m_value.listValue.pValues, m_value.listValue.pValues + m_value.listValue.count);
+		return il9_joinStringViews(vectorValues, m_cDelimiter);
+	}
+
+	return std::string();
+}
+
+std::any il9::utils::AuditLog::AuditValue::toAny() const
+{
+	switch (m_iType)
+	{
+		case(POM_string):
+		case(POM_long_string):
+			return std::any(toString());
+		case(POM_logical):
+			return std::any(m_isNull ? (logical)false : m_value.lValue);
+		case(POM_int):
+			return std::any(m_isNull ? 0 : m_value.iValue);
+		case(POM_double):
+			return std::any(m_isNull ? 0.0 : m_value.dValue);
+		case(POM_date):
+			return std::any(m_isNull ? NULLDATE : m_value.dtValue);
+		case(POM_external_reference):
+		case(POM_typed_reference):
+		case(POM_untyped_reference):
+			return std::any(m_isNull ? NULLTAG : m_value.tValue);
+		default:
+			return std::any();
+	}
+}
+
+il9::utils::AuditLog::PropertyInfo il9::utils::AuditLog::CompactPropertyInfo::toPropertyInfo() const
+{
+	PropertyInfo propertyInfo;
+
+	propertyInfo.szPropertyName = std::string(szPropertyName);
+	propertyInfo.szCurrentValue = currentValue.toAny();
+	propertyInfo.szOldValue = oldValue.toAny();
+
+	return propertyInfo;
+}
+
+il9::utils::AuditLog::AuditValue il9::utils::AuditLog::il9_auditValueOfCell(int iType, const void *pCell, AuditValueArena &arena)
+{
+	if (pCell == NULL) return AuditValue::ofNull(iType);
+
+	switch (iType)
+	{
+		case(POM_string):
+		case(POM_long_string):
+			return AuditValue::ofString(arena.copy((const char *)pCell));
+		case(POM_logical):
+			return AuditValue::ofLogical(*((const logical *)pCell));
+		case(POM_int):
+			return AuditValue::ofInt(*((const int *)pCell));
+		case(POM_double):
+			return AuditValue::ofDouble(*((const double *)pCell));
+		case(POM_date):
+			return AuditValue::ofDate(*((const date_t *)pCell));
+		case(POM_external_reference):
+		case(POM_typed_reference):
+		case(POM_untyped_reference):
+			return AuditValue::ofTag(*((const tag_t *)pCell), iType);
+		default:
+			return AuditValue::ofNull(iType);
+	}
+}
+
+bool il9::utils::AuditLog::il9_isSameAuditValue(const AuditValue &value, const AuditValue &otherValue)
+{
+	//a null string cell and an empty string are the same value for the audit comparison
+	bool isStringValue = (value.getType() == POM_string || value.getType() == POM_long_string);
+
+	if (value.isNull() || otherValue.isNull())
+	{
+		if (isStringValue) return value.toString().empty() && otherValue.toString().empty();
+
+		return value.isNull() == otherValue.isNull();
+	}
+
+	if (isStringValue)
+	{
+		//list values are compared with the comma separated form of the other value as multisets
+		std::vector<std::string_view> vecValues;
+		std::vector<std::string_view> vecOtherValues;
+
+		if (value.getType() == POM_long_string) for (size_t index = 0; index < value.listSize(); index++) vecValues.push_back(value.listValue(index));
+		else if (otherValue.getType() == POM_long_string) il9_tokenizeStringView(value.asStringView(), ',', vecValues);
+		else vecValues.push_back(value.asStringView());
+
+		if (otherValue.getType() == POM_long_string) for (size_t index = 0; index < otherValue.listSize(); index++) vecOtherValues.push_back(otherValue.listValue(index));
+		else if (value.getType() == POM_long_string) il9_tokenizeStringView(otherValue.asStringView(), ',', vecOtherValues);
+		else vecOtherValues.push_back(otherValue.asStringView());
+
+		return il9_isSameMultiset(vecValues, vecOtherValues);
+	}
+
+	switch (value.getType())
+	{
+		case(POM_logical):
+			return value.asLogical() == otherValue.asLogical();
+		case(POM_int):
+			return value.asInt() == otherValue.asInt();
+		case(POM_double):
+			return value.asDouble() == otherValue.asDouble();
+		case(POM_date):
+		{
+			date_t dtValue = value.asDate();
+			date_t dtOtherValue = otherValue.asDate();
+
+			return dtValue.year == dtOtherValue.year && dtValue.month == dtOtherValue.month && dtValue.day == dtOtherValue.day
+				&& dtValue.hour == dtOtherValue.hour && dtValue.minute == dtOtherValue.minute && dtValue.second == dtOtherValue.second;
+		}
+		default:
+			return value.asTag() == otherValue.asTag();
+	}
+}
+
+bool il9::utils::AuditLog::il9_compareAuditValue(int iType, const void *pOldCell, const SnapshotValue &current, AuditValueArena &arena,
+	AuditValue &currentValue, AuditValue &oldValue)
+{
+	switch (iType)
+	{
+		case(POM_string):
+		{
+			if (!AuditColumnComparator<POM_string>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofString(arena.copy(AuditColumnComparator<POM_string>::currentValue(current)));
+			oldValue = AuditValue::ofString(arena.copy(AuditColumnComparator<POM_string>::oldValue(pOldCell)));
+
+			return true;
+		}
+		case(POM_logical):
+		{
+			if (!AuditColumnComparator<POM_logical>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofLogical(AuditColumnComparator<POM_logical>::currentValue(current));
+			oldValue = AuditValue::ofLogical(AuditColumnComparator<POM_logical>::oldValue(pOldCell));
+
+			return true;
+		}
+		case(POM_int):
+		{
+			if (!AuditColumnComparator<POM_int>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofInt(AuditColumnComparator<POM_int>::currentValue(current));
+			oldValue = AuditValue::ofInt(AuditColumnComparator<POM_int>::oldValue(pOldCell));
+
+			return true;
+		}
+		case(POM_double):
+		{
+			if (!AuditColumnComparator<POM_double>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofDouble(AuditColumnComparator<POM_double>::currentValue(current));
+			oldValue = AuditValue::ofDouble(AuditColumnComparator<POM_double>::oldValue(pOldCell));
+
+			return true;
+		}
+		case(POM_date):
+		{
+			if (!AuditColumnComparator<POM_date>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofDate(AuditColumnComparator<POM_date>::currentValue(current));
+			oldValue = AuditValue::ofDate(AuditColumnComparator<POM_date>::oldValue(pOldCell));
+
+			return true;
+		}
+		case(POM_external_reference):
+		case(POM_typed_reference):
+		case(POM_untyped_reference):
+		{
+			if (!AuditColumnComparator<POM_external_reference>::isModified(pOldCell, current)) return false;
+
+			currentValue = AuditValue::ofTag(AuditColumnComparator<POM_external_reference>::currentValue(current), iType);
+			oldValue = AuditValue::ofTag(AuditColumnComparator<POM_external_reference>::oldValue(pOldCell), iType);
+
+			return true;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+}
+
+bool il9::utils::AuditLog::il9_compareLongStringAuditValue(const char *pcOldValue, const SnapshotValue &current, AuditValueArena &arena,
+	AuditValue &currentValue, AuditValue &oldValue)
+{
+	std::vector<std::string_view> vecCurrentValues(current.vectorValues.begin(), current.vectorValues.end());
+	std::vector<std::string_view> vecOldValues;
+
+	std::string_view svValueOld = (pcOldValue != NULL) ? std::string_view(pcOldValue) : std::string_view();
+	il9_tokenizeStringView(svValueOld, ',', vecOldValues);
+
+	if (il9_isSameMultiset(vecCurrentValues, vecOldValues)) return false;
+
+	currentValue = AuditValue::ofStringList(arena.copyList(vecCurrentValues), vecCurrentValues.size(), ',');
+	oldValue = AuditValue::ofString(arena.copy(svValueOld));
+
+	return true;
+}
+
+long long il9::utils::AuditLog::il9_secondsOfAuditDate(const date_t &dtValue)
+{
+	//days from the civil date, months of date_t are 0 based
+	int iYear = dtValue.year;
+	int iMonth = dtValue.month + 1;
+	if (iMonth <= 2) iYear--;
+
+	long long era = (iYear >= 0 ? iYear : iYear - 399) / 400;
+	long long yearOfEra = iYear - era * 400;
+	long long dayOfYear = (153 * (iMonth + (iMonth > 2 ? -3 : 9)) + 2) / 5 + dtValue.day - 1;
+	long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+	long long days = era * 146097 + dayOfEra;
+
+	return days * 86400 + dtValue.hour * 3600 + dtValue.minute * 60 + dtValue.second;
+}
+
+date_t il9::utils::AuditLog::il9_auditDateOfSeconds(long long seconds)
+{
+	long long days = (seconds >= 0 ? seconds : seconds - 86399) / 86400;
+	long long secondOfDay = seconds - days * 86400;
+
+	//civil date from the days, same eras as il9_secondsOfAuditDate
+	long long era = (days >= 0 ? days : days - 146096) / 146097;
+	long long dayOfEra = days - era * 146097;
+	long long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+	long long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+	long long monthIndex = (5 * dayOfYear + 2) / 153;
+	long long month = monthIndex + (monthIndex < 10 ? 3 : -9);
+
+	date_t dtValue = NULLDATE;
+	dtValue.year = (short)(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+	dtValue.month = (unsigned char)(month - 1);
+	dtValue.day = (unsigned char)(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+	dtValue.hour = (unsigned char)(secondOfDay / 3600);
+	dtValue.minute = (unsigned char)(secondOfDay % 3600 / 60);
+	dtValue.second = (unsigned char)(secondOfDay % 60);
+
+	return dtValue;
+}
@@ -0,0 +1,156 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogValue.hxx
+* Description:  This file contains the compact property value representation of the
+*				Audit Logs utilities
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGVALUE_HXX
+#define IL9_AUDITLOGVALUE_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			struct SnapshotValue;
+
+			/**
+			* Monotonic memory of the string data referenced by AuditValue. Memory is handed out from large blocks and
+			* released all at once by clear() or the destructor, values referencing the arena must not outlive it.
+			*/
+			class AuditValueArena
+			{
+			public:
+				explicit AuditValueArena(size_t blockSize = 64 * 1024);
+
+				AuditValueArena(const AuditValueArena &) = delete;
+				AuditValueArena &operator=(const AuditValueArena &) = delete;
+
+				std::string_view copy(std::string_view svValue);
+				const std::string_view *copyList(const std::vector<std::string_view> &vectorValues);
+
+				void clear();
+				size_t bytesAllocated() const { return m_bytesAllocated; }
+
+			private:
+				void *allocate(size_t size, size_t alignment);
+
+				std::vector< std::unique_ptr<char[]> > m_blocks;
+				size_t m_blockSize;
+				char *m_pcCurrent;
+				size_t m_remaining;
+				size_t m_bytesAllocated;
+			};
+
+			/**
+			* Property value without heap allocation: POD values are held inline, strings as views (normally into an
+			* AuditValueArena) and long string values as a list of views which is only joined when the value is read.
+			*/
+			class AuditValue
+			{
+			public:
+				AuditValue() : m_iType(0), m_isNull(true), m_cDelimiter(',') { m_value.tValue = NULLTAG; }
+
+				static AuditValue ofNull(int iType);
+				static AuditValue ofLogical(logical lValue);
+				static AuditValue ofInt(int iValue);
+				static AuditValue ofDouble(double dValue);
+				static AuditValue ofDate(date_t dtValue);
+				static AuditValue ofTag(tag_t tValue, int iType);
+				static AuditValue ofString(std::string_view svValue);
+				static AuditValue ofStringList(const std::string_view *pValues, size_t count, char cDelimiter);
+
+				int getType() const { return m_iType; }
+				bool isNull() const { return m_isNull; }
+
+				logical asLogical() const { return m_value.lValue; }
+				int asInt() const { return m_value.iValue; }
+				double asDouble() const { return m_value.dValue; }
+				date_t asDate() const { return m_value.dtValue; }
+				tag_t asTag() const { return m_value.tValue; }
+				std::string_view asStringView() const { return std::string_view(m_value.stringValue.pcData, m_value.stringValue.length); }
+				size_t listSize() const { return m_value.listValue.count; }
+				std::string_view listValue(size_t index) const { return m_value.listValue.pValues[index]; }
+				char getDelimiter() const { return m_cDelimiter; }
+
+				//string or joined long string value, empty for other types
+				std::string toString() const;
+
+				//boxes the value the way PropertyInfo did so far: std::string for (long) strings, the POD value otherwise
+				std::any toAny() const;
+
+			private:
+				int m_iType;
+				bool m_isNull;
+				char m_cDelimiter;
+
+				union
+				{
+					logical lValue;
+					int iValue;
+					double dValue;
+					date_t dtValue;
+					tag_t tValue;
+					struct { const char *pcData; size_t length; } stringValue;
+					struct { const std::string_view *pValues; size_t count; } listValue;
+				} m_value;
+			};
+
+			//PropertyInfo counterpart built on AuditValue, the property name references the arena as well
+			struct CompactPropertyInfo
+			{
+				tag_t objectTag = NULLTAG;
+				std::string_view szPropertyName;
+				AuditValue currentValue;
+				AuditValue oldValue;
+
+				PropertyInfo toPropertyInfo() const;
+			};
+
+			//decodes an enquiry result cell of the given POM type, NULL cells give a null value; strings are copied into the arena
+			AuditValue il9_auditValueOfCell(int iType, const void *pCell, AuditValueArena &arena);
+
+			//true when both values are of the same kind and equal (dates field wise, long string lists as multisets)
+			bool il9_isSameAuditValue(const AuditValue &value, const AuditValue &otherValue);
+
+			/**
+			* Compares the old value cell of an audit result row against the current value of a non long string property.
+			* Values are only set (and strings only copied into the arena) when the property is modified.
+			*/
+			bool il9_compareAuditValue(int iType, const void *pOldCell, const SnapshotValue &current, AuditValueArena &arena,
+				AuditValue &currentValue, AuditValue &oldValue);
+
+			/**
+			* Compares the old long string value of an audit record against the current values of a long string property.
+			* When modified the current values are kept as a list in the arena and joined only when read.
+			*/
+			bool il9_compareLongStringAuditValue(const char *pcOldValue, const SnapshotValue &current, AuditValueArena &arena,
+				AuditValue &currentValue, AuditValue &oldValue);
+
+			//seconds of a date since 0000-03-01, only differences and comparisons are meaningful
+			long long il9_secondsOfAuditDate(const date_t &dtValue);
+
+			//inverse of il9_secondsOfAuditDate
+			date_t il9_auditDateOfSeconds(long long seconds);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,824 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogWatermark.cxx
+* Description:  This file contains definitions of the persisted audit watermarks used
+*				for incremental Audit Logs scans
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogWatermark.hxx"
+#include "IL9_AuditLogBaseline.hxx"
+#include "IL9_AuditLogSnapshot.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogSchema.hxx"
+#include "IL9_AuditLogCompare.hxx"
+#include "IL9_AuditLogInstrumentation.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_ArgumentValidation.hxx"
+
+#include <tc/tc.h>
+#include <pom/pom/pom.h>
+#include <tccore/aom_prop.h>
+#include <fclasses/tc_date.h>
+
+#include <mld/logging/Logger.hxx>
+#include <base_utils/TcResultStatus.hxx>
+#include <base_utils/ScopedSmPtr.hxx>
+#include <base_utils/IFail.hxx>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+
+using namespace Teamcenter;
+
+namespace
+{
+	const char *const LAST_MOD_DATE_ATTR = "last_mod_date";
+
+	//first line of the watermark file, the number is the file format version
+	const char *const WATERMARK_FILE_HEADER = "IL9_AUDIT_WATERMARKS\t2";
+
+	//version 1 also kept the newest audit record read, its lines are read without those two fields
+	const char *const WATERMARK_FILE_HEADER_V1 = "IL9_AUDIT_WATERMARKS\t1";
+
+	const uint64_t FINGERPRINT_OFFSET_BASIS = 14695981039346656037ULL;
+	const uint64_t FINGERPRINT_PRIME = 1099511628211ULL;
+
+	//FNV-1a, stable across processes and platforms unlike std::hash
+	uint64_t addToFingerprint(uint64_t fingerprint, const void *pData, size_t length)
+	{
+		const unsigned char *pcData = (const unsigned char *)pData;
+
+		for (size_t index = 0; index < length; index++)
+		{
+			fingerprint ^= pcData[index];
+			fingerprint *= FINGERPRINT_PRIME;
+		}
+
+		return fingerprint;
+	}
+
+	uint64_t addToFingerprint(uint64_t fingerprint, std::string_view svValue)
+	{
+		uint64_t length = svValue.size();
+
+		fingerprint = addToFingerprint(fingerprint, &length, sizeof(length));
+		return addToFingerprint(fingerprint, svValue.data(), svValue.size());
+	}
+
+	//all reference types share one class so that the fingerprint only depends on the value
+	uint64_t startFingerprint(int iType)
+	{
+		int iTypeClass = (iType == POM_typed_reference || iType == POM_untyped_reference) ? POM_external_reference : iType;
+		return addToFingerprint(FINGERPRINT_OFFSET_BASIS, &iTypeClass, sizeof(iTypeClass));
+	}
+
+	uint64_t fingerprintOfDate(const date_t &dtValue)
+	{
+		int fields[] = { dtValue.year, dtValue.month, dtValue.day, dtValue.hour, dtValue.minute, dtValue.second };
+		return addToFingerprint(startFingerprint(POM_date), fields, sizeof(fields));
+	}
+
+	//tags are session local, references are fingerprinted by UID
+	uint64_t fingerprintOfTag(tag_t tValue)
+	{
+		ResultStatus status(0);
+		std::string szUid;
+
+		if (tValue != NULLTAG)
+		{
+			scoped_smptr<char> spUid;
+			status = POM_tag_to_uid(tValue, &spUid);
+
+			if (spUid.get() != NULL) szUid = spUid.getString();
+		}
+
+		return addToFingerprint(startFingerprint(POM_external_reference), szUid);
+	}
+
+	//long string values are compared as multisets, the fingerprint is built over the sorted values
+	uint64_t fingerprintOfList(std::vector<std::string_view> &vectorValues)
+	{
+		std::sort(vectorValues.begin(), vectorValues.end());
+
+		uint64_t fingerprint = startFingerprint(POM_long_string);
+		for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++) fingerprint = addToFingerprint(fingerprint, vectorValues[indexValue]);
+
+		return fingerprint;
+	}
+
+	//fingerprint of an old value cell, NULL cells give the default value the same way the column comparators do
+	uint64_t fingerprintOfCell(int iType, const void *pCell)
+	{
+		switch (iType)
+		{
+			case(POM_string):
+			{
+				return addToFingerprint(startFingerprint(iType), il9::utils::AuditLog::AuditColumnComparator<POM_string>::oldValue(pCell));
+			}
+			case(POM_long_string):
+			{
+				std::vector<std::string_view> vectorValues;
+				il9::utils::AuditLog::il9_tokenizeStringView((pCell != NULL) ? std::string_view((const char *)pCell) : std::string_view(), ',', vectorValues);
+
+				return fingerprintOfList(vectorValues);
+			}
+			case(POM_logical):
+			{
+				logical lValue = il9::utils::AuditLog::AuditColumnComparator<POM_logical>::oldValue(pCell);
+				int iValue = lValue ? 1 : 0;
+
+				return addToFingerprint(startFingerprint(iType), &iValue, sizeof(iValue));
+			}
+			case(POM_int):
+			{
+				int iValue = il9::utils::AuditLog::AuditColumnComparator<POM_int>::oldValue(pCell);
+				return addToFingerprint(startFingerprint(iType), &iValue, sizeof(iValue));
+			}
+			case(POM_double):
+			{
+				//-0.0 compares equal to 0.0
+				double dValue = il9::utils::AuditLog::AuditColumnComparator<POM_double>::oldValue(pCell);
+				if (dValue == 0.0) dValue = 0.0;
+
+				return addToFingerprint(startFingerprint(iType), &dValue, sizeof(dValue));
+			}
+			case(POM_date):
+			{
+				return fingerprintOfDate(il9::utils::AuditLog::AuditColumnComparator<POM_date>::oldValue(pCell));
+			}
+			case(POM_external_reference):
+			case(POM_typed_reference):
+			case(POM_untyped_reference):
+			{
+				return fingerprintOfTag(il9::utils::AuditLog::AuditColumnComparator<POM_external_reference>::oldValue(pCell));
+			}
+			default:
+			{
+				return startFingerprint(iType);
+			}
+		}
+	}
+
+	uint64_t fingerprintOfCurrentValue(int iType, const il9::utils::AuditLog::SnapshotValue &current)
+	{
+		//a NULL current value has the fingerprint of a NULL cell, both are read as the default of the type
+		if (current.isNull && iType != POM_long_string) return fingerprintOfCell(iType, NULL);
+
+		switch (iType)
+		{
+			case(POM_string):
+			{
+				return fingerprintOfCell(iType, current.szValue.c_str());
+			}
+			case(POM_long_string):
+			{
+				std::vector<std::string_view> vectorValues(current.vectorValues.begin(), current.vectorValues.end());
+				return fingerprintOfList(vectorValues);
+			}
+			case(POM_logical): return fingerprintOfCell(iType, &current.lValue);
+			case(POM_int): return fingerprintOfCell(iType, &current.iValue);
+			case(POM_double): return fingerprintOfCell(iType, &current.dValue);
+			case(POM_date): return fingerprintOfCell(iType, &current.dtValue);
+			case(POM_external_reference):
+			case(POM_typed_reference):
+			case(POM_untyped_reference): return fingerprintOfCell(iType, &current.tValue);
+			default: return startFingerprint(iType);
+		}
+	}
+
+	//old value of a property read from an audit record, cell points into the holder the way enquiry result cells do
+	struct AuditRecordValue
+	{
+		logical lValue = false;
+		int iValue = 0;
+		double dValue = 0.0;
+		date_t dtValue = NULLDATE;
+		tag_t tValue = NULLTAG;
+		scoped_smptr<char> spValue;
+		const void *pCell = NULL;
+	};
+
+	void readAuditRecordValue(tag_t auditObjectTag, const il9::utils::AuditLog::ValidatePropertyInput &propertyInput, AuditRecordValue &value)
+	{
+		ResultStatus status(0);
+		const char *pcPropertyNameOld = propertyInput.szPropertyNameOld.c_str();
+
+		switch (propertyInput.iType)
+		{
+			case(POM_string):
+			case(POM_long_string):
+			{
+				status = AOM_ask_value_string(auditObjectTag, pcPropertyNameOld, &value.spValue);
+				value.pCell = value.spValue.get();
+				break;
+			}
+			case(POM_logical):
+			{
+				status = AOM_ask_value_logical(auditObjectTag, pcPropertyNameOld, &value.lValue);
+				value.pCell = &value.lValue;
+				break;
+			}
+			case(POM_int):
+			{
+				status = AOM_ask_value_int(auditObjectTag, pcPropertyNameOld, &value.iValue);
+				value.pCell = &value.iValue;
+				break;
+			}
+			case(POM_double):
+			{
+				status = AOM_ask_value_double(auditObjectTag, pcPropertyNameOld, &value.dValue);
+				value.pCell = &value.dValue;
+				break;
+			}
+			case(POM_date):
+			{
+				status = AOM_ask_value_date(auditObjectTag, pcPropertyNameOld, &value.dtValue);
+				value.pCell = &value.dtValue;
+				break;
+			}
+			case(POM_external_reference):
+			case(POM_typed_reference):
+			case(POM_untyped_reference):
+			{
+				status = AOM_ask_value_tag(auditObjectTag, pcPropertyNameOld, &value.tValue);
+				value.pCell = &value.tValue;
+				break;
+			}
+		}
+	}
+
+	//where the baseline values of an object come from: a row of the audit enquiry or a stored watermark
+	struct AuditBaselineSource
+	{
+		tag_t auditObjectTag = NULLTAG;
+		void ***result = NULL;
+		int baselineRow = -1;
+		const std::vector<int> *propertyCols = NULL;
+		const std::vector<uint64_t> *storedFingerprints = NULL;
+	};
+
+	/**
+	* Compares the current values of an object with its baseline. For an enquiry row the fingerprints of the baseline
+	* values are computed into baselineFingerprints; for a stored watermark the stored fingerprints decide which
+	* properties are compared against the values read from the audit record.
+	*/
+	void evaluateObject(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate,
+		const il9::utils::AuditLog::PropertyValueSnapshot &currentValues, const AuditBaselineSource &baselineSource,
+		il9::utils::AuditLog::AuditValueArena &arena, std::vector<uint64_t> &baselineFingerprints,
+		std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties, long &auditRecordReads)
+	{
+		ResultStatus status(0);
+		std::unordered_set<std::string> hsModifiedPropertyNames;
+
+		il9::utils::AuditLog::CompactPropertyInfo propertyInfo;
+		propertyInfo.objectTag = tObjectTag;
+
+		baselineFingerprints.assign(propNamesToValidate.size(), 0);
+
+		for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+		{
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = propNamesToValidate[indexPropInput];
+			const il9::utils::AuditLog::SnapshotValue *current = currentValues.getValue(tObjectTag, indexPropInput);
+
+			AuditRecordValue auditRecordValue;
+			const void *pOldCell = NULL;
+
+			if (baselineSource.storedFingerprints != NULL)
+			{
+				baselineFingerprints[indexPropInput] = (*baselineSource.storedFingerprints)[indexPropInput];
+
+				if (current == NULL || hsModifiedPropertyNames.count(propertyInput.szPropertyName) > 0) continue;
+				if (fingerprintOfCurrentValue(propertyInput.iType, *current) == baselineFingerprints[indexPropInput]) continue;
+
+				readAuditRecordValue(baselineSource.auditObjectTag, propertyInput, auditRecordValue);
+				pOldCell = auditRecordValue.pCell;
+				auditRecordReads++;
+			}
+			else
+			{
+				int propertyColIndex = (*baselineSource.propertyCols)[indexPropInput];
+
+				if (propertyInput.iType == POM_long_string)
+				{
+					readAuditRecordValue(baselineSource.auditObjectTag, propertyInput, auditRecordValue);
+					pOldCell = auditRecordValue.pCell;
+				}
+				else if (propertyColIndex > 0)
+				{
+					pOldCell = baselineSource.result[baselineSource.baselineRow][propertyColIndex + 1];
+				}
+				else
+				{
+					continue;
+				}
+
+				baselineFingerprints[indexPropInput] = fingerprintOfCell(propertyInput.iType, pOldCell);
+
+				if (current == NULL || hsModifiedPropertyNames.count(propertyInput.szPropertyName) > 0) continue;
+			}
+
+			bool isModified = (propertyInput.iType == POM_long_string)
+				? il9::utils::AuditLog::il9_compareLongStringAuditValue((const char *)pOldCell, *current, arena, propertyInfo.currentValue, propertyInfo.oldValue)
+				: il9::utils::AuditLog::il9_compareAuditValue(propertyInput.iType, pOldCell, *current, arena, propertyInfo.currentValue, propertyInfo.oldValue);
+
+			if (isModified)
+			{
+				propertyInfo.szPropertyName = propertyInput.szPropertyName;
+				modifiedProperties.push_back(propertyInfo.toPropertyInfo());
+				hsModifiedPropertyNames.insert(propertyInput.szPropertyName);
+			}
+		}
+
+		arena.clear();
+	}
+
+	bool isSameDate(const date_t &dtValue, const date_t &dtOtherValue)
+	{
+		return dtValue.year == dtOtherValue.year && dtValue.month == dtOtherValue.month && dtValue.day == dtOtherValue.day
+			&& dtValue.hour == dtOtherValue.hour && dtValue.minute == dtOtherValue.minute && dtValue.second == dtOtherValue.second;
+	}
+
+	std::string dateToString(const date_t &dtValue)
+	{
+		std::string szValue = std::to_string(dtValue.year);
+
+		szValue.append(".").append(std::to_string(dtValue.month)).append(".").append(std::to_string(dtValue.day));
+		szValue.append(".").append(std::to_string(dtValue.hour)).append(".").append(std::to_string(dtValue.minute)).append(".").append(std::to_string(dtValue.second));
+
+		return szValue;
+	}
+
+	bool dateFromString(const std::string &szValue, date_t &dtValue)
+	{
+		int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+		if (sscanf(szValue.c_str(), "%d.%d.%d.%d.%d.%d", &year, &month, &day, &hour, &minute, &second) != 6) return false;
+
+		dtValue.year = (short)year;
+		dtValue.month = (unsigned char)month;
+		dtValue.day = (unsigned char)day;
+		dtValue.hour = (unsigned char)hour;
+		dtValue.minute = (unsigned char)minute;
+		dtValue.second = (unsigned char)second;
+
+		return true;
+	}
+
+	std::vector<std::string> splitFields(const std::string &szLine, char cDelimiter)
+	{
+		std::vector<std::string> vectorFields;
+		std::string szField;
+		std::istringstream streamLine(szLine);
+
+		while (std::getline(streamLine, szField, cDelimiter)) vectorFields.push_back(szField);
+		if (!szLine.empty() && szLine.back() == cDelimiter) vectorFields.push_back("");
+
+		return vectorFields;
+	}
+
+	//empty UIDs are written as "-" so that every field is non empty
+	std::string uidToField(const std::string &szUid)
+	{
+		return szUid.empty() ? "-" : szUid;
+	}
+
+	std::string uidFromField(const std::string &szField)
+	{
+		return (szField == "-") ? std::string() : szField;
+	}
+
+	//objects of one chunk which have to be read from the audit table, with the date to read from
+	struct AuditQueryGroup
+	{
+		std::vector<tag_t> vectorObjectTags;
+		date_t dtLoggedAfterDate = NULLDATE;
+	};
+}
+
+il9::utils::AuditLog::AuditWatermarkStore::AuditWatermarkStore(const std::string &szFilePath) : m_szFilePath(szFilePath), m_isDirty(false)
+{
+}
+
+int il9::utils::AuditLog::AuditWatermarkStore::load()
+{
+	int iFail = ITK_ok;
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	m_hmWatermarks.clear();
+	m_isDirty = false;
+
+	std::ifstream streamFile(m_szFilePath.c_str());
+	if (!streamFile.is_open()) return iFail;
+
+	try
+	{
+		std::string szLine;
+
+		if (!std::getline(streamFile, szLine) || (szLine != WATERMARK_FILE_HEADER && szLine != WATERMARK_FILE_HEADER_V1)) throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+
+		bool isVersion1 = (szLine == WATERMARK_FILE_HEADER_V1);
+
+		//key, baseline uid, baseline date, last_mod_date, fingerprints
+		while (std::getline(streamFile, szLine))
+		{
+			if (szLine.empty()) continue;
+
+			std::vector<std::string> vectorFields = splitFields(szLine, '\t');
+			if (vectorFields.size() != (isVersion1 ? 7 : 5)) throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+
+			if (isVersion1) vectorFields.erase(vectorFields.begin() + 3, vectorFields.begin() + 5);
+
+			AuditWatermark watermark;
+			watermark.szBaselineAuditUid = uidFromField(vectorFields[1]);
+
+			if (!dateFromString(vectorFields[2], watermark.dtBaselineLoggedDate) || !dateFromString(vectorFields[3], watermark.dtObjectLastModDate))
+			{
+				throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+			}
+
+			std::vector<std::string> vectorFingerprints = splitFields(vectorFields[4], ',');
+
+			for (size_t indexFingerprint = 0; indexFingerprint < vectorFingerprints.size(); indexFingerprint++)
+			{
+				if (vectorFingerprints[indexFingerprint].empty()) continue;
+				watermark.baselineFingerprints.push_back(std::strtoull(vectorFingerprints[indexFingerprint].c_str(), NULL, 16));
+			}
+
+			m_hmWatermarks[vectorFields[0]] = watermark;
+		}
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), "invalid audit watermark file " + m_szFilePath);
+
+		m_hmWatermarks.clear();
+	}
+
+	return iFail;
+}
+
+int il9::utils::AuditLog::AuditWatermarkStore::save()
+{
+	int iFail = ITK_ok;
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	if (!m_isDirty) return iFail;
+
+	std::string szTempFilePath = m_szFilePath + ".tmp";
+
+	try
+	{
+		{
+			std::ofstream streamFile(szTempFilePath.c_str(), std::ios::out | std::ios::trunc);
+			if (!streamFile.is_open()) throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+
+			streamFile << WATERMARK_FILE_HEADER << "\n";
+
+			for (std::unordered_map<std::string, AuditWatermark>::const_iterator itWatermark = m_hmWatermarks.begin(); itWatermark != m_hmWatermarks.end(); ++itWatermark)
+			{
+				const AuditWatermark &watermark = itWatermark->second;
+
+				streamFile << itWatermark->first << "\t" << uidToField(watermark.szBaselineAuditUid) << "\t" << dateToString(watermark.dtBaselineLoggedDate)
+					<< "\t" << dateToString(watermark.dtObjectLastModDate) << "\t";
+
+				for (size_t indexFingerprint = 0; indexFingerprint < watermark.baselineFingerprints.size(); indexFingerprint++)
+				{
+					if (indexFingerprint > 0) streamFile << ",";
+					streamFile << std::hex << watermark.baselineFingerprints[indexFingerprint] << std::dec;
+				}
+
+				streamFile << "\n";
+			}
+
+			streamFile.flush();
+			if (!streamFile.good()) throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+		}
+
+		//rename replaces the previous file in one step on POSIX, the target has to be removed first on Windows
+#ifdef _WIN32
+		std::remove(m_szFilePath.c_str());
+#endif
+		if (std::rename(szTempFilePath.c_str(), m_szFilePath.c_str()) != 0) throw IFail(IL9_AUDIT_WATERMARK_STORE_ERROR);
+
+		m_isDirty = false;
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), "cannot write audit watermark file " + m_szFilePath);
+
+		std::remove(szTempFilePath.c_str());
+	}
+
+	return iFail;
+}
+
+const il9::utils::AuditLog::AuditWatermark *il9::utils::AuditLog::AuditWatermarkStore::find(const std::string &szKey) const
+{
+	std::unordered_map<std::string, AuditWatermark>::const_iterator itWatermark = m_hmWatermarks.find(szKey);
+	return (itWatermark != m_hmWatermarks.end()) ? &itWatermark->second : NULL;
+}
+
+void il9::utils::AuditLog::AuditWatermarkStore::put(const std::string &szKey, const AuditWatermark &watermark)
+{
+	m_hmWatermarks[szKey] = watermark;
+	m_isDirty = true;
+}
+
+void il9::utils::AuditLog::AuditWatermarkStore::clear()
+{
+	m_isDirty = m_isDirty || !m_hmWatermarks.empty();
+	m_hmWatermarks.clear();
+}
+
+std::string il9::utils::AuditLog::il9_buildAuditWatermarkKey(const std::string &szObjectUid, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+	const std::vector< ValidatePropertyInput > &propNamesToValidate)
+{
+	//the property list is part of the key through a fingerprint, fingerprints are stored in list order
+	uint64_t propertiesFingerprint = FINGERPRINT_OFFSET_BASIS;
+
+	for (size_t indexPropInput = 0; indexPropInput < propNamesToValidate.size(); indexPropInput++)
+	{
+		propertiesFingerprint = addToFingerprint(propertiesFingerprint, propNamesToValidate[indexPropInput].szPropertyName);
+		propertiesFingerprint = addToFingerprint(propertiesFingerprint, propNamesToValidate[indexPropInput].szPropertyNameOld);
+		propertiesFingerprint = addToFingerprint(propertiesFingerprint, &propNamesToValidate[indexPropInput].iType, sizeof(int));
+	}
+
+	std::ostringstream streamKey;
+	streamKey << szObjectUid << "|" << strEventTypeName << "|" << dateToString(dtLoggedAfterDate) << "|" << std::hex << propertiesFingerprint;
+
+	return streamKey.str();
+}
+
+int il9::utils::AuditLog::il9_getModifiedPropertiesInfoIncremental(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+	std::vector< ValidatePropertyInput > propNamesToValidate, AuditWatermarkStore &store,
+	std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject, AuditIncrementalScanStatistics *statistics, int iChunkSize)
+{
+	int iFail = ITK_ok;
+	ResultStatus status(0);
+
+	//logger
+	Teamcenter::Logging::Logger *logger = il9::utils::AuditLog::il9_getAuditLogger();
+	il9::utils::AuditLog::AuditLogEntryExit logEntryExit(logger, __func__);
+
+	//profiling
+	il9::utils::AuditLog::AuditProfiledCall profiledCall(__func__, &iFail);
+
+	//journalling
+	il9::utils::AuditLog::AuditJournal journalling(__func__, &iFail);
+	journalling.setInput((int)objectTags.size());
+	journalling.journalRoutineCall();
+
+	AuditIncrementalScanStatistics scanStatistics;
+
+	try
+	{
+		//input validations
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, dtLoggedAfterDate, "dtLoggedAfterDate");
+		status = il9::validation::il9_validateInputArgument(logger, __FILE__, __LINE__, strEventTypeName, "eventTypeName");
+
+		if (iChunkSize <= 0) iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE;
+
+		//drop null tags and duplicates while keeping the caller's order
+		std::vector<tag_t> vectorUniqueObjectTags;
+		std::unordered_set<tag_t> hsSeenObjectTags;
+
+		for (int indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			if (objectTags[indexObject] != NULLTAG && hsSeenObjectTags.insert(objectTags[indexObject]).second)
+			{
+				vectorUniqueObjectTags.push_back(objectTags[indexObject]);
+			}
+		}
+
+		//only saves of the object log the pre-filter event type, the records of other event types say nothing about last_mod_date
+		bool isLastModDateBound = (strEventTypeName == IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME);
+		long long loggedAfterSeconds = il9::utils::AuditLog::il9_secondsOfAuditDate(dtLoggedAfterDate);
+		long long slackSeconds = il9::utils::AuditLog::il9_getAuditPrefilterSlackSeconds();
+
+		//last_mod_date is loaded with the current values, it is appended so property indexes stay the same
+		std::vector< ValidatePropertyInput > propNamesToLoad = propNamesToValidate;
+		propNamesToLoad.push_back({ LAST_MOD_DATE_ATTR, "", POM_date });
+
+		std::vector<int> vectorPropertyCols;
+
+		il9::utils::AuditLog::AuditValueArena arena;
+
+		for (size_t chunkStart = 0; chunkStart < vectorUniqueObjectTags.size(); chunkStart += iChunkSize)
+		{
+			size_t chunkEnd = std::min(vectorUniqueObjectTags.size(), chunkStart + (size_t)iChunkSize);
+			std::vector<tag_t> vectorChunkObjectTags(vectorUniqueObjectTags.begin() + chunkStart, vectorUniqueObjectTags.begin() + chunkEnd);
+
+			il9::utils::AuditLog::PropertyValueSnapshot currentValues;
+			status = currentValues.load(vectorChunkObjectTags, propNamesToLoad, iChunkSize);
+
+			//new objects are read from dtLoggedAfterDate, objects without audit record so far from the oldest stored last_mod_date
+			AuditQueryGroup newObjects;
+			newObjects.dtLoggedAfterDate = dtLoggedAfterDate;
+
+			AuditQueryGroup changedObjects;
+
+			std::unordered_map<tag_t, std::string> hmKeyByObject;
+			std::unordered_map<tag_t, date_t> hmLastModDateByObject;
+
+			for (size_t indexObject = 0; indexObject < vectorChunkObjectTags.size(); indexObject++)
+			{
+				tag_t tObjectTag = vectorChunkObjectTags[indexObject];
+
+				scoped_smptr<char> spUid;
+				status = POM_tag_to_uid(tObjectTag, &spUid);
+
+				std::string szKey = il9::utils::AuditLog::il9_buildAuditWatermarkKey(spUid.getString(), dtLoggedAfterDate, strEventTypeName, propNamesToValidate);
+
+				const il9::utils::AuditLog::SnapshotValue *lastModDate = currentValues.getValue(tObjectTag, propNamesToValidate.size());
+				if (lastModDate != NULL && lastModDate->isNull) lastModDate = NULL;
+
+				date_t dtObjectLastModDate = (lastModDate != NULL) ? lastModDate->dtValue : NULLDATE;
+
+				hmKeyByObject[tObjectTag] = szKey;
+				hmLastModDateByObject[tObjectTag] = dtObjectLastModDate;
+
+				const AuditWatermark *watermark = store.find(szKey);
+
+				if (watermark != NULL && watermark->hasBaseline() && watermark->baselineFingerprints.size() == propNamesToValidate.size())
+				{
+					tag_t auditObjectTag = NULLTAG;
+					ITK__convert_uid_to_tag(watermark->szBaselineAuditUid.c_str(), &auditObjectTag);
+
+					//the baseline audit record may have been purged, the object is read again in that case
+					if (auditObjectTag != NULLTAG)
+					{
+						AuditBaselineSource baselineSource;
+						baselineSource.auditObjectTag = auditObjectTag;
+						baselineSource.storedFingerprints = &watermark->baselineFingerprints;
+
+						std::vector<uint64_t> baselineFingerprints;
+						std::vector< PropertyInfo > modifiedProperties;
+
+						evaluateObject(tObjectTag, propNamesToValidate, currentValues, baselineSource, arena, baselineFingerprints, modifiedProperties,
+							scanStatistics.auditRecordReads);
+
+						if (!modifiedProperties.empty()) modifiedPropertiesByObject[tObjectTag].swap(modifiedProperties);
+
+						scanStatistics.objectsFromWatermark++;
+						continue;
+					}
+				}
+				else if (isLastModDateBound && watermark != NULL && !watermark->hasBaseline() && lastModDate != NULL
+					&& isSameDate(watermark->dtObjectLastModDate, dtObjectLastModDate)
+					&& il9::utils::AuditLog::il9_secondsOfAuditDate(dtObjectLastModDate) + slackSeconds < loggedAfterSeconds)
+				{
+					//not saved since the previous run and, as in the pre-filter, saved too long before the date to have a record
+					scanStatistics.objectsUnchanged++;
+					continue;
+				}
+
+				if (isLastModDateBound && watermark != NULL && !watermark->hasBaseline())
+				{
+					//rows logged before the stored last_mod_date were read by the previous run, less the pre-filter slack
+					//for records of the save which set it that were logged after that run
+					date_t dtReadFromDate = il9::utils::AuditLog::il9_auditDateOfSeconds(il9::utils::AuditLog::il9_secondsOfAuditDate(watermark->dtObjectLastModDate)
+						- slackSeconds);
+					int answer = 0;
+
+					if (changedObjects.vectorObjectTags.empty()) changedObjects.dtLoggedAfterDate = dtReadFromDate;
+
+					status = POM_compare_dates(dtReadFromDate, changedObjects.dtLoggedAfterDate, &answer);
+					if (answer < 0) changedObjects.dtLoggedAfterDate = dtReadFromDate;
+
+					changedObjects.vectorObjectTags.push_back(tObjectTag);
+				}
+				else
+				{
+					newObjects.vectorObjectTags.push_back(tObjectTag);
+				}
+			}
+
+			if (!changedObjects.vectorObjectTags.empty())
+			{
+				int answer = 0;
+
+				status = POM_compare_dates(changedObjects.dtLoggedAfterDate, dtLoggedAfterDate, &answer);
+				if (answer < 0) changedObjects.dtLoggedAfterDate = dtLoggedAfterDate;
+			}
+
+			AuditQueryGroup *queryGroups[] = { &newObjects, &changedObjects };
+
+			for (size_t indexGroup = 0; indexGroup < sizeof(queryGroups) / sizeof(queryGroups[0]); indexGroup++)
+			{
+				const AuditQueryGroup &queryGroup = *queryGroups[indexGroup];
+				if (queryGroup.vectorObjectTags.empty()) continue;
+
+				int nRows = 0;
+				int nCols = 0;
+				void*** result = NULL;
+
+				status = il9::utils::AuditLog::il9_prepareAndExecuteBatchQuery(queryGroup.vectorObjectTags, queryGroup.dtLoggedAfterDate, strEventTypeName,
+					propNamesToValidate, nRows, nCols, &result);
+
+				scanStatistics.objectsQueried += (long)queryGroup.vectorObjectTags.size();
+				scanStatistics.auditRowsRead += nRows;
+
+				try
+				{
+					//rows are ordered newest first, the last row of an object is its oldest audit record
+					std::unordered_map<tag_t, int> hmBaselineRowByObject;
+
+					if (nRows > 0 && nCols > 1)
+					{
+						//object column is the last select attribute, the LOGGED_DATE column added by POM for ORDER BY follows it
+						int objectTagColIndex = nCols - 2;
+
+						for (int row_index = 0; row_index < nRows; row_index++)
+						{
+							if (result[row_index][objectTagColIndex] == NULL) continue;
+
+							hmBaselineRowByObject[*((tag_t *)result[row_index][objectTagColIndex])] = row_index;
+						}
+
+						il9::utils::AuditLog::il9_getAuditPropertyColumns(propNamesToValidate, nCols, vectorPropertyCols);
+					}
+
+					for (size_t indexObject = 0; indexObject < queryGroup.vectorObjectTags.size(); indexObject++)
+					{
+						tag_t tObjectTag = queryGroup.vectorObjectTags[indexObject];
+
+						AuditWatermark watermark;
+						watermark.dtObjectLastModDate = hmLastModDateByObject[tObjectTag];
+
+						std::unordered_map<tag_t, int>::const_iterator itBaselineRow = hmBaselineRowByObject.find(tObjectTag);
+
+						if (itBaselineRow != hmBaselineRowByObject.end())
+						{
+							int baselineRow = itBaselineRow->second;
+
+							scoped_smptr<char> spBaselineUid;
+
+							tag_t auditObjectTag = *((tag_t *)result[baselineRow][0]);
+
+							status = POM_tag_to_uid(auditObjectTag, &spBaselineUid);
+
+							watermark.szBaselineAuditUid = spBaselineUid.getString();
+
+							if (result[baselineRow][nCols - 1] != NULL) watermark.dtBaselineLoggedDate = *((date_t *)result[baselineRow][nCols - 1]);
+
+							AuditBaselineSource baselineSource;
+							baselineSource.auditObjectTag = auditObjectTag;
+							baselineSource.result = result;
+							baselineSource.baselineRow = baselineRow;
+							baselineSource.propertyCols = &vectorPropertyCols;
+
+							std::vector< PropertyInfo > modifiedProperties;
+
+							evaluateObject(tObjectTag, propNamesToValidate, currentValues, baselineSource, arena, watermark.baselineFingerprints, modifiedProperties,
+								scanStatistics.auditRecordReads);
+
+							if (!modifiedProperties.empty()) modifiedPropertiesByObject[tObjectTag].swap(modifiedProperties);
+						}
+
+						store.put(hmKeyByObject[tObjectTag], watermark);
+					}
+				}
+				catch (IFail &)
+				{
+					if (result != NULL) MEM_free(result);
+					throw;
+				}
+
+				//clean up
+				if (result != NULL) MEM_free(result);
+			}
+		}
+
+		//journalling
+		journalling.setOutput("objectsFromWatermark", (int)scanStatistics.objectsFromWatermark);
+		journalling.setOutput("objectsQueried", (int)scanStatistics.objectsQueried);
+		journalling.journalRoutineCall();
+	}
+	catch (IFail &exception)
+	{
+		iFail = exception.ifail();
+		logger->error(__FILE__, __LINE__, exception.ifail(), exception.getMessage());
+	}
+
+	if (statistics != NULL) *statistics = scanStatistics;
+
+	return iFail;
+}
@@ -0,0 +1,127 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogWatermark.hxx
+* Description:  This file contains declarations of the persisted audit watermarks used
+*				for incremental Audit Logs scans
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGWATERMARK_HXX
+#define IL9_AUDITLOGWATERMARK_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogBatch.hxx"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace il9
+{
+	namespace utils
+	{
+		namespace AuditLog
+		{
+			//error returned when the watermark file cannot be read, parsed or written
+			const int IL9_AUDIT_WATERMARK_STORE_ERROR = 919002;
+
+			/**
+			* State of one (object, event type, logged after date, property list) scan as of the previous run.
+			*
+			* The baseline of a scan is the oldest audit record logged since the date, so once found it never changes:
+			* later runs compare the current values against the stored fingerprints of the baseline values and read
+			* the audit record again only for properties whose fingerprint differs. While no audit record exists the
+			* entry keeps last_mod_date of the object; for IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME records an unchanged date
+			* means no new save can have logged one.
+			*/
+			struct AuditWatermark
+			{
+				std::string szBaselineAuditUid;				//oldest audit record since the date, empty while there is none
+				date_t dtBaselineLoggedDate = NULLDATE;
+				date_t dtObjectLastModDate = NULLDATE;		//last_mod_date of the object when the entry was written
+
+				//fingerprint of the baseline (old) value of every property, in property list order
+				std::vector<uint64_t> baselineFingerprints;
+
+				bool hasBaseline() const { return !szBaselineAuditUid.empty(); }
+			};
+
+			/**
+			* Watermarks keyed by il9_buildAuditWatermarkKey, persisted in a local text file. Object tags are session
+			* local, so entries are keyed and audit records referenced by UID. save() writes a temporary file next to the
+			* store and renames it, an interrupted run leaves the previous state intact.
+			*/
+			class AuditWatermarkStore
+			{
+			public:
+				explicit AuditWatermarkStore(const std::string &szFilePath);
+
+				//reads the file, a missing file gives an empty store
+				int load();
+				//writes the file if entries were added or changed since load
+				int save();
+
+				//returns NULL when there is no entry for the key
+				const AuditWatermark *find(const std::string &szKey) const;
+				void put(const std::string &szKey, const AuditWatermark &watermark);
+				void clear();
+
+				size_t size() const { return m_hmWatermarks.size(); }
+				const std::string &getFilePath() const { return m_szFilePath; }
+
+			private:
+				std::string m_szFilePath;
+				std::unordered_map<std::string, AuditWatermark> m_hmWatermarks;
+				bool m_isDirty;
+			};
+
+			struct AuditIncrementalScanStatistics
+			{
+				long objectsFromWatermark = 0;		//evaluated against the stored baseline, no audit enquiry
+				long objectsUnchanged = 0;			//no audit record so far, last_mod_date unchanged and older than the date less the pre-filter slack
+				long objectsQueried = 0;			//read from the audit table (new entries and objects modified since)
+				long auditRowsRead = 0;
+				long auditRecordReads = 0;			//old values read from a stored baseline audit record
+			};
+
+			//key of the watermark of an object UID for an event type, logged after date and ordered property list
+			std::string il9_buildAuditWatermarkKey(const std::string &szObjectUid, date_t dtLoggedAfterDate, const std::string &strEventTypeName,
+				const std::vector< ValidatePropertyInput > &propNamesToValidate);
+
+			/**
+			* Incremental version of the batch il9_getModifiedPropertiesInfo, meant for jobs which repeat the same scan
+			* (same date, event type and property list) periodically. Reports the same modified properties as the batch
+			* function, but:
+			*	- objects with a stored baseline are compared against the stored fingerprints without an audit enquiry;
+			*	  the baseline audit record is only read for properties whose fingerprint differs from the current value
+			*	- for IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME records, objects without an audit record whose last_mod_date is
+			*	  unchanged and ruled out by the pre-filter (see il9_prefilterAuditCandidates) are skipped
+			*	- all other objects are read from the audit table; for IL9_AUDIT_PREFILTER_EVENT_TYPE_NAME records, objects
+			*	  which had no audit record at the previous run only from their stored last_mod_date less the pre-filter slack on
+			* The store is updated in memory, the caller saves it once the run has succeeded.
+			*
+			* @param objectTags					tags of the audited objects
+			* @param dtLoggedAfterDate				audit records logged on or after this date are considered
+			* @param strEventTypeName				audit event type name e.g. __Modify
+			* @param propNamesToValidate			properties to validate
+			* @param store							watermarks of the previous runs
+			* @param modifiedPropertiesByObject	modified properties keyed by object tag, only objects with modified properties are added
+			* @param statistics					optional, receives the counters of this run
+			* @param iChunkSize					number of object tags per enquiry, defaults to IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE when <= 0
+			*/
+			int il9_getModifiedPropertiesInfoIncremental(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, std::string strEventTypeName,
+				std::vector< ValidatePropertyInput > propNamesToValidate, AuditWatermarkStore &store,
+				std::map< tag_t, std::vector< PropertyInfo > > &modifiedPropertiesByObject, AuditIncrementalScanStatistics *statistics = NULL,
+				int iChunkSize = IL9_AUDIT_DEFAULT_BATCH_CHUNK_SIZE);
+		}
+	}
+}
+
+#endif
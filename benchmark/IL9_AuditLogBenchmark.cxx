@@ -0,0 +1,602 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogBenchmark.cxx
+* Description:  This file contains the synthetic benchmark of the Audit Logs utilities.
+*				It runs il9_getModifiedPropertiesInfo and il9_trackPropertyValueChange
+*				against the stand-in ITK/POM layer of IL9_AuditLogMockItk.cxx and
+*				reports throughput and latency percentiles per workload.
+*
+*				Build: compile the module sources together with IL9_AuditLogMockItk.cxx
+*				and this file, link base_utils and mld of the Teamcenter kit but not the
+*				ITK/POM libraries; no database or Teamcenter session is needed.
+*
+*				Usage: IL9_AuditLogBenchmark [iterations] [sampled objects]
+*				With IL9_AUDIT_PROFILE=1 the profiler counters are printed at the end.
+*				With IL9_AUDIT_TRACE=<file> only the first workload is run and its calls
+*				are recorded for IL9_AuditLogReplay.
+*				The stand-in column is the share of the measured time spent evaluating
+*				enquiries in the stand-in, i.e. what a database would do instead.
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogMockItk.hxx"
+#include "IL9_AuditLogBatch.hxx"
+#include "IL9_AuditLogBudget.hxx"
+#include "IL9_AuditLogChangePoint.hxx"
+#include "IL9_AuditLogChangeFeed.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogMultiClass.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+#include "IL9_AuditLogResultCache.hxx"
+#include "IL9_AuditLogService.hxx"
+#include "IL9_AuditLogSink.hxx"
+#include "IL9_AuditLogTrace.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogWatermark.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using il9::benchmark::MockAuditDatabase;
+using il9::benchmark::MockWorkloadOptions;
+
+namespace
+{
+	const char *const WATERMARK_FILE_PATH = "IL9_AuditLogBenchmark.watermarks";
+
+	struct BenchmarkWorkload
+	{
+		std::string szName;
+		MockWorkloadOptions options;
+	};
+
+	struct BenchmarkResult
+	{
+		long calls = 0;
+		long objects = 0;			//objects, or object/property pairs for trackPropertyValueChange
+		long failures = 0;
+		long modified = 0;			//modified properties reported, a sanity check across the variants
+		double dTotalMs = 0.0;
+		std::vector<double> vectorLatenciesMs;
+		il9::benchmark::MockCallCounters counters;	//stand-in calls made by the measured calls
+	};
+
+	double percentile(std::vector<double> &vectorLatenciesMs, double dPercentile)
+	{
+		if (vectorLatenciesMs.empty()) return 0.0;
+
+		size_t index = (size_t)(dPercentile * (vectorLatenciesMs.size() - 1) + 0.5);
+		std::nth_element(vectorLatenciesMs.begin(), vectorLatenciesMs.begin() + index, vectorLatenciesMs.end());
+
+		return vectorLatenciesMs[index];
+	}
+
+	//times one call, latencies are recorded per call
+	void measure(BenchmarkResult &benchmarkResult, long objects, const std::function<int()> &call)
+	{
+		il9::benchmark::MockCallCounters countersBefore = MockAuditDatabase::instance().counters();
+		std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+		int iFail = call();
+		double dElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tpStart).count();
+
+		benchmarkResult.calls++;
+		benchmarkResult.objects += objects;
+		benchmarkResult.dTotalMs += dElapsedMs;
+		benchmarkResult.vectorLatenciesMs.push_back(dElapsedMs);
+
+		if (iFail != ITK_ok) benchmarkResult.failures++;
+
+		const il9::benchmark::MockCallCounters &countersAfter = MockAuditDatabase::instance().counters();
+
+		benchmarkResult.counters.enquiries += countersAfter.enquiries - countersBefore.enquiries;
+		benchmarkResult.counters.rowsReturned += countersAfter.rowsReturned - countersBefore.rowsReturned;
+		benchmarkResult.counters.aomCalls += countersAfter.aomCalls - countersBefore.aomCalls;
+		benchmarkResult.counters.dEnquiryMs += countersAfter.dEnquiryMs - countersBefore.dEnquiryMs;
+	}
+
+	void report(const std::string &szWorkload, const std::string &szFunction, BenchmarkResult &benchmarkResult)
+	{
+		const il9::benchmark::MockCallCounters &counters = benchmarkResult.counters;
+		double dThroughput = (benchmarkResult.dTotalMs > 0.0) ? benchmarkResult.objects * 1000.0 / benchmarkResult.dTotalMs : 0.0;
+
+		printf("%-28s %-34s %8ld %12.0f %10.3f %10.3f %10.3f %10ld %8ld %10ld %8ld %7.1f%%\n", szWorkload.c_str(), szFunction.c_str(), benchmarkResult.calls, dThroughput,
+			percentile(benchmarkResult.vectorLatenciesMs, 0.50), percentile(benchmarkResult.vectorLatenciesMs, 0.90), percentile(benchmarkResult.vectorLatenciesMs, 0.99),
+			benchmarkResult.modified, counters.enquiries, counters.rowsReturned, counters.aomCalls,
+			(benchmarkResult.dTotalMs > 0.0) ? 100.0 * counters.dEnquiryMs / benchmarkResult.dTotalMs : 0.0);
+
+		if (benchmarkResult.failures > 0) printf("  %ld failed calls\n", benchmarkResult.failures);
+	}
+
+	void runWorkload(const BenchmarkWorkload &workload, int iIterations, int iSampledObjects)
+	{
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(workload.options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+
+		std::string strEventTypeName = il9::benchmark::MOCK_EVENT_TYPE_NAME;
+		std::vector<tag_t> sampledTags(objectTags.begin(), objectTags.begin() + std::min((size_t)iSampledObjects, objectTags.size()));
+
+		//batch, PropertyInfo per modified property
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+
+				measure(benchmarkResult, (long)objectTags.size(), [&]() {
+					return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, strEventTypeName, properties, modifiedPropertiesByObject);
+				});
+
+				for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+					itObject != modifiedPropertiesByObject.end(); ++itObject)
+				{
+					benchmarkResult.modified += (long)itObject->second.size();
+				}
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(batch)", benchmarkResult);
+		}
+
+		//batch, compact values in an arena
+		{
+			BenchmarkResult benchmarkResult;
+			il9::utils::AuditLog::AuditValueArena arena;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				std::vector< il9::utils::AuditLog::CompactPropertyInfo > modifiedProperties;
+				arena.clear();
+
+				measure(benchmarkResult, (long)objectTags.size(), [&]() {
+					return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, strEventTypeName, properties, arena, modifiedProperties);
+				});
+
+				benchmarkResult.modified += (long)modifiedProperties.size();
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(compact)", benchmarkResult);
+		}
+
+		//batch, streamed as CSV while the chunks are diffed
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				std::ostringstream output;
+				il9::utils::AuditLog::AuditCsvDiffWriter csvWriter(output, false);
+
+				measure(benchmarkResult, (long)objectTags.size(), [&]() {
+					return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, strEventTypeName, properties, csvWriter);
+				});
+
+				benchmarkResult.modified += csvWriter.getNumOfRows();
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(csv sink)", benchmarkResult);
+		}
+
+		//change feed over the class, the objects are found by the scan instead of being passed in
+		{
+			BenchmarkResult benchmarkResult;
+
+			date_t dtLoggedToDate = dtLoggedAfterDate;
+			dtLoggedToDate.year++;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				measure(benchmarkResult, (long)objectTags.size(), [&]() {
+					il9::utils::AuditLog::AuditChangeFeedCursor cursor(dtLoggedAfterDate, dtLoggedToDate, il9::benchmark::MOCK_OBJECT_CLASS, { strEventTypeName },
+						properties);
+
+					int iFail = ITK_ok;
+					bool hasMore = true;
+
+					while (iFail == ITK_ok && hasMore)
+					{
+						std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+						iFail = cursor.fetchNext(modifiedPropertiesByObject, hasMore);
+
+						for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+							itObject != modifiedPropertiesByObject.end(); ++itObject)
+						{
+							benchmarkResult.modified += (long)itObject->second.size();
+						}
+					}
+
+					return iFail;
+				});
+			}
+
+			report(workload.szName, "AuditChangeFeedCursor", benchmarkResult);
+		}
+
+		//incremental: the cold run fills the watermarks, the warm run reads them back from the file
+		{
+			BenchmarkResult coldResult;
+			BenchmarkResult warmResult;
+			il9::utils::AuditLog::AuditWatermarkStore store(WATERMARK_FILE_PATH);
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				store.clear();
+
+				for (int indexRun = 0; indexRun < 2; indexRun++)
+				{
+					BenchmarkResult &benchmarkResult = (indexRun == 0) ? coldResult : warmResult;
+					std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+
+					measure(benchmarkResult, (long)objectTags.size(), [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfoIncremental(objectTags, dtLoggedAfterDate, strEventTypeName, properties, store,
+							modifiedPropertiesByObject);
+					});
+
+					for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+						itObject != modifiedPropertiesByObject.end(); ++itObject)
+					{
+						benchmarkResult.modified += (long)itObject->second.size();
+					}
+
+					if (store.save() != ITK_ok || store.load() != ITK_ok) benchmarkResult.failures++;
+				}
+			}
+
+			std::remove(WATERMARK_FILE_PATH);
+
+			report(workload.szName, "getModifiedPropertiesInfoIncr(cold)", coldResult);
+			report(workload.szName, "getModifiedPropertiesInfoIncr(warm)", warmResult);
+		}
+
+		//one object per call
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					int numOfModifiedProperties = 0;
+					std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName, properties,
+							numOfModifiedProperties, modifiedProperties);
+					});
+
+					benchmarkResult.modified += numOfModifiedProperties;
+				}
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(object)", benchmarkResult);
+		}
+
+		//one object per call with a budget no call reaches, the cost of the checks
+		{
+			BenchmarkResult benchmarkResult;
+
+			il9::utils::AuditLog::AuditCancellationToken cancellationToken;
+
+			il9::utils::AuditLog::AuditLookupBudget budget;
+			budget.dBudgetMs = 1000.0;
+			budget.cancellationToken = &cancellationToken;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					int numOfModifiedProperties = 0;
+					std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+					il9::utils::AuditLog::AuditLookupReport lookupReport;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName, properties,
+							budget, numOfModifiedProperties, modifiedProperties, lookupReport);
+					});
+
+					benchmarkResult.modified += numOfModifiedProperties;
+				}
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(budget)", benchmarkResult);
+		}
+
+		//one object per call, one enquiry for two event types of which only one has audit records
+		{
+			BenchmarkResult benchmarkResult;
+			std::vector<std::string> vectorEventTypeNames = { strEventTypeName, "__Create" };
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					std::map< std::string, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByEventType;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfoByEventType(sampledTags[indexObject], dtLoggedAfterDate, vectorEventTypeNames,
+							properties, modifiedPropertiesByEventType);
+					});
+
+					for (std::map< std::string, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itEventType = modifiedPropertiesByEventType.begin();
+						itEventType != modifiedPropertiesByEventType.end(); itEventType++)
+					{
+						benchmarkResult.modified += (long)itEventType->second.size();
+					}
+				}
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfoByEventType", benchmarkResult);
+		}
+
+		//one object per call, diff evaluated by the enquiry
+		{
+			BenchmarkResult benchmarkResult;
+			il9::utils::AuditLog::AuditValueArena arena;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					std::vector< il9::utils::AuditLog::CompactPropertyInfo > modifiedProperties;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfoPushdown(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName,
+							properties, arena, modifiedProperties);
+					});
+
+					benchmarkResult.modified += (long)modifiedProperties.size();
+				}
+
+				arena.clear();
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(pushdown)", benchmarkResult);
+		}
+
+		//one object per call, streamed as JSON
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				std::ostringstream output;
+				il9::utils::AuditLog::AuditJsonDiffWriter jsonWriter(output);
+
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName,
+							properties, jsonWriter);
+					});
+				}
+
+				benchmarkResult.modified += jsonWriter.getNumOfRows();
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(json sink)", benchmarkResult);
+		}
+
+		//one object per call, the last properties also recorded by the secondary audit class, whose records are younger
+		if (workload.options.iSecondaryAuditProperties > 0)
+		{
+			BenchmarkResult benchmarkResult;
+			std::vector< il9::utils::AuditLog::AuditClassPropertyInput > classProperties;
+
+			for (size_t indexProp = 0; indexProp < properties.size(); indexProp++)
+			{
+				classProperties.push_back({ "", properties[indexProp] });
+			}
+
+			for (size_t indexProp = properties.size() - std::min(properties.size(), (size_t)workload.options.iSecondaryAuditProperties); indexProp < properties.size(); indexProp++)
+			{
+				classProperties.push_back({ il9::benchmark::MOCK_SECONDARY_AUDIT_CLASS, properties[indexProp] });
+			}
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					int numOfModifiedProperties = 0;
+					std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_getModifiedPropertiesInfo(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName, classProperties,
+							numOfModifiedProperties, modifiedProperties);
+					});
+
+					benchmarkResult.modified += numOfModifiedProperties;
+				}
+			}
+
+			report(workload.szName, "getModifiedPropertiesInfo(multi class)", benchmarkResult);
+		}
+
+		//concurrent handlers asking for the same objects through the service, half of them for the first half of the properties
+		{
+			BenchmarkResult benchmarkResult;
+			const int iNumOfThreads = 4;
+
+			std::vector< il9::utils::AuditLog::ValidatePropertyInput > firstProperties(properties.begin(), properties.begin() + (properties.size() + 1) / 2);
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				il9::utils::AuditLog::AuditQueryService service;
+				std::vector<long> vectorModifiedByThread(iNumOfThreads, 0);
+
+				measure(benchmarkResult, (long)(iNumOfThreads * sampledTags.size()), [&]() {
+					std::vector<std::thread> vectorThreads;
+
+					for (int indexThread = 0; indexThread < iNumOfThreads; indexThread++)
+					{
+						vectorThreads.emplace_back([&, indexThread]() {
+							for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+							{
+								int numOfModifiedProperties = 0;
+								std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+								service.getModifiedPropertiesInfo(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName,
+									(indexThread % 2 == 0) ? properties : firstProperties, numOfModifiedProperties, modifiedProperties);
+
+								vectorModifiedByThread[indexThread] += (long)modifiedProperties.size();
+							}
+						});
+					}
+
+					for (size_t indexThread = 0; indexThread < vectorThreads.size(); indexThread++) vectorThreads[indexThread].join();
+
+					return ITK_ok;
+				});
+
+				for (int indexThread = 0; indexThread < iNumOfThreads; indexThread += 2) benchmarkResult.modified += vectorModifiedByThread[indexThread];
+			}
+
+			report(workload.szName, "AuditQueryService(4 threads)", benchmarkResult);
+		}
+
+		//one property per call, every property of an object in turn; the first pass per iteration starts with an empty result cache
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					for (size_t indexProperty = 0; indexProperty < properties.size(); indexProperty++)
+					{
+						std::vector< il9::utils::AuditLog::ModifiedPropertyInfo > modifiedProperties;
+
+						measure(benchmarkResult, 1, [&]() {
+							return il9::utils::AuditLog::il9_trackPropertyValueChange(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName,
+								properties[indexProperty], modifiedProperties);
+						});
+
+						benchmarkResult.modified += (long)modifiedProperties.size();
+					}
+				}
+			}
+
+			report(workload.szName, "trackPropertyValueChange", benchmarkResult);
+		}
+
+		//one object per call, the audit record of the last change of every modified property from a single history scan
+		{
+			BenchmarkResult benchmarkResult;
+
+			for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+			{
+				for (size_t indexObject = 0; indexObject < sampledTags.size(); indexObject++)
+				{
+					std::vector< il9::utils::AuditLog::PropertyChangePoint > vectorChangePoints;
+
+					measure(benchmarkResult, 1, [&]() {
+						return il9::utils::AuditLog::il9_locatePropertyChangePoints(sampledTags[indexObject], dtLoggedAfterDate, strEventTypeName, properties,
+							vectorChangePoints);
+					});
+
+					benchmarkResult.modified += (long)vectorChangePoints.size();
+				}
+			}
+
+			report(workload.szName, "locatePropertyChangePoints", benchmarkResult);
+		}
+	}
+
+	BenchmarkWorkload workloadOf(const std::string &szName, int iNumOfObjects, int iRowsPerObject, int iNumOfProperties)
+	{
+		BenchmarkWorkload workload;
+		workload.szName = szName;
+		workload.options.iNumOfObjects = iNumOfObjects;
+		workload.options.iRowsPerObject = iRowsPerObject;
+		workload.options.iNumOfProperties = iNumOfProperties;
+
+		return workload;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	int iIterations = (argc > 1) ? std::max(1, atoi(argv[1])) : 3;
+	int iSampledObjects = (argc > 2) ? std::max(1, atoi(argv[2])) : 200;
+
+	std::vector<BenchmarkWorkload> vectorWorkloads;
+
+	//object count, rows per object and property count, default type mix
+	vectorWorkloads.push_back(workloadOf("objects=1000 rows=20 props=10", 1000, 20, 10));
+	vectorWorkloads.push_back(workloadOf("objects=10000 rows=20 props=10", 10000, 20, 10));
+	vectorWorkloads.push_back(workloadOf("objects=1000 rows=200 props=10", 1000, 200, 10));
+	vectorWorkloads.push_back(workloadOf("objects=1000 rows=20 props=60", 1000, 20, 60));
+
+	//scalar only
+	BenchmarkWorkload scalarWorkload = workloadOf("scalar objects=1000 rows=20", 1000, 20, 20);
+	scalarWorkload.options.dLongStringShare = 0.0;
+	vectorWorkloads.push_back(scalarWorkload);
+
+	//long string heavy: most properties are long strings with many values
+	BenchmarkWorkload longStringWorkload = workloadOf("longstring objects=1000", 1000, 20, 20);
+	longStringWorkload.options.dLongStringShare = 0.7;
+	longStringWorkload.options.dIntShare = 0.05;
+	longStringWorkload.options.dDoubleShare = 0.05;
+	longStringWorkload.options.dLogicalShare = 0.05;
+	longStringWorkload.options.dDateShare = 0.05;
+	longStringWorkload.options.dTagShare = 0.0;
+	longStringWorkload.options.iLongStringValues = 64;
+	vectorWorkloads.push_back(longStringWorkload);
+
+	//almost nothing modified vs. almost everything modified
+	BenchmarkWorkload unmodifiedWorkload = workloadOf("modified=0.02 objects=1000", 1000, 20, 20);
+	unmodifiedWorkload.options.dModifiedShare = 0.02;
+	vectorWorkloads.push_back(unmodifiedWorkload);
+
+	BenchmarkWorkload modifiedWorkload = workloadOf("modified=0.95 objects=1000", 1000, 20, 20);
+	modifiedWorkload.options.dModifiedShare = 0.95;
+	vectorWorkloads.push_back(modifiedWorkload);
+
+	//sweep where most objects were not modified since the scan date
+	BenchmarkWorkload untouchedWorkload = workloadOf("touched=0.05 objects=10000", 10000, 20, 10);
+	untouchedWorkload.options.dTouchedShare = 0.05;
+	vectorWorkloads.push_back(untouchedWorkload);
+
+	//custom audit class recording a third of the properties as well
+	BenchmarkWorkload secondaryWorkload = workloadOf("secondary=4 objects=1000", 1000, 20, 12);
+	secondaryWorkload.options.iSecondaryAuditProperties = 4;
+	vectorWorkloads.push_back(secondaryWorkload);
+
+	//a trace describes one database, workloads reuse the object tags
+	if (il9::utils::AuditLog::il9_isAuditTraceRecording()) vectorWorkloads.resize(1);
+
+	printf("%-28s %-34s %8s %12s %10s %10s %10s %10s %8s %10s %8s %8s\n", "workload", "function", "calls", "items/s", "p50 ms", "p90 ms", "p99 ms",
+		"modified", "enquiry", "rows", "aom", "stand-in");
+
+	for (size_t indexWorkload = 0; indexWorkload < vectorWorkloads.size(); indexWorkload++)
+	{
+		runWorkload(vectorWorkloads[indexWorkload], iIterations, iSampledObjects);
+	}
+
+	//IL9_AUDIT_PROFILE=1 adds the profiler counters of all workloads
+	if (il9::utils::AuditLog::il9_isAuditProfilingEnabled())
+	{
+		printf("\n");
+		il9::utils::AuditLog::il9_dumpAuditProfileStatistics(std::cout);
+	}
+
+	return 0;
+}
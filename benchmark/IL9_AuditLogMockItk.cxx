@@ -0,0 +1,1419 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogMockItk.cxx
+* Description:  This file contains the stand-in ITK/POM layer used by the Audit Logs
+*				benchmarks: POM enquiries, IL9SimplePOMEnquiry, AOM_ask_value_*,
+*				POM_compare_dates, attribute lookup, UID conversion, the session
+*				calls of the scan workers and MEM_alloc/MEM_free over a synthetic
+*				audit database or a recorded audit trace
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogMockItk.hxx"
+#include "IL9SimplePOMEnquiry.hxx"
+#include "constants/IL9_TypeConstants.hxx"
+
+#include <pom/enq/enq.h>
+#include <pom/pom/pom.h>
+#include <tccore/aom_prop.h>
+#include <fclasses/tc_date.h>
+#include <tc/tc.h>
+
+#include <base_utils/IFail.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+using il9::benchmark::MockAuditDatabase;
+using il9::benchmark::MockObject;
+using il9::benchmark::MockValue;
+
+namespace
+{
+	//error returned by the stand-in for unsupported calls, mirrors a POM error
+	const int MOCK_ERROR = 515001;
+
+	const tag_t MOCK_FIRST_AUDIT_TAG = 10000000;
+	const tag_t MOCK_FIRST_CLASS_TAG = 90000000;
+	const tag_t MOCK_ATTRIBUTE_TAG = 80000000;		//attribute ids only tell that the attribute exists
+
+	const char *const MOCK_UID_PREFIX = "mock";
+
+	int64_t dateKey(const date_t &dtValue)
+	{
+		return ((((((int64_t)dtValue.year * 13 + dtValue.month) * 32 + dtValue.day) * 24 + dtValue.hour) * 60 + dtValue.minute) * 60) + dtValue.second;
+	}
+
+	date_t dateOfHour(int iHour)
+	{
+		//28 day months keep the arithmetic trivial, dates only have to be ordered
+		date_t dtValue = NULLDATE;
+		int iDay = iHour / 24;
+
+		dtValue.year = (short)(2026 + iDay / (28 * 12));
+		dtValue.month = (unsigned char)((iDay / 28) % 12);
+		dtValue.day = (unsigned char)(1 + iDay % 28);
+		dtValue.hour = (unsigned char)(iHour % 24);
+
+		return dtValue;
+	}
+
+	int compareValues(const MockValue &value, const MockValue &otherValue)
+	{
+		if (value.isNull || otherValue.isNull) return (int)otherValue.isNull - (int)value.isNull;
+
+		switch (value.iType)
+		{
+			case(POM_string):
+			case(POM_long_string):
+				return value.szValue.compare(otherValue.szValue);
+			case(POM_logical):
+				return (int)value.lValue - (int)otherValue.lValue;
+			case(POM_int):
+				return (value.iValue > otherValue.iValue) - (value.iValue < otherValue.iValue);
+			case(POM_double):
+				return (value.dValue > otherValue.dValue) - (value.dValue < otherValue.dValue);
+			case(POM_date):
+			{
+				int64_t key = dateKey(value.dtValue);
+				int64_t otherKey = dateKey(otherValue.dtValue);
+
+				return (key > otherKey) - (key < otherKey);
+			}
+			default:
+				return (value.tValue > otherValue.tValue) - (value.tValue < otherValue.tValue);
+		}
+	}
+
+	MockValue tagValue(tag_t tValue)
+	{
+		MockValue value;
+		value.iType = POM_external_reference;
+		value.isNull = (tValue == NULLTAG);
+		value.tValue = tValue;
+
+		return value;
+	}
+
+	//a version is NULL or not independently of where it is read, so the old value of a record matches the new value of the one before
+	bool isNullVersion(int iVersion, tag_t tObjectTag, int indexProperty, double dNullShare)
+	{
+		uint64_t hash = ((uint64_t)tObjectTag * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)indexProperty * 0xC2B2AE3D27D4EB4FULL) ^ ((uint64_t)iVersion * 0x165667B19E3779F9ULL);
+		hash ^= hash >> 29;
+		hash *= 0xBF58476D1CE4E5B9ULL;
+		hash ^= hash >> 32;
+
+		return (double)(hash % 1000) < dNullShare * 1000.0;
+	}
+
+	MockValue valueOf(int iType, int iVersion, tag_t tObjectTag, int indexProperty, int iNumOfObjects, int iLongStringValues, double dNullShare)
+	{
+		MockValue value;
+		value.iType = iType;
+
+		//NULL values keep the defaults of MockValue, AOM_ask_value_* reads them as 0, false, NULLDATE and NULLTAG
+		if (iType != POM_long_string && isNullVersion(iVersion, tObjectTag, indexProperty, dNullShare)) return value;
+
+		value.isNull = false;
+
+		switch (iType)
+		{
+			case(POM_string):
+			{
+				value.szValue = "value_" + std::to_string(tObjectTag) + "_" + std::to_string(indexProperty) + "_" + std::to_string(iVersion);
+				break;
+			}
+			case(POM_long_string):
+			{
+				for (int indexValue = 0; indexValue < iLongStringValues; indexValue++)
+				{
+					value.vectorValues.push_back("entry_" + std::to_string(indexValue) + "_" + std::to_string(iVersion));
+				}
+
+				break;
+			}
+			case(POM_logical):
+			{
+				value.lValue = (iVersion % 2) != 0;
+				break;
+			}
+			case(POM_int):
+			{
+				value.iValue = iVersion;
+				break;
+			}
+			case(POM_double):
+			{
+				value.dValue = iVersion * 1.5;
+				break;
+			}
+			case(POM_date):
+			{
+				value.dtValue = dateOfHour(iVersion * 24);
+				break;
+			}
+			default:
+			{
+				value.tValue = (tag_t)(1 + (tObjectTag + iVersion) % iNumOfObjects);
+				break;
+			}
+		}
+
+		return value;
+	}
+
+	//long string values are kept comma separated on the audit record
+	MockValue auditValueOf(const MockValue &value)
+	{
+		if (value.iType != POM_long_string) return value;
+
+		MockValue auditValue = value;
+		auditValue.vectorValues.clear();
+
+		for (size_t indexValue = 0; indexValue < value.vectorValues.size(); indexValue++)
+		{
+			if (indexValue > 0) auditValue.szValue.append(",");
+			auditValue.szValue.append(value.vectorValues[indexValue]);
+		}
+
+		return auditValue;
+	}
+
+	/**
+	* Minimal POM enquiry interpreter: attribute expressions combined with AND/OR, IN lists, MIN/MAX sub enquiries
+	* used as values and ORDER BY. Order attributes which are not selected are appended as extra columns like POM does.
+	* Join expressions compare attributes of the selected class with attributes of a class joined on a reference
+	* (e.g. fnd0Object = puid); attributes of the joined class are read from the referenced object.
+	*/
+	struct MockExpression
+	{
+		bool isAttribute = true;
+		bool isJoin = false;
+		std::string szClassName;
+		std::string szAttrName;
+		std::string szOtherClassName;
+		std::string szOtherAttrName;
+		int iOperator = 0;
+		std::string szValueId;
+		std::string szLeftExprId;
+		std::string szRightExprId;
+	};
+
+	struct MockEnquiry
+	{
+		std::vector< std::pair<std::string, std::string> > vectorSelectAttrs;
+		std::vector<std::string> vectorSelectExprs;
+		std::unordered_map< std::string, std::vector<MockValue> > hmValues;
+		std::unordered_map<std::string, MockExpression> hmExpressions;
+		std::string szWhereExprId;
+		std::vector< std::tuple<std::string, std::string, int> > vectorOrderAttrs;
+	};
+
+	std::unordered_map<std::string, MockEnquiry> &enquiries()
+	{
+		static std::unordered_map<std::string, MockEnquiry> hmEnquiries;
+		return hmEnquiries;
+	}
+
+	//values are returned by reference, the stand-in must not dominate the measured time with copies
+	const MockValue &attributeOf(tag_t tRowTag, const std::string &szAttrName)
+	{
+		static const MockValue nullValue;
+
+		const MockObject *object = MockAuditDatabase::instance().find(tRowTag);
+		if (object == NULL) return nullValue;
+
+		std::unordered_map<std::string, MockValue>::const_iterator itAttribute = object->hmAttributes.find(szAttrName);
+		if (itAttribute == object->hmAttributes.end()) throw IFail(MOCK_ERROR);
+
+		return itAttribute->second;
+	}
+
+	class MockEvaluator
+	{
+	public:
+		explicit MockEvaluator(MockEnquiry &enquiry) : m_enquiry(enquiry) {}
+
+		void execute(std::vector<tag_t> &vectorRows, std::vector<std::vector<const MockValue *> > &vectorCells);
+		MockValue scalar();
+
+	private:
+		MockValue aggregateOf(const std::string &szExprId);
+		std::string selectClass() const;
+		const MockValue &valueOf(tag_t tRowTag, const std::string &szClassName, const std::string &szAttrName);
+		void candidates(std::vector<tag_t> &vectorCandidates);
+		bool seedFrom(const std::string &szExprId, std::vector<tag_t> &vectorCandidates);
+		bool matches(const std::string &szExprId, tag_t tRowTag);
+		const std::vector<MockValue> &valuesOf(const std::string &szValueId);
+		const std::vector<MockValue> &sortedValuesOf(const std::string &szValueId);
+
+		MockEnquiry &m_enquiry;
+		std::unordered_map< std::string, std::vector<MockValue> > m_hmSubEnquiryValues;
+		std::unordered_map< std::string, std::vector<MockValue> > m_hmSortedValues;
+		std::unordered_map<std::string, std::string> m_hmJoinAttrByClass;
+		std::vector<MockValue> m_vectorAggregates;	//cells of an aggregate only enquiry
+	};
+
+	const std::vector<MockValue> &MockEvaluator::valuesOf(const std::string &szValueId)
+	{
+		std::unordered_map< std::string, std::vector<MockValue> >::const_iterator itValues = m_enquiry.hmValues.find(szValueId);
+		if (itValues != m_enquiry.hmValues.end()) return itValues->second;
+
+		//value of a sub enquiry, evaluated once per execution
+		std::unordered_map< std::string, std::vector<MockValue> >::const_iterator itSubValues = m_hmSubEnquiryValues.find(szValueId);
+		if (itSubValues != m_hmSubEnquiryValues.end()) return itSubValues->second;
+
+		std::unordered_map<std::string, MockEnquiry>::iterator itSubEnquiry = enquiries().find(szValueId);
+		if (itSubEnquiry == enquiries().end()) throw IFail(MOCK_ERROR);
+
+		MockEvaluator subEvaluator(itSubEnquiry->second);
+		return m_hmSubEnquiryValues[szValueId] = std::vector<MockValue>(1, subEvaluator.scalar());
+	}
+
+	//IN lists are searched with a binary search, batch enquiries bind hundreds of values
+	const std::vector<MockValue> &MockEvaluator::sortedValuesOf(const std::string &szValueId)
+	{
+		std::unordered_map< std::string, std::vector<MockValue> >::const_iterator itSortedValues = m_hmSortedValues.find(szValueId);
+		if (itSortedValues != m_hmSortedValues.end()) return itSortedValues->second;
+
+		std::vector<MockValue> &vectorSortedValues = m_hmSortedValues[szValueId] = valuesOf(szValueId);
+		std::sort(vectorSortedValues.begin(), vectorSortedValues.end(), [](const MockValue &value, const MockValue &otherValue) { return compareValues(value, otherValue) < 0; });
+
+		return vectorSortedValues;
+	}
+
+	std::string MockEvaluator::selectClass() const
+	{
+		if (!m_enquiry.vectorSelectAttrs.empty()) return m_enquiry.vectorSelectAttrs[0].first;
+
+		for (size_t indexExpr = 0; indexExpr < m_enquiry.vectorSelectExprs.size(); indexExpr++)
+		{
+			std::unordered_map<std::string, MockExpression>::const_iterator itExpr = m_enquiry.hmExpressions.find(m_enquiry.vectorSelectExprs[indexExpr]);
+			if (itExpr != m_enquiry.hmExpressions.end()) return itExpr->second.szClassName;
+		}
+
+		throw IFail(MOCK_ERROR);
+	}
+
+	//attribute of the row, or of the object referenced by the row for a class joined to the selected class
+	const MockValue &MockEvaluator::valueOf(tag_t tRowTag, const std::string &szClassName, const std::string &szAttrName)
+	{
+		static const MockValue nullValue;
+
+		if (szClassName.empty() || szClassName == selectClass()) return attributeOf(tRowTag, szAttrName);
+
+		//reference attribute of the selected class joined to puid of the class, resolved once per execution
+		std::unordered_map<std::string, std::string>::const_iterator itJoin = m_hmJoinAttrByClass.find(szClassName);
+
+		if (itJoin == m_hmJoinAttrByClass.end())
+		{
+			for (std::unordered_map<std::string, MockExpression>::const_iterator itExpr = m_enquiry.hmExpressions.begin(); itExpr != m_enquiry.hmExpressions.end(); itExpr++)
+			{
+				const MockExpression &expression = itExpr->second;
+
+				if (expression.isJoin && expression.iOperator == POM_enquiry_equal && expression.szOtherClassName == szClassName && expression.szOtherAttrName == ATTR_PUID)
+				{
+					itJoin = m_hmJoinAttrByClass.insert(std::make_pair(szClassName, expression.szAttrName)).first;
+					break;
+				}
+			}
+
+			if (itJoin == m_hmJoinAttrByClass.end()) throw IFail(MOCK_ERROR);
+		}
+
+		const MockValue &reference = attributeOf(tRowTag, itJoin->second);
+		if (reference.isNull) return nullValue;
+
+		const MockObject *object = MockAuditDatabase::instance().find(reference.tValue);
+		if (object == NULL || object->szClassName != szClassName) return nullValue;
+
+		return attributeOf(reference.tValue, szAttrName);
+	}
+
+	//uses an equality or IN condition on fnd0Object or puid of the AND chain as index
+	bool MockEvaluator::seedFrom(const std::string &szExprId, std::vector<tag_t> &vectorCandidates)
+	{
+		std::unordered_map<std::string, MockExpression>::const_iterator itExpr = m_enquiry.hmExpressions.find(szExprId);
+		if (itExpr == m_enquiry.hmExpressions.end()) return false;
+
+		const MockExpression &expression = itExpr->second;
+		if (expression.isJoin) return false;
+
+		if (!expression.isAttribute)
+		{
+			if (expression.iOperator != POM_enquiry_and) return false;
+			return seedFrom(expression.szLeftExprId, vectorCandidates) || seedFrom(expression.szRightExprId, vectorCandidates);
+		}
+
+		if (expression.iOperator != POM_enquiry_equal && expression.iOperator != POM_enquiry_in) return false;
+
+		if (expression.szAttrName == OBJECT_TAG)
+		{
+			const std::vector<MockValue> &vectorValues = valuesOf(expression.szValueId);
+
+			for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++)
+			{
+				const std::vector<tag_t> &vectorAuditTags = MockAuditDatabase::instance().auditRecordsOf(vectorValues[indexValue].tValue);
+				vectorCandidates.insert(vectorCandidates.end(), vectorAuditTags.begin(), vectorAuditTags.end());
+			}
+
+			return true;
+		}
+
+		if (expression.szAttrName == ATTR_PUID)
+		{
+			const std::vector<MockValue> &vectorValues = valuesOf(expression.szValueId);
+
+			for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++) vectorCandidates.push_back(vectorValues[indexValue].tValue);
+			return true;
+		}
+
+		return false;
+	}
+
+	void MockEvaluator::candidates(std::vector<tag_t> &vectorCandidates)
+	{
+		if (!m_enquiry.szWhereExprId.empty() && seedFrom(m_enquiry.szWhereExprId, vectorCandidates)) return;
+
+		const std::vector<tag_t> &vectorClassObjects = MockAuditDatabase::instance().objectsOfClass(selectClass());
+		vectorCandidates.assign(vectorClassObjects.begin(), vectorClassObjects.end());
+	}
+
+	bool MockEvaluator::matches(const std::string &szExprId, tag_t tRowTag)
+	{
+		std::unordered_map<std::string, MockExpression>::const_iterator itExpr = m_enquiry.hmExpressions.find(szExprId);
+		if (itExpr == m_enquiry.hmExpressions.end()) throw IFail(MOCK_ERROR);
+
+		const MockExpression &expression = itExpr->second;
+
+		if (!expression.isAttribute)
+		{
+			if (expression.iOperator == POM_enquiry_and) return matches(expression.szLeftExprId, tRowTag) && matches(expression.szRightExprId, tRowTag);
+			if (expression.iOperator == POM_enquiry_or) return matches(expression.szLeftExprId, tRowTag) || matches(expression.szRightExprId, tRowTag);
+
+			throw IFail(MOCK_ERROR);
+		}
+
+		const MockValue &rowValue = valueOf(tRowTag, expression.szClassName, expression.szAttrName);
+
+		if (expression.isJoin)
+		{
+			//SQL semantics, a comparison with NULL is never true
+			const MockValue &otherValue = valueOf(tRowTag, expression.szOtherClassName, expression.szOtherAttrName);
+			if (rowValue.isNull || otherValue.isNull) return false;
+
+			int iCompare = compareValues(rowValue, otherValue);
+
+			if (expression.iOperator == POM_enquiry_equal) return iCompare == 0;
+			if (expression.iOperator == POM_enquiry_not_equal) return iCompare != 0;
+
+			throw IFail(MOCK_ERROR);
+		}
+
+		if (expression.iOperator == POM_enquiry_is_null) return rowValue.isNull;
+		if (expression.iOperator == POM_enquiry_is_not_null) return !rowValue.isNull;
+
+		if (expression.iOperator == POM_enquiry_in || expression.iOperator == POM_enquiry_not_in)
+		{
+			const std::vector<MockValue> &vectorSortedValues = sortedValuesOf(expression.szValueId);
+
+			bool isFound = std::binary_search(vectorSortedValues.begin(), vectorSortedValues.end(), rowValue,
+				[](const MockValue &value, const MockValue &otherValue) { return compareValues(value, otherValue) < 0; });
+
+			return (expression.iOperator == POM_enquiry_in) == isFound;
+		}
+
+		const std::vector<MockValue> &vectorValues = valuesOf(expression.szValueId);
+
+		if (vectorValues.empty() || rowValue.isNull || vectorValues[0].isNull) return false;
+
+		int iCompare = compareValues(rowValue, vectorValues[0]);
+
+		switch (expression.iOperator)
+		{
+			case(POM_enquiry_equal): return iCompare == 0;
+			case(POM_enquiry_not_equal): return iCompare != 0;
+			case(POM_enquiry_greater_than): return iCompare > 0;
+			case(POM_enquiry_greater_than_or_eq): return iCompare >= 0;
+			case(POM_enquiry_less_than): return iCompare < 0;
+			case(POM_enquiry_less_than_or_eq): return iCompare <= 0;
+			default: throw IFail(MOCK_ERROR);
+		}
+	}
+
+	void MockEvaluator::execute(std::vector<tag_t> &vectorRows, std::vector<std::vector<const MockValue *> > &vectorCells)
+	{
+		//aggregates only, one row like SELECT MIN(...), COUNT(...) FROM ...
+		if (m_enquiry.vectorSelectAttrs.empty() && !m_enquiry.vectorSelectExprs.empty())
+		{
+			m_vectorAggregates.clear();
+			for (size_t indexExpr = 0; indexExpr < m_enquiry.vectorSelectExprs.size(); indexExpr++) m_vectorAggregates.push_back(aggregateOf(m_enquiry.vectorSelectExprs[indexExpr]));
+
+			vectorCells.resize(1);
+			for (size_t indexExpr = 0; indexExpr < m_vectorAggregates.size(); indexExpr++) vectorCells[0].push_back(&m_vectorAggregates[indexExpr]);
+
+			return;
+		}
+
+		std::vector<tag_t> vectorCandidates;
+		candidates(vectorCandidates);
+
+		std::unordered_set<tag_t> hsSeen;
+
+		for (size_t indexCandidate = 0; indexCandidate < vectorCandidates.size(); indexCandidate++)
+		{
+			tag_t tRowTag = vectorCandidates[indexCandidate];
+
+			const MockObject *object = MockAuditDatabase::instance().find(tRowTag);
+			if (object == NULL || object->szClassName != selectClass() || !hsSeen.insert(tRowTag).second) continue;
+
+			if (m_enquiry.szWhereExprId.empty() || matches(m_enquiry.szWhereExprId, tRowTag)) vectorRows.push_back(tRowTag);
+		}
+
+		if (!m_enquiry.vectorOrderAttrs.empty())
+		{
+			//order keys are resolved once per row
+			std::vector< std::pair< tag_t, std::vector<const MockValue *> > > vectorKeyedRows(vectorRows.size());
+
+			for (size_t indexRow = 0; indexRow < vectorRows.size(); indexRow++)
+			{
+				vectorKeyedRows[indexRow].first = vectorRows[indexRow];
+
+				for (size_t indexOrder = 0; indexOrder < m_enquiry.vectorOrderAttrs.size(); indexOrder++)
+				{
+					vectorKeyedRows[indexRow].second.push_back(&attributeOf(vectorRows[indexRow], std::get<1>(m_enquiry.vectorOrderAttrs[indexOrder])));
+				}
+			}
+
+			std::stable_sort(vectorKeyedRows.begin(), vectorKeyedRows.end(), [this](const std::pair< tag_t, std::vector<const MockValue *> > &keyedRow,
+				const std::pair< tag_t, std::vector<const MockValue *> > &otherKeyedRow)
+			{
+				for (size_t indexOrder = 0; indexOrder < m_enquiry.vectorOrderAttrs.size(); indexOrder++)
+				{
+					int iCompare = compareValues(*keyedRow.second[indexOrder], *otherKeyedRow.second[indexOrder]);
+					if (iCompare != 0) return (std::get<2>(m_enquiry.vectorOrderAttrs[indexOrder]) == POM_enquiry_desc_order) ? iCompare > 0 : iCompare < 0;
+				}
+
+				return false;
+			});
+
+			for (size_t indexRow = 0; indexRow < vectorRows.size(); indexRow++) vectorRows[indexRow] = vectorKeyedRows[indexRow].first;
+		}
+
+		//selected attributes, then order attributes which are not selected
+		std::vector< std::pair<std::string, std::string> > vectorColumns(m_enquiry.vectorSelectAttrs.begin(), m_enquiry.vectorSelectAttrs.end());
+
+		for (size_t indexOrder = 0; indexOrder < m_enquiry.vectorOrderAttrs.size(); indexOrder++)
+		{
+			std::pair<std::string, std::string> orderColumn(std::get<0>(m_enquiry.vectorOrderAttrs[indexOrder]), std::get<1>(m_enquiry.vectorOrderAttrs[indexOrder]));
+			if (std::find(vectorColumns.begin(), vectorColumns.end(), orderColumn) == vectorColumns.end()) vectorColumns.push_back(orderColumn);
+		}
+
+		vectorCells.resize(vectorRows.size());
+
+		for (size_t indexRow = 0; indexRow < vectorRows.size(); indexRow++)
+		{
+			vectorCells[indexRow].reserve(vectorColumns.size());
+
+			for (size_t indexColumn = 0; indexColumn < vectorColumns.size(); indexColumn++)
+			{
+				vectorCells[indexRow].push_back(&valueOf(vectorRows[indexRow], vectorColumns[indexColumn].first, vectorColumns[indexColumn].second));
+			}
+		}
+	}
+
+	//value of an aggregate expression (MIN/MAX/COUNT of one attribute) over the matching rows
+	MockValue MockEvaluator::aggregateOf(const std::string &szExprId)
+	{
+		std::unordered_map<std::string, MockExpression>::const_iterator itExpr = m_enquiry.hmExpressions.find(szExprId);
+		if (itExpr == m_enquiry.hmExpressions.end()) throw IFail(MOCK_ERROR);
+
+		std::vector<tag_t> vectorCandidates;
+		candidates(vectorCandidates);
+
+		MockValue aggregate;
+		int iCount = 0;
+		std::unordered_set<tag_t> hsSeen;
+
+		for (size_t indexCandidate = 0; indexCandidate < vectorCandidates.size(); indexCandidate++)
+		{
+			const MockObject *object = MockAuditDatabase::instance().find(vectorCandidates[indexCandidate]);
+			if (object == NULL || object->szClassName != selectClass() || !hsSeen.insert(vectorCandidates[indexCandidate]).second) continue;
+
+			if (!m_enquiry.szWhereExprId.empty() && !matches(m_enquiry.szWhereExprId, vectorCandidates[indexCandidate])) continue;
+
+			const MockValue &value = attributeOf(vectorCandidates[indexCandidate], itExpr->second.szAttrName);
+			if (value.isNull) continue;
+
+			iCount++;
+
+			int iCompare = aggregate.isNull ? 0 : compareValues(value, aggregate);
+
+			if (aggregate.isNull || (itExpr->second.iOperator == POM_enquiry_min && iCompare < 0) || (itExpr->second.iOperator == POM_enquiry_max && iCompare > 0))
+			{
+				aggregate = value;
+			}
+		}
+
+		if (itExpr->second.iOperator == POM_enquiry_count)
+		{
+			aggregate = MockValue();
+			aggregate.isNull = false;
+			aggregate.iType = POM_int;
+			aggregate.iValue = iCount;
+		}
+
+		return aggregate;
+	}
+
+	//value of an aggregate sub enquiry
+	MockValue MockEvaluator::scalar()
+	{
+		if (m_enquiry.vectorSelectExprs.empty()) throw IFail(MOCK_ERROR);
+
+		return aggregateOf(m_enquiry.vectorSelectExprs[0]);
+	}
+
+	size_t cellSize(const MockValue &value)
+	{
+		switch (value.iType)
+		{
+			case(POM_string):
+			case(POM_long_string): return value.szValue.size() + 1;
+			case(POM_logical): return sizeof(logical);
+			case(POM_int): return sizeof(int);
+			case(POM_double): return sizeof(double);
+			case(POM_date): return sizeof(date_t);
+			default: return sizeof(tag_t);
+		}
+	}
+
+	//packs the result like POM does: one allocation freed with a single MEM_free
+	void packResult(const std::vector<std::vector<const MockValue *> > &vectorCells, int *nRows, int *nCols, void ****result)
+	{
+		*nRows = (int)vectorCells.size();
+		*nCols = vectorCells.empty() ? 0 : (int)vectorCells[0].size();
+		*result = NULL;
+
+		if (*nRows == 0) return;
+
+		size_t pointerBytes = sizeof(void **) * (*nRows) + sizeof(void *) * (*nRows) * (*nCols);
+		size_t dataBytes = 0;
+
+		for (size_t indexRow = 0; indexRow < vectorCells.size(); indexRow++)
+		{
+			for (size_t indexColumn = 0; indexColumn < vectorCells[indexRow].size(); indexColumn++)
+			{
+				if (!vectorCells[indexRow][indexColumn]->isNull) dataBytes += (cellSize(*vectorCells[indexRow][indexColumn]) + 7) & ~(size_t)7;
+			}
+		}
+
+		char *pcBlock = (char *)std::malloc(pointerBytes + dataBytes);
+
+		void ***pRows = (void ***)pcBlock;
+		void **pCells = (void **)(pcBlock + sizeof(void **) * (*nRows));
+		char *pcData = pcBlock + pointerBytes;
+
+		for (size_t indexRow = 0; indexRow < vectorCells.size(); indexRow++)
+		{
+			pRows[indexRow] = pCells + indexRow * (*nCols);
+
+			for (size_t indexColumn = 0; indexColumn < vectorCells[indexRow].size(); indexColumn++)
+			{
+				const MockValue &value = *vectorCells[indexRow][indexColumn];
+
+				if (value.isNull)
+				{
+					pRows[indexRow][indexColumn] = NULL;
+					continue;
+				}
+
+				switch (value.iType)
+				{
+					case(POM_string):
+					case(POM_long_string): std::memcpy(pcData, value.szValue.c_str(), value.szValue.size() + 1); break;
+					case(POM_logical): std::memcpy(pcData, &value.lValue, sizeof(logical)); break;
+					case(POM_int): std::memcpy(pcData, &value.iValue, sizeof(int)); break;
+					case(POM_double): std::memcpy(pcData, &value.dValue, sizeof(double)); break;
+					case(POM_date): std::memcpy(pcData, &value.dtValue, sizeof(date_t)); break;
+					default: std::memcpy(pcData, &value.tValue, sizeof(tag_t)); break;
+				}
+
+				pRows[indexRow][indexColumn] = pcData;
+				pcData += (cellSize(value) + 7) & ~(size_t)7;
+			}
+		}
+
+		*result = pRows;
+	}
+
+	int executeEnquiry(MockEnquiry &enquiry, int *nRows, int *nCols, void ****result)
+	{
+		std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+
+		try
+		{
+			std::vector<tag_t> vectorRows;
+			std::vector<std::vector<const MockValue *> > vectorCells;
+
+			MockEvaluator evaluator(enquiry);
+			evaluator.execute(vectorRows, vectorCells);
+
+			packResult(vectorCells, nRows, nCols, result);
+
+			MockAuditDatabase::instance().counters().enquiries++;
+			MockAuditDatabase::instance().counters().rowsReturned += *nRows;
+			MockAuditDatabase::instance().counters().dEnquiryMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tpStart).count();
+		}
+		catch (IFail &exception)
+		{
+			return exception.ifail();
+		}
+
+		return ITK_ok;
+	}
+
+	MockEnquiry *enquiryOf(const char *pcEnquiryId)
+	{
+		std::unordered_map<std::string, MockEnquiry>::iterator itEnquiry = enquiries().find(pcEnquiryId);
+		return (itEnquiry != enquiries().end()) ? &itEnquiry->second : NULL;
+	}
+
+	char *copyString(const std::string &szValue)
+	{
+		char *pcValue = (char *)std::malloc(szValue.size() + 1);
+		std::memcpy(pcValue, szValue.c_str(), szValue.size() + 1);
+
+		return pcValue;
+	}
+
+	int askAttribute(tag_t tObjectTag, const char *pcAttrName, MockValue &value)
+	{
+		MockAuditDatabase::instance().counters().aomCalls++;
+
+		try
+		{
+			value = attributeOf(tObjectTag, pcAttrName);
+		}
+		catch (IFail &exception)
+		{
+			return exception.ifail();
+		}
+
+		return ITK_ok;
+	}
+}
+
+il9::benchmark::MockAuditDatabase &il9::benchmark::MockAuditDatabase::instance()
+{
+	static MockAuditDatabase database;
+	return database;
+}
+
+void il9::benchmark::MockAuditDatabase::generate(const MockWorkloadOptions &options)
+{
+	m_hmObjects.clear();
+	m_hmAuditByObject.clear();
+	m_hmObjectsByClass.clear();
+	m_vectorObjectTags.clear();
+	m_vectorProperties.clear();
+	m_counters = MockCallCounters();
+	m_numOfFailingEnquiries = 0;
+
+	std::mt19937 generator(options.uSeed);
+	std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+	//property types in the requested mix, deterministic order
+	const std::pair<double, int> typeShares[] = {
+		{ options.dLongStringShare, POM_long_string }, { options.dIntShare, POM_int }, { options.dDoubleShare, POM_double },
+		{ options.dLogicalShare, POM_logical }, { options.dDateShare, POM_date }, { options.dTagShare, POM_external_reference } };
+
+	for (int indexProperty = 0; indexProperty < options.iNumOfProperties; indexProperty++)
+	{
+		double dPosition = (indexProperty + 0.5) / options.iNumOfProperties;
+		int iType = POM_string;
+
+		for (size_t indexShare = 0; indexShare < sizeof(typeShares) / sizeof(typeShares[0]); indexShare++)
+		{
+			if (dPosition < typeShares[indexShare].first)
+			{
+				iType = typeShares[indexShare].second;
+				break;
+			}
+
+			dPosition -= typeShares[indexShare].first;
+		}
+
+		il9::utils::AuditLog::ValidatePropertyInput propertyInput;
+		propertyInput.szPropertyName = "il9_bench_prop" + std::to_string(indexProperty);
+		propertyInput.szPropertyNameOld = propertyInput.szPropertyName + "Ovl";
+		propertyInput.iType = iType;
+
+		m_vectorProperties.push_back(propertyInput);
+	}
+
+	m_dtLoggedAfterDate = dateOfHour(0);
+	tag_t tNextAuditTag = MOCK_FIRST_AUDIT_TAG;
+
+	for (int indexObject = 0; indexObject < options.iNumOfObjects; indexObject++)
+	{
+		tag_t tObjectTag = (tag_t)(indexObject + 1);
+
+		MockObject &object = m_hmObjects[tObjectTag];
+		object.szClassName = MOCK_OBJECT_CLASS;
+		object.hmAttributes[ATTR_PUID] = tagValue(tObjectTag);
+
+		m_vectorObjectTags.push_back(tObjectTag);
+		m_hmObjectsByClass[MOCK_OBJECT_CLASS].push_back(tObjectTag);
+
+		std::vector<tag_t> &vectorAuditTags = m_hmAuditByObject[tObjectTag];
+
+		//touched objects are spread evenly over the object list
+		bool isTouched = (int)((indexObject + 1) * options.dTouchedShare) > (int)(indexObject * options.dTouchedShare);
+		int iRowsOfObject = isTouched ? options.iRowsPerObject : 0;
+
+		//version k of every property is the value after the k-th audit record, version 0 the value before the first one
+		for (int indexRow = 0; indexRow < iRowsOfObject; indexRow++)
+		{
+			tag_t tAuditTag = tNextAuditTag++;
+
+			MockObject &auditRecord = m_hmObjects[tAuditTag];
+			auditRecord.szClassName = IL9_TYPE_FND0GENERALAUDIT;
+
+			MockValue eventTypeValue;
+			eventTypeValue.isNull = false;
+			eventTypeValue.szValue = options.szEventTypeName;
+
+			MockValue loggedDateValue;
+			loggedDateValue.iType = POM_date;
+			loggedDateValue.isNull = false;
+			loggedDateValue.dtValue = dateOfHour(1 + indexRow + indexObject * options.iObjectStaggerHours);
+
+			auditRecord.hmAttributes[ATTR_PUID] = tagValue(tAuditTag);
+			auditRecord.hmAttributes[OBJECT_TAG] = tagValue(tObjectTag);
+			auditRecord.hmAttributes[EVENT_TYPE_NAME] = eventTypeValue;
+			auditRecord.hmAttributes[LOGGED_DATE] = loggedDateValue;
+
+			for (int indexProperty = 0; indexProperty < options.iNumOfProperties; indexProperty++)
+			{
+				const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = m_vectorProperties[indexProperty];
+
+				auditRecord.hmAttributes[propertyInput.szPropertyNameOld] = auditValueOf(valueOf(propertyInput.iType, indexRow, tObjectTag, indexProperty,
+					options.iNumOfObjects, options.iLongStringValues, options.dNullShare));
+				auditRecord.hmAttributes[propertyInput.szPropertyName] = auditValueOf(valueOf(propertyInput.iType, indexRow + 1, tObjectTag, indexProperty,
+					options.iNumOfObjects, options.iLongStringValues, options.dNullShare));
+			}
+
+			m_hmObjectsByClass[IL9_TYPE_FND0GENERALAUDIT].push_back(tAuditTag);
+			vectorAuditTags.push_back(tAuditTag);
+
+			if (options.iSecondaryAuditProperties <= 0) continue;
+
+			//same change of the last properties recorded by the secondary audit class
+			tag_t tSecondaryAuditTag = tNextAuditTag++;
+
+			MockObject &secondaryAuditRecord = m_hmObjects[tSecondaryAuditTag];
+			secondaryAuditRecord.szClassName = MOCK_SECONDARY_AUDIT_CLASS;
+
+			loggedDateValue.dtValue.minute = 30;
+
+			secondaryAuditRecord.hmAttributes[ATTR_PUID] = tagValue(tSecondaryAuditTag);
+			secondaryAuditRecord.hmAttributes[OBJECT_TAG] = tagValue(tObjectTag);
+			secondaryAuditRecord.hmAttributes[EVENT_TYPE_NAME] = eventTypeValue;
+			secondaryAuditRecord.hmAttributes[LOGGED_DATE] = loggedDateValue;
+
+			for (int indexProperty = std::max(0, options.iNumOfProperties - options.iSecondaryAuditProperties); indexProperty < options.iNumOfProperties; indexProperty++)
+			{
+				const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = m_vectorProperties[indexProperty];
+
+				secondaryAuditRecord.hmAttributes[propertyInput.szPropertyNameOld] = auditRecord.hmAttributes[propertyInput.szPropertyNameOld];
+				secondaryAuditRecord.hmAttributes[propertyInput.szPropertyName] = auditRecord.hmAttributes[propertyInput.szPropertyName];
+			}
+
+			m_hmObjectsByClass[MOCK_SECONDARY_AUDIT_CLASS].push_back(tSecondaryAuditTag);
+			vectorAuditTags.push_back(tSecondaryAuditTag);
+		}
+
+		//unmodified properties were changed back to their baseline value, long string values in a different order
+		for (int indexProperty = 0; indexProperty < options.iNumOfProperties; indexProperty++)
+		{
+			const il9::utils::AuditLog::ValidatePropertyInput &propertyInput = m_vectorProperties[indexProperty];
+			bool isModified = options.iRowsPerObject > 0 && distribution(generator) < options.dModifiedShare;
+
+			MockValue currentValue = valueOf(propertyInput.iType, isModified ? options.iRowsPerObject : 0, tObjectTag, indexProperty,
+				options.iNumOfObjects, options.iLongStringValues, options.dNullShare);
+
+			if (!isModified) std::reverse(currentValue.vectorValues.begin(), currentValue.vectorValues.end());
+
+			object.hmAttributes[propertyInput.szPropertyName] = currentValue;
+		}
+
+		MockValue lastModDateValue;
+		lastModDateValue.iType = POM_date;
+		lastModDateValue.isNull = false;
+		lastModDateValue.dtValue = dateOfHour(1 + options.iRowsPerObject + indexObject * options.iObjectStaggerHours);
+
+		//records which are not logged by a save of the object do not move last_mod_date
+		if (!isTouched || options.szEventTypeName != MOCK_EVENT_TYPE_NAME) lastModDateValue.dtValue.year--;
+
+		object.hmAttributes["last_mod_date"] = lastModDateValue;
+	}
+}
+
+void il9::benchmark::MockAuditDatabase::load(const il9::utils::AuditLog::AuditTrace &trace)
+{
+	m_hmObjects.clear();
+	m_hmAuditByObject.clear();
+	m_hmObjectsByClass.clear();
+	m_vectorObjectTags.clear();
+	m_vectorProperties.clear();
+	m_counters = MockCallCounters();
+
+	const std::vector< std::pair<tag_t, std::string> > &vectorClasses = trace.getClasses();
+
+	for (size_t indexClass = 0; indexClass < vectorClasses.size(); indexClass++)
+	{
+		m_hmObjects[vectorClasses[indexClass].first].szClassName = vectorClasses[indexClass].second;
+		m_hmObjectsByClass[vectorClasses[indexClass].second].push_back(vectorClasses[indexClass].first);
+	}
+
+	const std::vector<il9::utils::AuditLog::AuditTraceAttribute> &vectorAttributes = trace.getAttributes();
+
+	for (size_t indexAttribute = 0; indexAttribute < vectorAttributes.size(); indexAttribute++)
+	{
+		const il9::utils::AuditLog::AuditTraceValue &tracedValue = vectorAttributes[indexAttribute].value;
+
+		//same layout, AOM_ask_value_strings reads vectorValues of long string values
+		MockValue value;
+		value.iType = tracedValue.iType;
+		value.isNull = tracedValue.isNull;
+		value.lValue = tracedValue.lValue;
+		value.iValue = tracedValue.iValue;
+		value.dValue = tracedValue.dValue;
+		value.dtValue = tracedValue.dtValue;
+		value.tValue = tracedValue.tValue;
+		value.szValue = tracedValue.szValue;
+		value.vectorValues = tracedValue.vectorValues;
+
+		m_hmObjects[vectorAttributes[indexAttribute].tObjectTag].hmAttributes[vectorAttributes[indexAttribute].szAttrName] = value;
+	}
+}
+
+const il9::benchmark::MockObject *il9::benchmark::MockAuditDatabase::find(tag_t tObjectTag) const
+{
+	std::unordered_map<tag_t, MockObject>::const_iterator itObject = m_hmObjects.find(tObjectTag);
+	return (itObject != m_hmObjects.end()) ? &itObject->second : NULL;
+}
+
+const std::vector<tag_t> &il9::benchmark::MockAuditDatabase::auditRecordsOf(tag_t tObjectTag) const
+{
+	static const std::vector<tag_t> vectorNone;
+
+	std::unordered_map< tag_t, std::vector<tag_t> >::const_iterator itAuditTags = m_hmAuditByObject.find(tObjectTag);
+	return (itAuditTags != m_hmAuditByObject.end()) ? itAuditTags->second : vectorNone;
+}
+
+const std::vector<tag_t> &il9::benchmark::MockAuditDatabase::objectsOfClass(const std::string &szClassName) const
+{
+	static const std::vector<tag_t> vectorNone;
+
+	std::unordered_map< std::string, std::vector<tag_t> >::const_iterator itObjects = m_hmObjectsByClass.find(szClassName);
+	return (itObjects != m_hmObjectsByClass.end()) ? itObjects->second : vectorNone;
+}
+
+tag_t il9::benchmark::MockAuditDatabase::classTagOf(const std::string &szClassName)
+{
+	std::unordered_map<std::string, tag_t>::const_iterator itClass = m_hmClassTags.find(szClassName);
+	if (itClass != m_hmClassTags.end()) return itClass->second;
+
+	m_vectorClassNames.push_back(szClassName);
+	return m_hmClassTags[szClassName] = MOCK_FIRST_CLASS_TAG + (tag_t)m_vectorClassNames.size() - 1;
+}
+
+const std::string &il9::benchmark::MockAuditDatabase::classNameOf(tag_t tClassTag) const
+{
+	return m_vectorClassNames.at(tClassTag - MOCK_FIRST_CLASS_TAG);
+}
+
+/*
+* stand-in ITK
+*/
+extern "C"
+{
+	void *MEM_alloc(int iSize)
+	{
+		return std::malloc(iSize);
+	}
+
+	void MEM_free(void *pMemory)
+	{
+		std::free(pMemory);
+	}
+
+	int POM_compare_dates(date_t dtValue, date_t dtOtherValue, int *answer)
+	{
+		int64_t key = dateKey(dtValue);
+		int64_t otherKey = dateKey(dtOtherValue);
+
+		*answer = (key > otherKey) - (key < otherKey);
+		return ITK_ok;
+	}
+
+	int POM_class_of_instance(tag_t tObjectTag, tag_t *tClassTag)
+	{
+		const MockObject *object = MockAuditDatabase::instance().find(tObjectTag);
+		if (object == NULL) return MOCK_ERROR;
+
+		*tClassTag = MockAuditDatabase::instance().classTagOf(object->szClassName);
+		return ITK_ok;
+	}
+
+	int POM_name_of_class(tag_t tClassTag, char **pcClassName)
+	{
+		*pcClassName = copyString(MockAuditDatabase::instance().classNameOf(tClassTag));
+		return ITK_ok;
+	}
+
+	//the stand-in has no schema, an attribute belongs to a class when the first instance of the class has it
+	int POM_attr_id_of_attr(const char *pcAttrName, const char *pcClassName, tag_t *tAttrId)
+	{
+		*tAttrId = NULLTAG;
+
+		const std::vector<tag_t> &vectorClassObjects = MockAuditDatabase::instance().objectsOfClass(pcClassName);
+		if (vectorClassObjects.empty()) return MOCK_ERROR;
+
+		const MockObject *object = MockAuditDatabase::instance().find(vectorClassObjects.front());
+		if (object == NULL || object->hmAttributes.count(pcAttrName) == 0) return MOCK_ERROR;
+
+		*tAttrId = MOCK_ATTRIBUTE_TAG;
+		return ITK_ok;
+	}
+
+	//UIDs of the stand-in are the decimal tags with a prefix
+	int POM_tag_to_uid(tag_t tObjectTag, char **pcUid)
+	{
+		*pcUid = copyString(MOCK_UID_PREFIX + std::to_string(tObjectTag));
+		return ITK_ok;
+	}
+
+	int ITK__convert_uid_to_tag(const char *pcUid, tag_t *tObjectTag)
+	{
+		*tObjectTag = NULLTAG;
+
+		if (std::strncmp(pcUid, MOCK_UID_PREFIX, std::strlen(MOCK_UID_PREFIX)) != 0) return MOCK_ERROR;
+
+		tag_t tTag = (tag_t)std::strtoul(pcUid + std::strlen(MOCK_UID_PREFIX), NULL, 10);
+		if (MockAuditDatabase::instance().find(tTag) != NULL) *tObjectTag = tTag;
+
+		return ITK_ok;
+	}
+
+	//scan workers of the stand-in share the synthetic database of their process, there is no session to open
+	int ITK_auto_login()
+	{
+		return ITK_ok;
+	}
+
+	int ITK_set_journalling(logical)
+	{
+		return ITK_ok;
+	}
+
+	int ITK_exit_module(logical)
+	{
+		return ITK_ok;
+	}
+
+	int AOM_ask_value_string(tag_t tObjectTag, const char *pcPropertyName, char **pcValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*pcValue = (iFail == ITK_ok && !value.isNull) ? copyString(value.szValue) : NULL;
+		return iFail;
+	}
+
+	int AOM_ask_value_strings(tag_t tObjectTag, const char *pcPropertyName, int *num, char ***pcValues)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*num = 0;
+		*pcValues = NULL;
+
+		if (iFail != ITK_ok || value.vectorValues.empty()) return iFail;
+
+		//array and strings in one allocation, freed with a single MEM_free
+		size_t bytes = sizeof(char *) * value.vectorValues.size();
+		for (size_t indexValue = 0; indexValue < value.vectorValues.size(); indexValue++) bytes += value.vectorValues[indexValue].size() + 1;
+
+		char **pcArray = (char **)std::malloc(bytes);
+		char *pcData = (char *)(pcArray + value.vectorValues.size());
+
+		for (size_t indexValue = 0; indexValue < value.vectorValues.size(); indexValue++)
+		{
+			std::memcpy(pcData, value.vectorValues[indexValue].c_str(), value.vectorValues[indexValue].size() + 1);
+			pcArray[indexValue] = pcData;
+			pcData += value.vectorValues[indexValue].size() + 1;
+		}
+
+		*num = (int)value.vectorValues.size();
+		*pcValues = pcArray;
+
+		return ITK_ok;
+	}
+
+	int AOM_ask_value_int(tag_t tObjectTag, const char *pcPropertyName, int *iValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*iValue = value.iValue;
+		return iFail;
+	}
+
+	int AOM_ask_value_logical(tag_t tObjectTag, const char *pcPropertyName, logical *lValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*lValue = value.lValue;
+		return iFail;
+	}
+
+	int AOM_ask_value_date(tag_t tObjectTag, const char *pcPropertyName, date_t *dtValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*dtValue = value.dtValue;
+		return iFail;
+	}
+
+	int AOM_ask_value_tag(tag_t tObjectTag, const char *pcPropertyName, tag_t *tValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*tValue = value.tValue;
+		return iFail;
+	}
+
+	int AOM_ask_value_double(tag_t tObjectTag, const char *pcPropertyName, double *dValue)
+	{
+		MockValue value;
+		int iFail = askAttribute(tObjectTag, pcPropertyName, value);
+
+		*dValue = value.dValue;
+		return iFail;
+	}
+
+	int POM_enquiry_create(const char *pcEnquiryId)
+	{
+		enquiries()[pcEnquiryId] = MockEnquiry();
+		return ITK_ok;
+	}
+
+	int POM_enquiry_delete(const char *pcEnquiryId)
+	{
+		enquiries().erase(pcEnquiryId);
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_sub_enquiry(const char *, const char *pcSubEnquiryId)
+	{
+		enquiries()[pcSubEnquiryId] = MockEnquiry();
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_distinct(const char *pcEnquiryId, logical)
+	{
+		return enquiryOf(pcEnquiryId) != NULL ? ITK_ok : MOCK_ERROR;
+	}
+
+	int POM_enquiry_add_select_attrs(const char *pcEnquiryId, const char *pcClassName, int num, const char **pcAttrNames)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		for (int indexAttr = 0; indexAttr < num; indexAttr++) enquiry->vectorSelectAttrs.push_back(std::make_pair(std::string(pcClassName), std::string(pcAttrNames[indexAttr])));
+		return ITK_ok;
+	}
+
+	int POM_enquiry_add_select_exprs(const char *pcEnquiryId, int num, const char **pcExprIds)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		for (int indexExpr = 0; indexExpr < num; indexExpr++) enquiry->vectorSelectExprs.push_back(pcExprIds[indexExpr]);
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_tag_value(const char *pcEnquiryId, const char *pcValueId, int num, const tag_t *tValues, int)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		std::vector<MockValue> &vectorValues = enquiry->hmValues[pcValueId];
+		vectorValues.clear();
+
+		for (int indexValue = 0; indexValue < num; indexValue++) vectorValues.push_back(tagValue(tValues[indexValue]));
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_string_value(const char *pcEnquiryId, const char *pcValueId, int num, const char **pcValues, int)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		std::vector<MockValue> &vectorValues = enquiry->hmValues[pcValueId];
+		vectorValues.clear();
+
+		for (int indexValue = 0; indexValue < num; indexValue++)
+		{
+			MockValue value;
+			value.isNull = false;
+			value.szValue = pcValues[indexValue];
+
+			vectorValues.push_back(value);
+		}
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_date_value(const char *pcEnquiryId, const char *pcValueId, int num, const date_t *dtValues, int)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		std::vector<MockValue> &vectorValues = enquiry->hmValues[pcValueId];
+		vectorValues.clear();
+
+		for (int indexValue = 0; indexValue < num; indexValue++)
+		{
+			MockValue value;
+			value.iType = POM_date;
+			value.isNull = false;
+			value.dtValue = dtValues[indexValue];
+
+			vectorValues.push_back(value);
+		}
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_int_value(const char *pcEnquiryId, const char *pcValueId, int num, const int *iValues, int)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		std::vector<MockValue> &vectorValues = enquiry->hmValues[pcValueId];
+		vectorValues.clear();
+
+		for (int indexValue = 0; indexValue < num; indexValue++)
+		{
+			MockValue value;
+			value.iType = POM_int;
+			value.isNull = false;
+			value.iValue = iValues[indexValue];
+
+			vectorValues.push_back(value);
+		}
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_attr_expr(const char *pcEnquiryId, const char *pcExprId, const char *pcClassName, const char *pcAttrName, int iOperator, const char *pcValueId)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		MockExpression &expression = enquiry->hmExpressions[pcExprId];
+		expression.isAttribute = true;
+		expression.szClassName = pcClassName;
+		expression.szAttrName = pcAttrName;
+		expression.iOperator = iOperator;
+		expression.szValueId = (pcValueId != NULL) ? pcValueId : "";
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_expr(const char *pcEnquiryId, const char *pcExprId, const char *pcLeftExprId, int iOperator, const char *pcRightExprId)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		MockExpression &expression = enquiry->hmExpressions[pcExprId];
+		expression.isAttribute = false;
+		expression.iOperator = iOperator;
+		expression.szLeftExprId = pcLeftExprId;
+		expression.szRightExprId = (pcRightExprId != NULL) ? pcRightExprId : "";
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_join_expr(const char *pcEnquiryId, const char *pcExprId, const char *pcClassName, const char *pcAttrName, int iOperator,
+		const char *pcOtherClassName, const char *pcOtherAttrName)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		MockExpression &expression = enquiry->hmExpressions[pcExprId];
+		expression.isAttribute = true;
+		expression.isJoin = true;
+		expression.szClassName = pcClassName;
+		expression.szAttrName = pcAttrName;
+		expression.iOperator = iOperator;
+		expression.szOtherClassName = pcOtherClassName;
+		expression.szOtherAttrName = pcOtherAttrName;
+
+		return ITK_ok;
+	}
+
+	int POM_enquiry_set_where_expr(const char *pcEnquiryId, const char *pcExprId)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		enquiry->szWhereExprId = pcExprId;
+		return ITK_ok;
+	}
+
+	int POM_enquiry_add_order_attr(const char *pcEnquiryId, const char *pcClassName, const char *pcAttrName, int iOrder)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL) return MOCK_ERROR;
+
+		enquiry->vectorOrderAttrs.push_back(std::make_tuple(std::string(pcClassName), std::string(pcAttrName), iOrder));
+		return ITK_ok;
+	}
+
+	int POM_enquiry_execute(const char *pcEnquiryId, int *nRows, int *nCols, void ****result)
+	{
+		MockEnquiry *enquiry = enquiryOf(pcEnquiryId);
+		if (enquiry == NULL || MockAuditDatabase::instance().takeEnquiryFailure()) return MOCK_ERROR;
+
+		return executeEnquiry(*enquiry, nRows, nCols, result);
+	}
+}
+
+/*
+* stand-in IL9SimplePOMEnquiry: every addValue is ANDed to the where clause
+*/
+namespace
+{
+	struct MockSimpleEnquiry
+	{
+		MockEnquiry enquiry;
+		int numOfConditions = 0;
+	};
+
+	std::unordered_map<const void *, MockSimpleEnquiry> &simpleEnquiries()
+	{
+		static std::unordered_map<const void *, MockSimpleEnquiry> hmSimpleEnquiries;
+		return hmSimpleEnquiries;
+	}
+
+	MockValue valueOfAny(int iType, const std::any &anyValue)
+	{
+		MockValue value;
+		value.iType = iType;
+		value.isNull = false;
+
+		switch (iType)
+		{
+			case(POM_string): value.szValue = std::any_cast<std::string>(anyValue); break;
+			case(POM_logical): value.lValue = std::any_cast<logical>(anyValue); break;
+			case(POM_int): value.iValue = std::any_cast<int>(anyValue); break;
+			case(POM_double): value.dValue = std::any_cast<double>(anyValue); break;
+			case(POM_date): value.dtValue = std::any_cast<date_t>(anyValue); break;
+			default: value.tValue = std::any_cast<tag_t>(anyValue); break;
+		}
+
+		return value;
+	}
+}
+
+il9::utils::POMEnquiry::IL9SimplePOMEnquiry::IL9SimplePOMEnquiry(const std::string &, bool)
+{
+	simpleEnquiries()[this] = MockSimpleEnquiry();
+}
+
+int il9::utils::POMEnquiry::IL9SimplePOMEnquiry::addSelectAttributes(std::vector< std::pair<const std::string, std::vector<std::string> > > &vectorSelectAttrs)
+{
+	MockSimpleEnquiry &simpleEnquiry = simpleEnquiries()[this];
+
+	for (size_t indexClass = 0; indexClass < vectorSelectAttrs.size(); indexClass++)
+	{
+		for (size_t indexAttr = 0; indexAttr < vectorSelectAttrs[indexClass].second.size(); indexAttr++)
+		{
+			simpleEnquiry.enquiry.vectorSelectAttrs.push_back(std::make_pair(vectorSelectAttrs[indexClass].first, vectorSelectAttrs[indexClass].second[indexAttr]));
+		}
+	}
+
+	return ITK_ok;
+}
+
+void il9::utils::POMEnquiry::IL9SimplePOMEnquiry::addValue(const std::string &szClassName, const std::string &szAttrName, int iOperator, int iType,
+	std::vector<std::any> vectorValues)
+{
+	MockSimpleEnquiry &simpleEnquiry = simpleEnquiries()[this];
+
+	std::string szSuffix = std::to_string(simpleEnquiry.numOfConditions++);
+	std::string szValueId = "value" + szSuffix;
+	std::string szExprId = "expr" + szSuffix;
+
+	for (size_t indexValue = 0; indexValue < vectorValues.size(); indexValue++)
+	{
+		simpleEnquiry.enquiry.hmValues[szValueId].push_back(valueOfAny(iType, vectorValues[indexValue]));
+	}
+
+	MockExpression &expression = simpleEnquiry.enquiry.hmExpressions[szExprId];
+	expression.szClassName = szClassName;
+	expression.szAttrName = szAttrName;
+	expression.iOperator = iOperator;
+	expression.szValueId = szValueId;
+
+	if (simpleEnquiry.enquiry.szWhereExprId.empty())
+	{
+		simpleEnquiry.enquiry.szWhereExprId = szExprId;
+		return;
+	}
+
+	std::string szAndExprId = "and" + szSuffix;
+
+	MockExpression &andExpression = simpleEnquiry.enquiry.hmExpressions[szAndExprId];
+	andExpression.isAttribute = false;
+	andExpression.iOperator = POM_enquiry_and;
+	andExpression.szLeftExprId = simpleEnquiry.enquiry.szWhereExprId;
+	andExpression.szRightExprId = szExprId;
+
+	simpleEnquiry.enquiry.szWhereExprId = szAndExprId;
+}
+
+int il9::utils::POMEnquiry::IL9SimplePOMEnquiry::orderBy(const std::string &szClassName, const std::string &szAttrName, int iOrder)
+{
+	simpleEnquiries()[this].enquiry.vectorOrderAttrs.push_back(std::make_tuple(szClassName, szAttrName, iOrder));
+	return ITK_ok;
+}
+
+int il9::utils::POMEnquiry::IL9SimplePOMEnquiry::run(int *nRows, int *nCols, void ****result)
+{
+	int iFail = executeEnquiry(simpleEnquiries()[this].enquiry, nRows, nCols, result);
+	simpleEnquiries().erase(this);
+
+	return iFail;
+}
@@ -0,0 +1,143 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogMockItk.hxx
+* Description:  This file contains the synthetic audit database behind the stand-in
+*				ITK/POM layer used by the Audit Logs benchmarks
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#ifndef IL9_AUDITLOGMOCKITK_HXX
+#define IL9_AUDITLOGMOCKITK_HXX
+
+#include "IL9_AuditLogUtils.hxx"
+#include "IL9_AuditLogTrace.hxx"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace il9
+{
+	namespace benchmark
+	{
+		//class of the synthetic audited objects
+		const char *const MOCK_OBJECT_CLASS = "IL9_BenchmarkPart";
+		const char *const MOCK_EVENT_TYPE_NAME = "__Modify";
+
+		//custom audit class recording the last iSecondaryAuditProperties properties next to Fnd0GeneralAudit
+		const char *const MOCK_SECONDARY_AUDIT_CLASS = "IL9_BenchmarkAudit";
+
+		struct MockWorkloadOptions
+		{
+			int iNumOfObjects = 1000;
+			int iRowsPerObject = 20;			//audit records per object, all logged after the scan date
+			int iNumOfProperties = 10;
+
+			//share of the properties per type, the remaining properties are POM_string
+			double dLongStringShare = 0.1;
+			double dIntShare = 0.1;
+			double dDoubleShare = 0.1;
+			double dLogicalShare = 0.1;
+			double dDateShare = 0.1;
+			double dTagShare = 0.1;
+
+			int iLongStringValues = 8;			//values per long string property
+			double dModifiedShare = 0.3;		//share of (object, property) pairs whose current value differs from the baseline
+			double dNullShare = 0.0;			//share of the values of non long string properties which are NULL, old values of the audit records included
+			double dTouchedShare = 1.0;			//share of objects modified after the scan date, the others have no audit records and an older last_mod_date
+			std::string szEventTypeName = MOCK_EVENT_TYPE_NAME;	//event type of the audit records, other event types leave last_mod_date before the records
+			int iObjectStaggerHours = 0;		//hours between the first audit records of consecutive objects, 0 logs the records of all objects together
+			int iSecondaryAuditProperties = 0;	//properties also recorded by a MOCK_SECONDARY_AUDIT_CLASS record half an hour after each audit record
+			unsigned int uSeed = 42;
+		};
+
+		//stored value of a synthetic attribute
+		struct MockValue
+		{
+			int iType = POM_string;
+			bool isNull = true;
+			logical lValue = false;
+			int iValue = 0;
+			double dValue = 0.0;
+			date_t dtValue = NULLDATE;
+			tag_t tValue = NULLTAG;
+			std::string szValue;
+			std::vector<std::string> vectorValues;
+		};
+
+		struct MockObject
+		{
+			std::string szClassName;
+			std::unordered_map<std::string, MockValue> hmAttributes;
+		};
+
+		//counters of the stand-in calls, reset by generate()
+		struct MockCallCounters
+		{
+			long enquiries = 0;		//POM_enquiry_execute and IL9SimplePOMEnquiry::run
+			long rowsReturned = 0;
+			long aomCalls = 0;		//AOM_ask_value_*
+			double dEnquiryMs = 0.0;	//time spent evaluating enquiries in the stand-in, not part of the module cost
+		};
+
+		/**
+		* In-memory stand-in for the Teamcenter database: synthetic objects of MOCK_OBJECT_CLASS and their
+		* Fnd0GeneralAudit records. The stand-in ITK functions and IL9SimplePOMEnquiry read from the instance.
+		*/
+		class MockAuditDatabase
+		{
+		public:
+			static MockAuditDatabase &instance();
+
+			void generate(const MockWorkloadOptions &options);
+
+			//objects, classes and AOM answers of a recorded trace, enquiries are replayed from the trace by AuditEnquiry
+			void load(const il9::utils::AuditLog::AuditTrace &trace);
+
+			const std::vector<tag_t> &objectTags() const { return m_vectorObjectTags; }
+			const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties() const { return m_vectorProperties; }
+			date_t loggedAfterDate() const { return m_dtLoggedAfterDate; }
+
+			const MockObject *find(tag_t tObjectTag) const;
+			const std::vector<tag_t> &auditRecordsOf(tag_t tObjectTag) const;
+			const std::vector<tag_t> &objectsOfClass(const std::string &szClassName) const;
+			tag_t classTagOf(const std::string &szClassName);
+			const std::string &classNameOf(tag_t tClassTag) const;
+
+			MockCallCounters &counters() { return m_counters; }
+
+			//the next numOfEnquiries POM_enquiry_execute calls fail like a lock or timeout would, reset by generate()
+			void failEnquiries(int numOfEnquiries) { m_numOfFailingEnquiries = numOfEnquiries; }
+			bool takeEnquiryFailure()
+			{
+				if (m_numOfFailingEnquiries <= 0) return false;
+
+				m_numOfFailingEnquiries--;
+				return true;
+			}
+
+		private:
+			MockAuditDatabase() {}
+
+			std::unordered_map<tag_t, MockObject> m_hmObjects;
+			std::unordered_map< tag_t, std::vector<tag_t> > m_hmAuditByObject;
+			std::unordered_map< std::string, std::vector<tag_t> > m_hmObjectsByClass;
+			std::unordered_map<std::string, tag_t> m_hmClassTags;
+			std::vector<std::string> m_vectorClassNames;
+
+			std::vector<tag_t> m_vectorObjectTags;
+			std::vector< il9::utils::AuditLog::ValidatePropertyInput > m_vectorProperties;
+			date_t m_dtLoggedAfterDate = NULLDATE;
+
+			MockCallCounters m_counters;
+			int m_numOfFailingEnquiries = 0;
+		};
+	}
+}
+
+#endif
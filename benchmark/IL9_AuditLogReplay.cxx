@@ -0,0 +1,198 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogReplay.cxx
+* Description:  This file contains the replay harness of recorded audit traces. It
+*				reruns the il9_getModifiedPropertiesInfo and il9_trackPropertyValueChange
+*				calls of a trace against the recorded enquiry results and AOM answers,
+*				checks their outputs against the recorded ones and reports latency
+*				percentiles per function.
+*
+*				Record: run the module (or IL9_AuditLogBenchmark) with IL9_AUDIT_TRACE set
+*				to the trace file, or call il9_startAuditTraceRecording.
+*				Build: compile the module sources together with IL9_AuditLogMockItk.cxx
+*				and this file, like IL9_AuditLogBenchmark but without its main.
+*
+*				Usage: IL9_AuditLogReplay <trace file> [iterations]
+*				Exits with 1 when a replayed call does not return what was recorded.
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogMockItk.hxx"
+#include "IL9_AuditLogTrace.hxx"
+#include "IL9_AuditLogProfiler.hxx"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using il9::benchmark::MockAuditDatabase;
+
+namespace
+{
+	//mismatching calls printed in full
+	const int MAX_REPORTED_MISMATCHES = 10;
+
+	struct ReplayResult
+	{
+		long calls = 0;
+		long mismatches = 0;
+		double dTotalMs = 0.0;
+		std::vector<double> vectorLatenciesMs;
+		std::vector<double> vectorRecordedLatenciesMs;
+	};
+
+	double percentile(std::vector<double> &vectorLatenciesMs, double dPercentile)
+	{
+		if (vectorLatenciesMs.empty()) return 0.0;
+
+		size_t index = (size_t)(dPercentile * (vectorLatenciesMs.size() - 1) + 0.5);
+		std::nth_element(vectorLatenciesMs.begin(), vectorLatenciesMs.begin() + index, vectorLatenciesMs.end());
+
+		return vectorLatenciesMs[index];
+	}
+
+	const char *functionNameOf(int iFunction)
+	{
+		switch (iFunction)
+		{
+			case(il9::utils::AuditLog::IL9_AUDIT_TRACE_GET_MODIFIED_PROPERTIES_INFO): return "il9_getModifiedPropertiesInfo";
+			case(il9::utils::AuditLog::IL9_AUDIT_TRACE_TRACK_PROPERTY_VALUE_CHANGE): return "il9_trackPropertyValueChange";
+			default: return "unknown";
+		}
+	}
+
+	//reruns a recorded call, outputs are formatted like the recorded ones
+	int replayCall(const il9::utils::AuditLog::AuditTraceCall &call, std::vector<std::string> &vectorOutputs)
+	{
+		int iFail = ITK_ok;
+
+		if (call.iFunction == il9::utils::AuditLog::IL9_AUDIT_TRACE_GET_MODIFIED_PROPERTIES_INFO)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			iFail = il9::utils::AuditLog::il9_getModifiedPropertiesInfo(call.tObjectTag, call.dtLoggedAfterDate, call.strEventTypeName, call.propNamesToValidate,
+				numOfModifiedProperties, modifiedProperties);
+
+			vectorOutputs = il9::utils::AuditLog::il9_formatAuditTraceOutputs(modifiedProperties);
+		}
+		else if (call.iFunction == il9::utils::AuditLog::IL9_AUDIT_TRACE_TRACK_PROPERTY_VALUE_CHANGE && call.propNamesToValidate.size() == 1)
+		{
+			std::vector< il9::utils::AuditLog::ModifiedPropertyInfo > vectorModifiedPropertyInfo;
+
+			iFail = il9::utils::AuditLog::il9_trackPropertyValueChange(call.tObjectTag, call.dtLoggedAfterDate, call.strEventTypeName, call.propNamesToValidate[0],
+				vectorModifiedPropertyInfo);
+
+			vectorOutputs = il9::utils::AuditLog::il9_formatAuditTraceOutputs(vectorModifiedPropertyInfo);
+		}
+		else
+		{
+			iFail = il9::utils::AuditLog::IL9_AUDIT_TRACE_ERROR;
+		}
+
+		return iFail;
+	}
+
+	void reportMismatch(const il9::utils::AuditLog::AuditTraceCall &call, int iFail, const std::vector<std::string> &vectorOutputs)
+	{
+		printf("mismatch: %s tObjectTag=%u dtLoggedAfterDate=%s eventTypeName=%s\n", functionNameOf(call.iFunction), (unsigned int)call.tObjectTag,
+			il9::utils::AuditLog::il9_formatAuditDate(call.dtLoggedAfterDate).c_str(), call.strEventTypeName.c_str());
+		printf("  recorded iFail=%d, replayed iFail=%d\n", call.iFail, iFail);
+
+		for (size_t indexOutput = 0; indexOutput < call.vectorOutputs.size(); indexOutput++) printf("  recorded %s\n", call.vectorOutputs[indexOutput].c_str());
+		for (size_t indexOutput = 0; indexOutput < vectorOutputs.size(); indexOutput++) printf("  replayed %s\n", vectorOutputs[indexOutput].c_str());
+	}
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s <trace file> [iterations]\n", argv[0]);
+		return 2;
+	}
+
+	int iIterations = (argc > 2) ? std::max(1, atoi(argv[2])) : 1;
+
+	il9::utils::AuditLog::AuditTrace trace;
+
+	if (trace.read(argv[1]) != ITK_ok)
+	{
+		fprintf(stderr, "%s is not a readable audit trace\n", argv[1]);
+		return 2;
+	}
+
+	//AOM answers and classes come from the stand-in, enquiries from the trace
+	MockAuditDatabase::instance().load(trace);
+
+	const std::vector<il9::utils::AuditLog::AuditTraceCall> &vectorCalls = trace.getCalls();
+	std::map<std::string, ReplayResult> hmResults;
+	long numOfReportedMismatches = 0;
+
+	for (int indexIteration = 0; indexIteration < iIterations; indexIteration++)
+	{
+		//every iteration starts with empty session caches, like the recorded process
+		il9::utils::AuditLog::il9_setAuditTraceReplay(&trace);
+
+		for (size_t indexCall = 0; indexCall < vectorCalls.size(); indexCall++)
+		{
+			const il9::utils::AuditLog::AuditTraceCall &call = vectorCalls[indexCall];
+			ReplayResult &replayResult = hmResults[functionNameOf(call.iFunction)];
+
+			std::vector<std::string> vectorOutputs;
+
+			std::chrono::steady_clock::time_point tpStart = std::chrono::steady_clock::now();
+			int iFail = replayCall(call, vectorOutputs);
+			double dElapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - tpStart).count();
+
+			replayResult.calls++;
+			replayResult.dTotalMs += dElapsedMs;
+			replayResult.vectorLatenciesMs.push_back(dElapsedMs);
+
+			if (indexIteration == 0) replayResult.vectorRecordedLatenciesMs.push_back(call.dElapsedMs);
+
+			if (iFail != call.iFail || vectorOutputs != call.vectorOutputs)
+			{
+				replayResult.mismatches++;
+
+				if (numOfReportedMismatches++ < MAX_REPORTED_MISMATCHES) reportMismatch(call, iFail, vectorOutputs);
+			}
+		}
+	}
+
+	il9::utils::AuditLog::il9_setAuditTraceReplay(NULL);
+
+	printf("%-34s %8s %10s %10s %10s %10s %14s %10s\n", "function", "calls", "p50 ms", "p90 ms", "p99 ms", "total ms", "recorded p50", "mismatch");
+
+	long numOfMismatches = 0;
+
+	for (std::map<std::string, ReplayResult>::iterator itResult = hmResults.begin(); itResult != hmResults.end(); itResult++)
+	{
+		ReplayResult &replayResult = itResult->second;
+
+		printf("%-34s %8ld %10.3f %10.3f %10.3f %10.1f %14.3f %10ld\n", itResult->first.c_str(), replayResult.calls,
+			percentile(replayResult.vectorLatenciesMs, 0.50), percentile(replayResult.vectorLatenciesMs, 0.90), percentile(replayResult.vectorLatenciesMs, 0.99),
+			replayResult.dTotalMs, percentile(replayResult.vectorRecordedLatenciesMs, 0.50), replayResult.mismatches);
+
+		numOfMismatches += replayResult.mismatches;
+	}
+
+	//IL9_AUDIT_PROFILE=1 adds the profiler counters of the replayed calls
+	if (il9::utils::AuditLog::il9_isAuditProfilingEnabled())
+	{
+		printf("\n");
+		il9::utils::AuditLog::il9_dumpAuditProfileStatistics(std::cout);
+	}
+
+	return (numOfMismatches > 0) ? 1 : 0;
+}
@@ -0,0 +1,1033 @@
+/*************************************************************************************
+* Copyright (c) 2019 Illumina
+* All rights reserved
+*
+* File Name: IL9_AuditLogSelfCheck.cxx
+* Description:  This file contains the consistency checks of the Audit Logs utilities.
+*				Every check generates a synthetic database in the stand-in ITK/POM
+*				layer and compares the optimized entry points against the per property
+*				il9_trackPropertyValueChange, which reads current values through AOM.
+*
+*				Build: compile the module sources together with IL9_AuditLogMockItk.cxx
+*				and this file, like IL9_AuditLogBenchmark but without its main.
+*
+*				Usage: IL9_AuditLogSelfCheck
+*				Prints one line per check and exits with 1 when a check fails. The scan
+*				engine check starts this program again as its worker executable.
+*
+*
+* History
+* Date					Author					Description of Change
+* 10/17/2026			IL9 Team				Initial Creation
+**************************************************************************************/
+#include "IL9_AuditLogMockItk.hxx"
+#include "IL9_AuditLogBackend.hxx"
+#include "IL9_AuditLogBatch.hxx"
+#include "IL9_AuditLogBudget.hxx"
+#include "IL9_AuditLogChangeFeed.hxx"
+#include "IL9_AuditLogChangePoint.hxx"
+#include "IL9_AuditLogEnquiry.hxx"
+#include "IL9_AuditLogHistory.hxx"
+#include "IL9_AuditLogResultCache.hxx"
+#include "IL9_AuditLogScanEngine.hxx"
+#include "IL9_AuditLogSink.hxx"
+#include "IL9_AuditLogTrace.hxx"
+#include "IL9_AuditLogValue.hxx"
+#include "IL9_AuditLogWatermark.hxx"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+using il9::benchmark::MockAuditDatabase;
+using il9::benchmark::MockWorkloadOptions;
+
+namespace
+{
+	//differences printed per check
+	const int MAX_REPORTED_DIFFERENCES = 5;
+
+	struct SelfCheck
+	{
+		const char *pcName;
+		std::function<long()> check;
+	};
+
+	//modified properties of an object as sorted "object<TAB>name<TAB>current value<TAB>old value" lines
+	std::vector<std::string> linesOf(tag_t tObjectTag, const std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+	{
+		std::vector<std::string> vectorLines = il9::utils::AuditLog::il9_formatAuditTraceOutputs(modifiedProperties);
+
+		for (size_t indexLine = 0; indexLine < vectorLines.size(); indexLine++) vectorLines[indexLine] = std::to_string(tObjectTag) + "\t" + vectorLines[indexLine];
+
+		std::sort(vectorLines.begin(), vectorLines.end());
+
+		return vectorLines;
+	}
+
+	//expected lines per object: one il9_trackPropertyValueChange call per distinct property
+	std::map< tag_t, std::vector<std::string> > expectedLinesOf(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &propNamesToValidate)
+	{
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+
+		il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+			std::vector<std::string> vectorPropertyNames;
+
+			for (size_t indexProp = 0; indexProp < propNamesToValidate.size(); indexProp++)
+			{
+				if (std::find(vectorPropertyNames.begin(), vectorPropertyNames.end(), propNamesToValidate[indexProp].szPropertyName) != vectorPropertyNames.end()) continue;
+
+				vectorPropertyNames.push_back(propNamesToValidate[indexProp].szPropertyName);
+
+				std::vector< il9::utils::AuditLog::ModifiedPropertyInfo > vectorModifiedPropertyInfo;
+
+				il9::utils::AuditLog::il9_trackPropertyValueChange(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME,
+					propNamesToValidate[indexProp], vectorModifiedPropertyInfo);
+
+				for (size_t indexInfo = 0; indexInfo < vectorModifiedPropertyInfo.size(); indexInfo++) modifiedProperties.push_back(vectorModifiedPropertyInfo[indexInfo].propertyInfo);
+			}
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+
+		return hmExpectedLines;
+	}
+
+	//number of objects whose lines differ from the expected ones, the first differences are printed
+	long compareLines(const char *pcVariant, const std::map< tag_t, std::vector<std::string> > &hmExpectedLines,
+		std::map< tag_t, std::vector<std::string> > &hmActualLines)
+	{
+		long numOfDifferences = 0;
+
+		for (std::map< tag_t, std::vector<std::string> >::const_iterator itExpected = hmExpectedLines.begin(); itExpected != hmExpectedLines.end(); itExpected++)
+		{
+			std::vector<std::string> &vectorActualLines = hmActualLines[itExpected->first];
+			std::sort(vectorActualLines.begin(), vectorActualLines.end());
+
+			if (vectorActualLines == itExpected->second) continue;
+
+			if (numOfDifferences++ < MAX_REPORTED_DIFFERENCES)
+			{
+				printf("  %s: object %u expected %zu modified properties, got %zu\n", pcVariant, (unsigned int)itExpected->first, itExpected->second.size(),
+					vectorActualLines.size());
+			}
+		}
+
+		return numOfDifferences;
+	}
+
+	//collects the modified properties passed to a sink
+	class CollectingDiffSink : public il9::utils::AuditLog::AuditDiffSink
+	{
+	public:
+		void onModifiedProperty(const il9::utils::AuditLog::CompactPropertyInfo &propertyInfo) override
+		{
+			m_hmModifiedProperties[propertyInfo.objectTag].push_back(propertyInfo.toPropertyInfo());
+		}
+
+		std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > m_hmModifiedProperties;
+	};
+
+	//number of objects for which one of the lookup entry points differs from il9_trackPropertyValueChange
+	long compareLookupPaths(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties)
+	{
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines = expectedLinesOf(objectTags, dtLoggedAfterDate, properties);
+		long numOfDifferences = 0;
+
+		//single object
+		{
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				int numOfModifiedProperties = 0;
+				std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+				il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+					numOfModifiedProperties, modifiedProperties);
+
+				hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfo", hmExpectedLines, hmActualLines);
+		}
+
+		//batch
+		{
+			std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+				modifiedPropertiesByObject);
+
+			for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+				itObject != modifiedPropertiesByObject.end(); itObject++)
+			{
+				hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfo(batch)", hmExpectedLines, hmActualLines);
+		}
+
+		//batch, compact values
+		{
+			il9::utils::AuditLog::AuditValueArena arena;
+			std::vector< il9::utils::AuditLog::CompactPropertyInfo > modifiedProperties;
+			std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties, arena,
+				modifiedProperties);
+
+			for (size_t indexInfo = 0; indexInfo < modifiedProperties.size(); indexInfo++)
+			{
+				modifiedPropertiesByObject[modifiedProperties[indexInfo].objectTag].push_back(modifiedProperties[indexInfo].toPropertyInfo());
+			}
+
+			for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+				itObject != modifiedPropertiesByObject.end(); itObject++)
+			{
+				hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfo(compact)", hmExpectedLines, hmActualLines);
+		}
+
+		//single object into a sink
+		{
+			CollectingDiffSink sink;
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties, sink);
+			}
+
+			for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = sink.m_hmModifiedProperties.begin();
+				itObject != sink.m_hmModifiedProperties.end(); itObject++)
+			{
+				hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfo(sink)", hmExpectedLines, hmActualLines);
+		}
+
+		//single object within a budget which never runs out
+		{
+			il9::utils::AuditLog::AuditLookupBudget budget;
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				int numOfModifiedProperties = 0;
+				std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+				il9::utils::AuditLog::AuditLookupReport report;
+
+				il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+					budget, numOfModifiedProperties, modifiedProperties, report);
+
+				hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfo(budget)", hmExpectedLines, hmActualLines);
+		}
+
+		//single object, filtered by the database
+		{
+			il9::utils::AuditLog::AuditValueArena arena;
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				std::vector< il9::utils::AuditLog::CompactPropertyInfo > compactProperties;
+				std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+				il9::utils::AuditLog::il9_getModifiedPropertiesInfoPushdown(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME,
+					properties, arena, compactProperties);
+
+				for (size_t indexInfo = 0; indexInfo < compactProperties.size(); indexInfo++)
+				{
+					modifiedProperties.push_back(compactProperties[indexInfo].toPropertyInfo());
+				}
+
+				hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+			}
+
+			numOfDifferences += compareLines("getModifiedPropertiesInfoPushdown", hmExpectedLines, hmActualLines);
+		}
+
+		//change points carry the values of il9_trackPropertyValueChange
+		{
+			std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				std::vector< il9::utils::AuditLog::PropertyChangePoint > vectorChangePoints;
+				std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+				il9::utils::AuditLog::il9_locatePropertyChangePoints(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+					vectorChangePoints);
+
+				for (size_t indexChangePoint = 0; indexChangePoint < vectorChangePoints.size(); indexChangePoint++)
+				{
+					modifiedProperties.push_back(vectorChangePoints[indexChangePoint].propertyInfo);
+				}
+
+				hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+			}
+
+			numOfDifferences += compareLines("locatePropertyChangePoints", hmExpectedLines, hmActualLines);
+		}
+
+		return numOfDifferences;
+	}
+
+	/**
+	* Property list with a non long string and a long string property listed twice. Every entry point has to report
+	* each modified property once with the values of its own column, the properties after a duplicate included.
+	*/
+	long checkDuplicatePropertyNames()
+	{
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 50;
+		options.iRowsPerObject = 5;
+		options.iNumOfProperties = 12;
+		options.dModifiedShare = 0.5;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		std::vector< il9::utils::AuditLog::ValidatePropertyInput > properties = database.properties();
+
+		//repeat the first long string and the first other property in the middle of the list
+		std::vector< il9::utils::AuditLog::ValidatePropertyInput > vectorDuplicates;
+
+		for (int iType : { (int)POM_long_string, (int)POM_int })
+		{
+			for (size_t indexProp = 0; indexProp < properties.size(); indexProp++)
+			{
+				if (properties[indexProp].iType != iType) continue;
+
+				vectorDuplicates.push_back(properties[indexProp]);
+				break;
+			}
+		}
+
+		properties.insert(properties.begin() + properties.size() / 2, vectorDuplicates.begin(), vectorDuplicates.end());
+
+		return compareLookupPaths(objectTags, dtLoggedAfterDate, properties);
+	}
+
+	/**
+	* Some current values and some old values are NULL. Every entry point has to read them as the default value of the
+	* type, a NULL value must not take the value of the property compared before it.
+	*/
+	long checkNullValues()
+	{
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 50;
+		options.iRowsPerObject = 5;
+		options.iNumOfProperties = 12;
+		options.dModifiedShare = 0.5;
+		options.dNullShare = 0.3;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		return compareLookupPaths(database.objectTags(), database.loggedAfterDate(), database.properties());
+	}
+
+	//transitions of a cursor as "puid<TAB>name<TAB>old value<TAB>new value" lines in history order, records per page are counted
+	long readHistory(il9::utils::AuditLog::AuditHistoryCursor &cursor, int iNumOfPages, std::vector<std::string> &vectorLines, size_t &maxRecordsPerPage)
+	{
+		bool hasMore = true;
+
+		for (int indexPage = 0; hasMore && (iNumOfPages < 0 || indexPage < iNumOfPages); indexPage++)
+		{
+			std::vector< il9::utils::AuditLog::PropertyTransition > transitions;
+			if (cursor.fetchNext(transitions, hasMore) != ITK_ok) return 1;
+
+			std::set<tag_t> hsAuditObjectTags;
+
+			for (size_t indexTransition = 0; indexTransition < transitions.size(); indexTransition++)
+			{
+				const il9::utils::AuditLog::PropertyTransition &transition = transitions[indexTransition];
+
+				hsAuditObjectTags.insert(transition.auditObjectTag);
+				vectorLines.push_back(std::to_string(transition.auditObjectTag) + "\t" + std::string(transition.szPropertyName) + "\t" + transition.oldValue.toString()
+					+ "\t" + transition.newValue.toString());
+			}
+
+			maxRecordsPerPage = std::max(maxRecordsPerPage, hsAuditObjectTags.size());
+		}
+
+		return 0;
+	}
+
+	/**
+	* History read in small pages, with a resume in the middle, has to give the transitions of a single page read in the
+	* same order, and no page may hold more records than the page size.
+	*/
+	long checkHistoryPaging()
+	{
+		const int PAGE_SIZE = 3;
+
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 5;
+		options.iRowsPerObject = 40;
+		options.iNumOfProperties = 6;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		long numOfDifferences = 0;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			std::vector<std::string> vectorExpectedLines;
+			std::vector<std::string> vectorActualLines;
+			size_t maxRecordsPerPage = 0;
+
+			il9::utils::AuditLog::AuditHistoryCursor singlePageCursor(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+				options.iRowsPerObject);
+			numOfDifferences += readHistory(singlePageCursor, -1, vectorExpectedLines, maxRecordsPerPage);
+
+			maxRecordsPerPage = 0;
+
+			il9::utils::AuditLog::AuditHistoryPosition position;
+
+			{
+				il9::utils::AuditLog::AuditHistoryCursor cursor(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties, PAGE_SIZE);
+				numOfDifferences += readHistory(cursor, 2, vectorActualLines, maxRecordsPerPage);
+				position = cursor.getPosition();
+			}
+
+			//the resumed cursor compares its first record against its own old value column, as the first record of a history
+			il9::utils::AuditLog::AuditHistoryCursor resumedCursor(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+				PAGE_SIZE);
+			resumedCursor.resumeAfter(position);
+			numOfDifferences += readHistory(resumedCursor, -1, vectorActualLines, maxRecordsPerPage);
+
+			if (vectorActualLines != vectorExpectedLines || maxRecordsPerPage > (size_t)PAGE_SIZE)
+			{
+				if (numOfDifferences++ < MAX_REPORTED_DIFFERENCES)
+				{
+					printf("  AuditHistoryCursor: object %u expected %zu transitions, got %zu, largest page %zu records\n", (unsigned int)objectTags[indexObject],
+						vectorExpectedLines.size(), vectorActualLines.size(), maxRecordsPerPage);
+				}
+			}
+		}
+
+		return numOfDifferences;
+	}
+
+	/**
+	* Change feed read in small pages, with a resume in the middle, has to report every object once with the modified
+	* properties of the single object il9_getModifiedPropertiesInfo.
+	*/
+	long checkChangeFeedPaging()
+	{
+		const int PAGE_SIZE = 10;
+
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 40;
+		options.iRowsPerObject = 6;
+		options.iNumOfProperties = 8;
+		options.dModifiedShare = 0.5;
+		options.dTouchedShare = 0.75;
+		options.iObjectStaggerHours = 2;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		date_t dtLoggedToDate = dtLoggedAfterDate;
+		dtLoggedToDate.year++;
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+				numOfModifiedProperties, modifiedProperties);
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		std::map< tag_t, std::vector<std::string> > hmActualLines;
+		long numOfReportedTwice = 0;
+		tag_t tLastObjectTag = NULLTAG;
+		bool hasMore = true;
+
+		for (int indexCursor = 0; indexCursor < 2 && hasMore; indexCursor++)
+		{
+			il9::utils::AuditLog::AuditChangeFeedCursor cursor(dtLoggedAfterDate, dtLoggedToDate, il9::benchmark::MOCK_OBJECT_CLASS,
+				{ il9::benchmark::MOCK_EVENT_TYPE_NAME }, properties, PAGE_SIZE);
+
+			if (tLastObjectTag != NULLTAG) cursor.resumeAfter(tLastObjectTag);
+
+			//the first cursor stops after two pages, the second one resumes after its last object
+			for (int indexPage = 0; hasMore && (indexCursor > 0 || indexPage < 2); indexPage++)
+			{
+				std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+				if (cursor.fetchNext(modifiedPropertiesByObject, hasMore) != ITK_ok) return 1;
+
+				for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+					itObject != modifiedPropertiesByObject.end(); itObject++)
+				{
+					if (hmActualLines.count(itObject->first) > 0) numOfReportedTwice++;
+					hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+				}
+			}
+
+			tLastObjectTag = cursor.getLastObjectTag();
+		}
+
+		if (numOfReportedTwice > 0) printf("  AuditChangeFeedCursor: %ld objects reported twice\n", numOfReportedTwice);
+
+		return compareLines("AuditChangeFeedCursor", hmExpectedLines, hmActualLines) + numOfReportedTwice;
+	}
+
+	/**
+	* Records of an event type other than __Modify are logged without a save, last_mod_date of their objects is older
+	* than the records. The batch function must not drop those objects in the pre-filter.
+	*/
+	long checkPrefilterEventType()
+	{
+		const char *const EVENT_TYPE_NAME = "__Attach";
+
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 30;
+		options.iRowsPerObject = 4;
+		options.iNumOfProperties = 6;
+		options.dModifiedShare = 0.5;
+		options.szEventTypeName = EVENT_TYPE_NAME;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, EVENT_TYPE_NAME, properties,
+				numOfModifiedProperties, modifiedProperties);
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+		std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+		il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags, dtLoggedAfterDate, EVENT_TYPE_NAME, properties, modifiedPropertiesByObject);
+
+		for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+			itObject != modifiedPropertiesByObject.end(); itObject++)
+		{
+			hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+		}
+
+		return compareLines("getModifiedPropertiesInfo(batch)", hmExpectedLines, hmActualLines);
+	}
+
+	/**
+	* A first incremental run finds no audit record, then records of an event type other than __Modify are logged without
+	* a save. The second run must not take the unchanged last_mod_date as proof that there is still no record.
+	*/
+	long checkIncrementalEventType()
+	{
+		const char *const EVENT_TYPE_NAME = "__Attach";
+
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 30;
+		options.iRowsPerObject = 4;
+		options.iNumOfProperties = 6;
+		options.dModifiedShare = 0.5;
+		options.szEventTypeName = EVENT_TYPE_NAME;
+		options.dTouchedShare = 0.0;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		il9::utils::AuditLog::AuditWatermarkStore store("selfcheck_watermarks.txt");
+		std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByObject;
+
+		il9::utils::AuditLog::il9_getModifiedPropertiesInfoIncremental(database.objectTags(), database.loggedAfterDate(), EVENT_TYPE_NAME, database.properties(),
+			store, modifiedPropertiesByObject);
+
+		//same objects and last_mod_dates, now with records
+		options.dTouchedShare = 1.0;
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+		std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, EVENT_TYPE_NAME, properties,
+				numOfModifiedProperties, modifiedProperties);
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		modifiedPropertiesByObject.clear();
+
+		il9::utils::AuditLog::il9_getModifiedPropertiesInfoIncremental(objectTags, dtLoggedAfterDate, EVENT_TYPE_NAME, properties, store,
+			modifiedPropertiesByObject);
+
+		for (std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > >::const_iterator itObject = modifiedPropertiesByObject.begin();
+			itObject != modifiedPropertiesByObject.end(); itObject++)
+		{
+			hmActualLines[itObject->first] = linesOf(itObject->first, itObject->second);
+		}
+
+		return compareLines("getModifiedPropertiesInfoIncremental", hmExpectedLines, hmActualLines);
+	}
+
+	//per property modified properties of il9_trackPropertyValueChange, which reads the baselines through the result cache
+	std::map< tag_t, std::vector<std::string> > trackedLinesOf(const std::vector<tag_t> &objectTags, date_t dtLoggedAfterDate, const char *pcEventTypeName,
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties)
+	{
+		std::map< tag_t, std::vector<std::string> > hmLines;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			for (size_t indexProp = 0; indexProp < properties.size(); indexProp++)
+			{
+				std::vector< il9::utils::AuditLog::ModifiedPropertyInfo > vectorModifiedPropertyInfo;
+
+				il9::utils::AuditLog::il9_trackPropertyValueChange(objectTags[indexObject], dtLoggedAfterDate, pcEventTypeName, properties[indexProp],
+					vectorModifiedPropertyInfo);
+
+				for (size_t indexInfo = 0; indexInfo < vectorModifiedPropertyInfo.size(); indexInfo++) modifiedProperties.push_back(vectorModifiedPropertyInfo[indexInfo].propertyInfo);
+			}
+
+			hmLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		return hmLines;
+	}
+
+	/**
+	* A lookup through the result cache finds no audit record, then records of an event type other than __Modify are
+	* logged without a save. The next lookup must not be served the cached empty baseline.
+	*/
+	long checkResultCacheEventType()
+	{
+		const char *const EVENT_TYPE_NAME = "__Attach";
+
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 30;
+		options.iRowsPerObject = 4;
+		options.iNumOfProperties = 6;
+		options.dModifiedShare = 0.5;
+		options.szEventTypeName = EVENT_TYPE_NAME;
+		options.dTouchedShare = 0.0;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+		trackedLinesOf(database.objectTags(), database.loggedAfterDate(), EVENT_TYPE_NAME, database.properties());
+
+		//same objects and last_mod_dates, now with records
+		options.dTouchedShare = 1.0;
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, EVENT_TYPE_NAME, properties,
+				numOfModifiedProperties, modifiedProperties);
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+		}
+
+		std::map< tag_t, std::vector<std::string> > hmActualLines = trackedLinesOf(objectTags, dtLoggedAfterDate, EVENT_TYPE_NAME, properties);
+
+		il9::utils::AuditLog::il9_invalidateAuditResultCache(NULLTAG);
+
+		return compareLines("trackPropertyValueChange", hmExpectedLines, hmActualLines);
+	}
+
+	//the event type with records has to report the single event type result from its baseline row, the one without records nothing
+	long checkModifiedPropertiesByEventType()
+	{
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 30;
+		options.iRowsPerObject = 5;
+		options.iNumOfProperties = 10;
+		options.dModifiedShare = 0.5;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		date_t dtLoggedAfterDate = database.loggedAfterDate();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines;
+		std::map< tag_t, std::vector<std::string> > hmActualLines;
+		long numOfUnexpectedEventTypes = 0;
+		long numOfFullHistoryReads = 0;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			int numOfModifiedProperties = 0;
+			std::vector< il9::utils::AuditLog::PropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfo(objectTags[indexObject], dtLoggedAfterDate, il9::benchmark::MOCK_EVENT_TYPE_NAME, properties,
+				numOfModifiedProperties, modifiedProperties);
+
+			hmExpectedLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedProperties);
+
+			std::map< std::string, std::vector< il9::utils::AuditLog::PropertyInfo > > modifiedPropertiesByEventType;
+			long numOfRowsBefore = database.counters().rowsReturned;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfoByEventType(objectTags[indexObject], dtLoggedAfterDate, { "__Create", il9::benchmark::MOCK_EVENT_TYPE_NAME },
+				properties, modifiedPropertiesByEventType);
+
+			hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], modifiedPropertiesByEventType[il9::benchmark::MOCK_EVENT_TYPE_NAME]);
+			if (modifiedPropertiesByEventType.size() > 1) numOfUnexpectedEventTypes++;
+
+			//the baseline row and the current values, not the history
+			if (database.counters().rowsReturned - numOfRowsBefore >= options.iRowsPerObject) numOfFullHistoryReads++;
+		}
+
+		if (numOfFullHistoryReads > 0) printf("  getModifiedPropertiesInfoByEventType: %ld objects read their full history\n", numOfFullHistoryReads);
+
+		if (numOfUnexpectedEventTypes > 0) printf("  getModifiedPropertiesInfoByEventType: %ld objects with __Create changes\n", numOfUnexpectedEventTypes);
+
+		return compareLines("getModifiedPropertiesInfoByEventType", hmExpectedLines, hmActualLines) + numOfUnexpectedEventTypes + numOfFullHistoryReads;
+	}
+
+	//a pushdown enquiry which fails for a lock or timeout falls back for its object only, the next object runs it again
+	long checkPushdownTransientFailure()
+	{
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 3;
+		options.iRowsPerObject = 2;
+		options.iNumOfProperties = 4;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+		const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &properties = database.properties();
+
+		std::map< tag_t, std::vector<std::string> > hmExpectedLines = expectedLinesOf(objectTags, database.loggedAfterDate(), properties);
+		std::map< tag_t, std::vector<std::string> > hmActualLines;
+
+		il9::utils::AuditLog::il9_clearAuditEnquiryCache();
+
+		//the pushdown enquiry of the first object
+		database.failEnquiries(1);
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			il9::utils::AuditLog::AuditValueArena arena;
+			std::vector< il9::utils::AuditLog::CompactPropertyInfo > modifiedProperties;
+			std::vector< il9::utils::AuditLog::PropertyInfo > vectorPropertyInfos;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfoPushdown(objectTags[indexObject], database.loggedAfterDate(), il9::benchmark::MOCK_EVENT_TYPE_NAME,
+				properties, arena, modifiedProperties);
+
+			for (size_t indexInfo = 0; indexInfo < modifiedProperties.size(); indexInfo++) vectorPropertyInfos.push_back(modifiedProperties[indexInfo].toPropertyInfo());
+
+			hmActualLines[objectTags[indexObject]] = linesOf(objectTags[indexObject], vectorPropertyInfos);
+		}
+
+		il9::utils::AuditLog::AuditEnquiryCacheStatistics statistics;
+		il9::utils::AuditLog::il9_getAuditEnquiryCacheStatistics(statistics);
+
+		il9::utils::AuditLog::il9_clearAuditEnquiryCache();
+
+		long numOfDifferences = compareLines("getModifiedPropertiesInfoPushdown", hmExpectedLines, hmActualLines);
+
+		if (statistics.failed != 0 || statistics.skipped != 0)
+		{
+			printf("  getModifiedPropertiesInfoPushdown: %d failed signatures, %ld skipped executions after a transient failure\n", statistics.failed,
+				statistics.skipped);
+			numOfDifferences++;
+		}
+
+		return numOfDifferences;
+	}
+
+	//set for the scan workers started by checkScanEngine, which run this program as their executable
+	const char *const SCAN_WORKER_VARIABLE = "IL9_AUDIT_SELFCHECK_SCAN_WORKER";
+
+	const int SCAN_SHARD_SIZE = 5;
+	const tag_t SCAN_CRASHING_OBJECT = 13;		//its worker exits while scanning the shard
+	const tag_t SCAN_UNRESOLVED_OBJECT = 42;	//its UID does not resolve in the workers
+
+	bool isScanWorker = false;
+	std::string szScanWorkerPath;
+
+	//every object is modified, its current value is the process which scanned it
+	int scanObjects(const std::vector<tag_t> &objectTags, date_t, const std::string &, const std::vector< il9::utils::AuditLog::ValidatePropertyInput > &,
+		std::map< tag_t, std::vector< il9::utils::AuditLog::PropertyInfo > > &modifiedPropertiesByObject)
+	{
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+#ifndef _WIN32
+			if (isScanWorker && objectTags[indexObject] == SCAN_CRASHING_OBJECT) _exit(1);
+
+			modifiedPropertiesByObject[objectTags[indexObject]].push_back({ "mock_scanned_by", std::to_string((long)getpid()), std::string() });
+#else
+			modifiedPropertiesByObject[objectTags[indexObject]].push_back({ "mock_scanned_by", std::string(), std::string() });
+#endif
+		}
+
+		return ITK_ok;
+	}
+
+	class SelfCheckScanBackend : public il9::utils::AuditLog::InProcessAuditScanBackend
+	{
+	public:
+		SelfCheckScanBackend() : il9::utils::AuditLog::InProcessAuditScanBackend(scanObjects) {}
+
+		int uidToTag(const std::string &szUid, tag_t &tObjectTag) override
+		{
+			int iFail = il9::utils::AuditLog::InProcessAuditScanBackend::uidToTag(szUid, tObjectTag);
+			if (isScanWorker && tObjectTag == SCAN_UNRESOLVED_OBJECT) tObjectTag = NULLTAG;
+
+			return iFail;
+		}
+	};
+
+	/**
+	* Objects are delivered in input order in the calling process and through workers. A worker which exits fails its
+	* shard only and is replaced, an object which does not resolve in the worker is reported on its own.
+	*/
+	long checkScanEngine()
+	{
+		std::vector<tag_t> objectTags;
+		for (tag_t tObjectTag = 1; tObjectTag <= 60; tObjectTag++) objectTags.push_back(tObjectTag);
+
+		SelfCheckScanBackend backend;
+		long numOfDifferences = 0;
+
+		//in the calling process
+		{
+			il9::utils::AuditLog::AuditScanOptions options;
+			options.iNumOfWorkers = 1;
+			options.iShardSize = SCAN_SHARD_SIZE;
+
+			std::vector<tag_t> vectorDeliveredTags;
+			std::vector< il9::utils::AuditLog::AuditScanShardFailure > failures;
+
+			il9::utils::AuditLog::AuditScanEngine engine(backend, options);
+			int iFail = engine.run(objectTags, NULLDATE, il9::benchmark::MOCK_EVENT_TYPE_NAME, {},
+				[&](tag_t tObjectTag, std::vector< il9::utils::AuditLog::PropertyInfo > &) { vectorDeliveredTags.push_back(tObjectTag); }, failures);
+
+			if (iFail != ITK_ok || vectorDeliveredTags != objectTags || !failures.empty())
+			{
+				printf("  AuditScanEngine(in process): %zu of %zu objects delivered in order, %zu failures\n", vectorDeliveredTags.size(), objectTags.size(),
+					failures.size());
+				numOfDifferences++;
+			}
+		}
+
+#ifndef _WIN32
+		//in workers, the worker scanning SCAN_CRASHING_OBJECT exits
+		{
+			il9::utils::AuditLog::AuditScanOptions options;
+			options.iNumOfWorkers = 2;
+			options.iShardSize = SCAN_SHARD_SIZE;
+			options.szWorkerPath = szScanWorkerPath;
+
+			size_t crashingShard = (size_t)(SCAN_CRASHING_OBJECT - 1) / SCAN_SHARD_SIZE;
+			size_t unresolvedShard = (size_t)(SCAN_UNRESOLVED_OBJECT - 1) / SCAN_SHARD_SIZE;
+
+			std::vector<tag_t> vectorExpectedTags;
+
+			for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+			{
+				if (indexObject / SCAN_SHARD_SIZE != crashingShard && objectTags[indexObject] != SCAN_UNRESOLVED_OBJECT) vectorExpectedTags.push_back(objectTags[indexObject]);
+			}
+
+			std::vector<tag_t> vectorDeliveredTags;
+			std::set<std::string> hsWorkerPids;
+			std::vector< il9::utils::AuditLog::AuditScanShardFailure > failures;
+
+			setenv(SCAN_WORKER_VARIABLE, "1", 1);
+
+			il9::utils::AuditLog::AuditScanEngine engine(backend, options);
+			int iFail = engine.run(objectTags, NULLDATE, il9::benchmark::MOCK_EVENT_TYPE_NAME, {},
+				[&](tag_t tObjectTag, std::vector< il9::utils::AuditLog::PropertyInfo > &modifiedProperties)
+				{
+					vectorDeliveredTags.push_back(tObjectTag);
+					if (modifiedProperties.size() == 1) hsWorkerPids.insert(std::any_cast<std::string>(modifiedProperties[0].szCurrentValue));
+				}, failures);
+
+			unsetenv(SCAN_WORKER_VARIABLE);
+
+			if (iFail != ITK_ok || vectorDeliveredTags != vectorExpectedTags)
+			{
+				printf("  AuditScanEngine(workers): %zu of %zu objects delivered in order\n", vectorDeliveredTags.size(), vectorExpectedTags.size());
+				numOfDifferences++;
+			}
+
+			bool isExpectedFailures = failures.size() == 2
+				&& failures[0].shardIndex == crashingShard && failures[0].iFail == il9::utils::AuditLog::IL9_AUDIT_SCAN_WORKER_FAILED
+				&& failures[0].objectTags.size() == (size_t)SCAN_SHARD_SIZE
+				&& failures[1].shardIndex == unresolvedShard && failures[1].iFail == il9::utils::AuditLog::IL9_AUDIT_SCAN_OBJECT_NOT_FOUND
+				&& failures[1].objectTags == std::vector<tag_t>({ SCAN_UNRESOLVED_OBJECT });
+
+			if (!isExpectedFailures)
+			{
+				printf("  AuditScanEngine(workers): %zu failures, expected the crashed shard and the unresolved object\n", failures.size());
+				numOfDifferences++;
+			}
+
+			//the two workers and the replacement of the one which exited
+			if (hsWorkerPids.size() < 3)
+			{
+				printf("  AuditScanEngine(workers): objects scanned by %zu worker processes, the exited worker was not replaced\n", hsWorkerPids.size());
+				numOfDifferences++;
+			}
+		}
+#endif
+
+		return numOfDifferences;
+	}
+
+	//a pushdown enquiry which cannot be run for the class of the object fails once, later objects of the class skip it
+	long checkPushdownFailureCached()
+	{
+		MockWorkloadOptions options;
+		options.iNumOfObjects = 3;
+		options.iRowsPerObject = 2;
+		options.iNumOfProperties = 4;
+
+		MockAuditDatabase &database = MockAuditDatabase::instance();
+		database.generate(options);
+
+		const std::vector<tag_t> &objectTags = database.objectTags();
+
+		//not an attribute of the object class nor of the audit class
+		std::vector< il9::utils::AuditLog::ValidatePropertyInput > properties = database.properties();
+		properties.push_back({ "mock_missing_property", "mock_missing_property_old", POM_int });
+
+		il9::utils::AuditLog::il9_clearAuditEnquiryCache();
+
+		il9::utils::AuditLog::AuditValueArena arena;
+
+		for (size_t indexObject = 0; indexObject < objectTags.size(); indexObject++)
+		{
+			std::vector< il9::utils::AuditLog::CompactPropertyInfo > modifiedProperties;
+
+			il9::utils::AuditLog::il9_getModifiedPropertiesInfoPushdown(objectTags[indexObject], database.loggedAfterDate(), il9::benchmark::MOCK_EVENT_TYPE_NAME,
+				properties, arena, modifiedProperties);
+		}
+
+		il9::utils::AuditLog::AuditEnquiryCacheStatistics statistics;
+		il9::utils::AuditLog::il9_getAuditEnquiryCacheStatistics(statistics);
+
+		il9::utils::AuditLog::il9_clearAuditEnquiryCache();
+
+		if (statistics.failed != 1 || statistics.skipped != (long)objectTags.size() - 1)
+		{
+			printf("  getModifiedPropertiesInfoPushdown: %d failed signatures, %ld skipped executions\n", statistics.failed, statistics.skipped);
+			return 1;
+		}
+
+		return 0;
+	}
+}
+
+int main(int, char *argv[])
+{
+#ifndef _WIN32
+	//started by checkScanEngine as a scan worker
+	if (std::getenv(SCAN_WORKER_VARIABLE) != NULL)
+	{
+		isScanWorker = true;
+
+		SelfCheckScanBackend backend;
+		return il9::utils::AuditLog::il9_runAuditScanWorker(STDIN_FILENO, backend);
+	}
+#endif
+
+	szScanWorkerPath = argv[0];
+
+	std::vector<SelfCheck> vectorChecks;
+	vectorChecks.push_back({ "duplicate property names", checkDuplicatePropertyNames });
+	vectorChecks.push_back({ "null values", checkNullValues });
+	vectorChecks.push_back({ "history paging", checkHistoryPaging });
+	vectorChecks.push_back({ "change feed paging", checkChangeFeedPaging });
+	vectorChecks.push_back({ "prefilter event type", checkPrefilterEventType });
+	vectorChecks.push_back({ "incremental event type", checkIncrementalEventType });
+	vectorChecks.push_back({ "result cache event type", checkResultCacheEventType });
+	vectorChecks.push_back({ "modified properties by event type", checkModifiedPropertiesByEventType });
+	vectorChecks.push_back({ "pushdown failure cached", checkPushdownFailureCached });
+	vectorChecks.push_back({ "pushdown transient failure", checkPushdownTransientFailure });
+	vectorChecks.push_back({ "scan engine", checkScanEngine });
+
+	long numOfFailedChecks = 0;
+
+	for (size_t indexCheck = 0; indexCheck < vectorChecks.size(); indexCheck++)
+	{
+		long numOfDifferences = vectorChecks[indexCheck].check();
+
+		printf("%-40s %s\n", vectorChecks[indexCheck].pcName, (numOfDifferences == 0) ? "ok" : "FAILED");
+
+		if (numOfDifferences != 0) numOfFailedChecks++;
+	}
+
+	return (numOfFailedChecks > 0) ? 1 : 0;
+}